@@ -1054,7 +1054,7 @@ KhmerBreakEngine::divideUpDictionaryRange( UText *text,
  */
 static const uint32_t kuint32max = 0xFFFFFFFF;
 CjkBreakEngine::CjkBreakEngine(DictionaryMatcher *adoptDictionary, LanguageType type, UErrorCode &status)
-: DictionaryBreakEngine(), fDictionary(adoptDictionary), isCj(false) {
+: DictionaryBreakEngine(), fDictionary(adoptDictionary), isCj(false), fScratch(nullptr) {
     UTRACE_ENTRY(UTRACE_UBRK_CREATE_BREAK_ENGINE);
     UTRACE_DATA1(UTRACE_INFO, "dictbe=%s", "Hani");
     fMlBreakEngine = nullptr;
@@ -1093,9 +1093,76 @@ CjkBreakEngine::CjkBreakEngine(DictionaryMatcher *adoptDictionary, LanguageType
     UTRACE_EXIT_STATUS(status);
 }
 
+/**
+ * The working storage of CjkBreakEngine::divideUpDictionaryRange().
+ * Strings and vectors keep their capacity when they are emptied, so
+ * reusing one Scratch for similar-sized ranges does no heap allocation.
+ */
+struct CjkBreakEngine::Scratch : public UMemory {
+    Scratch(UErrorCode &status)
+        : inputMap(status), normalizedMap(status), bestSnlp(status), prev(status),
+          values(status), lengths(status), t_boundary(status) {}
+
+    // Copy of the input range, when the UText does not hold it in one chunk.
+    UnicodeString input;
+    UnicodeString normalizedInput;
+    UnicodeString fragment;
+    UnicodeString normalizedFragment;
+    UVector32 inputMap;
+    UVector32 normalizedMap;
+    UVector32 bestSnlp;
+    UVector32 prev;
+    UVector32 values;
+    UVector32 lengths;
+    UVector32 t_boundary;
+};
+
 CjkBreakEngine::~CjkBreakEngine(){
     delete fDictionary;
     delete fMlBreakEngine;
+    delete fScratch.load();
+}
+
+// The longest range whose Scratch is kept for the next call.
+// The buffers grow with the range length, and an engine lives as long as
+// the process, so the Scratch of a longer range is freed after its call.
+static const int32_t CJK_SCRATCH_MAX_KEPT_LENGTH = 4096;
+
+// The engine is shared by all break iterators, possibly on several threads.
+// It keeps one Scratch, which a call takes for its duration; a concurrent
+// call that finds it taken works with its own temporary Scratch.
+CjkBreakEngine::Scratch *CjkBreakEngine::acquireScratch(UErrorCode &status) const {
+    Scratch *scratch = fScratch.exchange(nullptr);
+    if (scratch == nullptr) {
+        scratch = new Scratch(status);
+        if (scratch == nullptr) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        } else if (U_FAILURE(status)) {
+            delete scratch;
+            scratch = nullptr;
+        }
+    }
+    return scratch;
+}
+
+void CjkBreakEngine::releaseScratch(Scratch *scratch, int32_t rangeLength) const {
+    Scratch *expected = nullptr;
+    if (rangeLength > CJK_SCRATCH_MAX_KEPT_LENGTH ||
+            !fScratch.compare_exchange_strong(expected, scratch)) {
+        delete scratch;
+    }
+}
+
+// Resize v to size elements, all set to value, reusing its capacity.
+static inline void resetVector(UVector32 &v, int32_t size, int32_t value, UErrorCode &status) {
+    v.removeAllElements();
+    if (v.ensureCapacity(size, status)) {
+        v.setSize(size);
+        int32_t *p = v.getBuffer();
+        for (int32_t i = 0; i < size; i++) {
+            p[i] = value;
+        }
+    }
 }
 
 // The katakanaCost values below are based on the length frequencies of all
@@ -1142,12 +1209,33 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         return 0;
     }
 
+    LocalPointer<Scratch> scratch(acquireScratch(status));
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int32_t result = divideUpDictionaryRange(inText, rangeStart, rangeEnd, foundBreaks,
+                                             isPhraseBreaking, *scratch, status);
+    releaseScratch(scratch.orphan(), rangeEnd - rangeStart);
+    return result;
+}
+
+// Same as above, with all working storage taken from scratch.
+int32_t
+CjkBreakEngine::divideUpDictionaryRange( UText *inText,
+        int32_t rangeStart,
+        int32_t rangeEnd,
+        UVector32 &foundBreaks,
+        UBool isPhraseBreaking,
+        Scratch &scratch,
+        UErrorCode& status) const {
     // UnicodeString version of input UText, NFKC normalized if necessary.
-    UnicodeString inString;
+    // It aliases the UText chunk when possible, else it is a copy in scratch.input.
+    UnicodeString aliasedInput;
+    const UnicodeString *input = &aliasedInput;
 
     // inputMap[inStringIndex] = corresponding native index from UText inText.
     // If nullptr then mapping is 1:1
-    LocalPointer<UVector32>     inputMap;
+    UVector32 *inputMap = nullptr;
 
     // if UText has the input string as one contiguous UTF-16 chunk
     if ((inText->providerProperties & utext_i32_flag(UTEXT_PROVIDER_STABLE_CHUNKS)) &&
@@ -1157,9 +1245,9 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
 
         // Input UText is in one contiguous UTF-16 chunk.
         // Use Read-only aliasing UnicodeString.
-        inString.setTo(false,
-                       inText->chunkContents + rangeStart - inText->chunkNativeStart,
-                       rangeEnd - rangeStart);
+        aliasedInput.setTo(false,
+                           inText->chunkContents + rangeStart - inText->chunkNativeStart,
+                           rangeEnd - rangeStart);
     } else {
         // Copy the text from the original inText (UText) to inString (UnicodeString).
         // Create a map from UnicodeString indices -> UText offsets.
@@ -1169,34 +1257,45 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         if (limit > utext_nativeLength(inText)) {
             limit = static_cast<int32_t>(utext_nativeLength(inText));
         }
-        inputMap.adoptInsteadAndCheckErrorCode(new UVector32(status), status);
-        if (U_FAILURE(status)) {
-            return 0;
-        }
+        UnicodeString &copy = scratch.input;
+        copy.remove();
+        inputMap = &scratch.inputMap;
+        inputMap->removeAllElements();
         while (utext_getNativeIndex(inText) < limit) {
             int32_t nativePosition = static_cast<int32_t>(utext_getNativeIndex(inText));
             UChar32 c = utext_next32(inText);
             U_ASSERT(c != U_SENTINEL);
-            inString.append(c);
-            while (inputMap->size() < inString.length()) {
+            copy.append(c);
+            while (inputMap->size() < copy.length()) {
                 inputMap->addElement(nativePosition, status);
             }
         }
         inputMap->addElement(limit, status);
+        input = &copy;
     }
 
-
-    if (!nfkcNorm2->isNormalized(inString, status)) {
-        UnicodeString normalizedInput;
+    // Most text is already in NFKC. Normalize only the part after the
+    // longest prefix that passes the quick check, which ends on a
+    // normalization boundary.
+    int32_t normalizedPrefixLength = nfkcNorm2->spanQuickCheckYes(*input, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (normalizedPrefixLength < input->length()) {
+        const UnicodeString &inString = *input;
+        UnicodeString &normalizedInput = scratch.normalizedInput;
         //  normalizedMap[normalizedInput position] ==  original UText position.
-        LocalPointer<UVector32> normalizedMap(new UVector32(status), status);
-        if (U_FAILURE(status)) {
-            return 0;
+        UVector32 *normalizedMap = &scratch.normalizedMap;
+        normalizedInput.setTo(inString, 0, normalizedPrefixLength);
+        normalizedMap->removeAllElements();
+        for (int32_t i = 0; i < normalizedPrefixLength; i++) {
+            normalizedMap->addElement(inputMap != nullptr ? inputMap->elementAti(i) : i+rangeStart,
+                                      status);
         }
-        
-        UnicodeString fragment;
-        UnicodeString normalizedFragment;
-        for (int32_t srcI = 0; srcI < inString.length();) {  // Once per normalization chunk
+
+        UnicodeString &fragment = scratch.fragment;
+        UnicodeString &normalizedFragment = scratch.normalizedFragment;
+        for (int32_t srcI = normalizedPrefixLength; srcI < inString.length();) {  // Once per normalization chunk
             fragment.remove();
             int32_t fragmentStartI = srcI;
             UChar32 c = inString.char32At(srcI);
@@ -1216,7 +1315,7 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
 
             // Map every position in the normalized chunk to the start of the chunk
             //   in the original input.
-            int32_t fragmentOriginalStart = inputMap.isValid() ?
+            int32_t fragmentOriginalStart = inputMap != nullptr ?
                     inputMap->elementAti(fragmentStartI) : fragmentStartI+rangeStart;
             while (normalizedMap->size() < normalizedInput.length()) {
                 normalizedMap->addElement(fragmentOriginalStart, status);
@@ -1226,13 +1325,17 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
             }
         }
         U_ASSERT(normalizedMap->size() == normalizedInput.length());
-        int32_t nativeEnd = inputMap.isValid() ?
+        int32_t nativeEnd = inputMap != nullptr ?
                 inputMap->elementAti(inString.length()) : inString.length()+rangeStart;
         normalizedMap->addElement(nativeEnd, status);
 
-        inputMap = std::move(normalizedMap);
-        inString = std::move(normalizedInput);
+        inputMap = normalizedMap;
+        input = &normalizedInput;
     }
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    const UnicodeString &inString = *input;
 
     int32_t numCodePts = inString.countChar32();
     if (numCodePts != inString.length()) {
@@ -1241,12 +1344,10 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         //   not in terms of code unit string indexes.
         // Use the inputMap mechanism to take care of this in addition to indexing differences
         //    from normalization and/or UTF-8 input.
-        UBool hadExistingMap = inputMap.isValid();
+        UBool hadExistingMap = inputMap != nullptr;
         if (!hadExistingMap) {
-            inputMap.adoptInsteadAndCheckErrorCode(new UVector32(status), status);
-            if (U_FAILURE(status)) {
-                return 0;
-            }
+            inputMap = &scratch.inputMap;
+            inputMap->removeAllElements();
         }
         int32_t cpIdx = 0;
         for (int32_t cuIdx = 0; ; cuIdx = inString.moveIndex32(cuIdx, 1)) {
@@ -1273,28 +1374,26 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
 
     // bestSnlp[i] is the snlp of the best segmentation of the first i
     // code points in the range to be matched.
-    UVector32 bestSnlp(numCodePts + 1, status);
-    bestSnlp.addElement(0, status);
-    for(int32_t i = 1; i <= numCodePts; i++) {
-        bestSnlp.addElement(kuint32max, status);
-    }
-
+    UVector32 &bestSnlp = scratch.bestSnlp;
+    resetVector(bestSnlp, numCodePts + 1, kuint32max, status);
+    bestSnlp.setElementAt(0, 0);
 
     // prev[i] is the index of the last CJK code point in the previous word in 
     // the best segmentation of the first i characters.
-    UVector32 prev(numCodePts + 1, status);
-    for(int32_t i = 0; i <= numCodePts; i++){
-        prev.addElement(-1, status);
-    }
+    UVector32 &prev = scratch.prev;
+    resetVector(prev, numCodePts + 1, -1, status);
 
     const int32_t maxWordSize = 20;
-    UVector32 values(numCodePts, status);
-    values.setSize(numCodePts);
-    UVector32 lengths(numCodePts, status);
-    lengths.setSize(numCodePts);
+    UVector32 &values = scratch.values;
+    resetVector(values, numCodePts, 0, status);
+    UVector32 &lengths = scratch.lengths;
+    resetVector(lengths, numCodePts, 0, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
 
     UText fu = UTEXT_INITIALIZER;
-    utext_openUnicodeString(&fu, &inString, &status);
+    utext_openConstUnicodeString(&fu, &inString, &status);
 
     // Dynamic programming to find the best segmentation.
 
@@ -1367,7 +1466,8 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     // prev[numCodePts] is guaranteed to be meaningful.
     // We'll first push in the reverse order, i.e.,
     // t_boundary[0] = numCodePts, and afterwards do a swap.
-    UVector32 t_boundary(numCodePts+1, status);
+    UVector32 &t_boundary = scratch.t_boundary;
+    t_boundary.removeAllElements();
 
     int32_t numBreaks = 0;
     // No segmentation found, set boundary to end of range
@@ -1423,7 +1523,7 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     for (int32_t i = numBreaks - 1; i >= 0; i--) {
         int32_t cpPos = t_boundary.elementAti(i);
         U_ASSERT(cpPos > prevCPPos);
-        int32_t utextPos =  inputMap.isValid() ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
+        int32_t utextPos =  inputMap != nullptr ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
         U_ASSERT(utextPos >= prevUTextPos);
         if (utextPos > prevUTextPos) {
             // Boundaries are added to foundBreaks output in ascending order.
@@ -1466,8 +1566,6 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         }
     }
 
-    // inString goes out of scope
-    // inputMap goes out of scope
     return correctedNumBreaks;
 }
 
@@ -10,6 +10,8 @@
 #ifndef DICTBE_H
 #define DICTBE_H
 
+#include <atomic>
+
 #include "unicode/utypes.h"
 #include "unicode/uniset.h"
 #include "unicode/utext.h"
@@ -390,6 +392,20 @@ class CjkBreakEngine : public DictionaryBreakEngine {
 
   Hashtable fSkipSet;
 
+  // Buffers for divideUpDictionaryRange(), kept between calls so that
+  // segmenting does not allocate in steady state. See dictbe.cpp.
+  struct Scratch;
+  mutable std::atomic<Scratch *> fScratch;
+  Scratch *acquireScratch(UErrorCode &status) const;
+  void releaseScratch(Scratch *scratch, int32_t rangeLength) const;
+  int32_t divideUpDictionaryRange( UText *text,
+          int32_t rangeStart,
+          int32_t rangeEnd,
+          UVector32 &foundBreaks,
+          UBool isPhraseBreaking,
+          Scratch &scratch,
+          UErrorCode& status) const;
+
  public:
 
     /**
@@ -33,57 +33,15 @@ U_NAMESPACE_BEGIN
 // #define LSTM_VECTORIZER_DEBUG 1
 
 /**
- * Interface for reading 1D array.
+ * A read-only view of a float array as a 1D Array, without owning the pointer
+ * or copying the data.
  */
-class ReadArray1D {
-public:
-    virtual ~ReadArray1D();
-    virtual int32_t d1() const = 0;
-    virtual float get(int32_t i) const = 0;
-
-#ifdef LSTM_DEBUG
-    void print() const {
-        printf("\n[");
-        for (int32_t i = 0; i < d1(); i++) {
-           printf("%0.8e ", get(i));
-           if (i % 4 == 3) printf("\n");
-        }
-        printf("]\n");
-    }
-#endif
-};
-
-ReadArray1D::~ReadArray1D()
-{
-}
-
-/**
- * Interface for reading 2D array.
- */
-class ReadArray2D {
-public:
-    virtual ~ReadArray2D();
-    virtual int32_t d1() const = 0;
-    virtual int32_t d2() const = 0;
-    virtual float get(int32_t i, int32_t j) const = 0;
-};
-
-ReadArray2D::~ReadArray2D()
-{
-}
-
-/**
- * A class to index a float array as a 1D Array without owning the pointer or
- * copy the data.
- */
-class ConstArray1D : public ReadArray1D {
+class ConstArray1D {
 public:
     ConstArray1D() : data_(nullptr), d1_(0) {}
 
     ConstArray1D(const float* data, int32_t d1) : data_(data), d1_(d1) {}
 
-    virtual ~ConstArray1D();
-
     // Init the object, the object does not own the data nor copy.
     // It is designed to directly use data from memory mapped resources.
     void init(const int32_t* data, int32_t d1) {
@@ -92,35 +50,33 @@ class ConstArray1D : public ReadArray1D {
         d1_ = d1;
     }
 
-    // ReadArray1D methods.
-    virtual int32_t d1() const override { return d1_; }
-    virtual float get(int32_t i) const override {
-        U_ASSERT(i < d1_);
-        return data_[i];
+    inline int32_t d1() const { return d1_; }
+    inline const float* data() const { return data_; }
+
+#ifdef LSTM_DEBUG
+    void print() const {
+        printf("\n[");
+        for (int32_t i = 0; i < d1_; i++) {
+           printf("%0.8e ", data_[i]);
+           if (i % 4 == 3) printf("\n");
+        }
+        printf("]\n");
     }
+#endif
 
 private:
     const float* data_;
     int32_t d1_;
 };
 
-ConstArray1D::~ConstArray1D()
-{
-}
-
 /**
- * A class to index a float array as a 2D Array without owning the pointer or
- * copy the data.
+ * A read-only view of a row-major float array as a 2D Array, without owning
+ * the pointer or copying the data.
  */
-class ConstArray2D : public ReadArray2D {
+class ConstArray2D {
 public:
     ConstArray2D() : data_(nullptr), d1_(0), d2_(0) {}
 
-    ConstArray2D(const float* data, int32_t d1, int32_t d2)
-        : data_(data), d1_(d1), d2_(d2) {}
-
-    virtual ~ConstArray2D();
-
     // Init the object, the object does not own the data nor copy.
     // It is designed to directly use data from memory mapped resources.
     void init(const int32_t* data, int32_t d1, int32_t d2) {
@@ -130,14 +86,9 @@ class ConstArray2D : public ReadArray2D {
         d2_ = d2;
     }
 
-    // ReadArray2D methods.
-    inline int32_t d1() const override { return d1_; }
-    inline int32_t d2() const override { return d2_; }
-    float get(int32_t i, int32_t j) const override {
-        U_ASSERT(i < d1_);
-        U_ASSERT(j < d2_);
-        return data_[i * d2_ + j];
-    }
+    inline int32_t d1() const { return d1_; }
+    inline int32_t d2() const { return d2_; }
+    inline const float* data() const { return data_; }
 
     // Expose the ith row as a ConstArray1D
     inline ConstArray1D row(int32_t i) const {
@@ -151,196 +102,144 @@ class ConstArray2D : public ReadArray2D {
     int32_t d2_;
 };
 
-ConstArray2D::~ConstArray2D()
-{
-}
-
-/**
- * A class to allocate data as a writable 1D array.
- * This is the main class implement matrix operation.
- */
-class Array1D : public ReadArray1D {
-public:
-    Array1D() : memory_(nullptr), data_(nullptr), d1_(0) {}
-    Array1D(int32_t d1, UErrorCode &status)
-        : memory_(uprv_malloc(d1 * sizeof(float))),
-          data_(static_cast<float*>(memory_)), d1_(d1) {
-        if (U_SUCCESS(status)) {
-            if (memory_ == nullptr) {
-                status = U_MEMORY_ALLOCATION_ERROR;
-                return;
-            }
-            clear();
+// The kernels below work on plain contiguous float arrays. The loops have
+// unit stride and no calls in their bodies, so that compilers can turn them
+// into SIMD code.
+
+// y += x * W, where x has W.d1() elements and y has W.d2() elements.
+// W is traversed row by row (y += x[j] * W[j]), which keeps the inner loop
+// contiguous and accumulates every y[i] in the same order as the textbook
+// column-wise dot product.
+static inline void addDotProduct(const float* x, const ConstArray2D& W, float* y) {
+    const int32_t rows = W.d1();
+    const int32_t cols = W.d2();
+    const float* w = W.data();
+    for (int32_t j = 0; j < rows; j++, w += cols) {
+        const float xj = x[j];
+        for (int32_t i = 0; i < cols; i++) {
+            y[i] += xj * w[i];
         }
     }
+}
 
-    virtual ~Array1D();
-
-    // A special constructor which does not own the memory but writeable
-    // as a slice of an array.
-    Array1D(float* data, int32_t d1)
-        : memory_(nullptr), data_(data), d1_(d1) {}
-
-    // ReadArray1D methods.
-    virtual int32_t d1() const override { return d1_; }
-    virtual float get(int32_t i) const override {
-        U_ASSERT(i < d1_);
-        return data_[i];
-    }
-
-    // Return the index which point to the max data in the array.
-    inline int32_t maxIndex() const {
-        int32_t index = 0;
-        float max = data_[0];
-        for (int32_t i = 1; i < d1_; i++) {
-            if (data_[i] > max) {
-                max = data_[i];
-                index = i;
-            }
-        }
-        return index;
-    }
-
-    // Slice part of the array to a new one.
-    inline Array1D slice(int32_t from, int32_t size) const {
-        U_ASSERT(from >= 0);
-        U_ASSERT(from < d1_);
-        U_ASSERT(from + size <= d1_);
-        return Array1D(data_ + from, size);
-    }
-
-    // Add dot product of a 1D array and a 2D array into this one.
-    inline Array1D& addDotProduct(const ReadArray1D& a, const ReadArray2D& b) {
-        U_ASSERT(a.d1() == b.d1());
-        U_ASSERT(b.d2() == d1());
-        for (int32_t i = 0; i < d1(); i++) {
-            for (int32_t j = 0; j < a.d1(); j++) {
-                data_[i] += a.get(j) * b.get(j, i);
-            }
-        }
-        return *this;
-    }
-
-    // Hadamard Product the values of another array of the same size into this one.
-    inline Array1D& hadamardProduct(const ReadArray1D& a) {
-        U_ASSERT(a.d1() == d1());
-        for (int32_t i = 0; i < d1(); i++) {
-            data_[i] *= a.get(i);
-        }
-        return *this;
-    }
+static inline float sigmoid(float x) {
+    return 1.0f/(1.0f + expf(-x));
+}
 
-    // Add the Hadamard Product of two arrays of the same size into this one.
-    inline Array1D& addHadamardProduct(const ReadArray1D& a, const ReadArray1D& b) {
-        U_ASSERT(a.d1() == d1());
-        U_ASSERT(b.d1() == d1());
-        for (int32_t i = 0; i < d1(); i++) {
-            data_[i] += a.get(i) * b.get(i);
-        }
-        return *this;
-    }
+// Rational approximation of tanh, accurate to about 3e-8 in absolute terms.
+// Unlike std::tanh() it has no calls or branches, so loops over it vectorize.
+// Quantized models use it, since they trade exactness for speed anyway.
+static inline float fastTanh(float x) {
+    // tanh(x) rounds to +/-1 in single precision outside of [-9, 9].
+    x = x < -9.0f ? -9.0f : (x > 9.0f ? 9.0f : x);
+    const float x2 = x * x;
+    float p = -2.76076847742355e-16f;
+    p = p * x2 + 2.00018790482477e-13f;
+    p = p * x2 - 8.60467152213735e-11f;
+    p = p * x2 + 5.12229709037114e-08f;
+    p = p * x2 + 1.48572235717979e-05f;
+    p = p * x2 + 6.37261928875436e-04f;
+    p = p * x2 + 4.89352455891786e-03f;
+    float q = 1.19825839466702e-06f;
+    q = q * x2 + 1.18534705686654e-04f;
+    q = q * x2 + 2.26843463243900e-03f;
+    q = q * x2 + 4.89352518554385e-03f;
+    return x * p / q;
+}
 
-    // Add the values of another array of the same size into this one.
-    inline Array1D& add(const ReadArray1D& a) {
-        U_ASSERT(a.d1() == d1());
-        for (int32_t i = 0; i < d1(); i++) {
-            data_[i] += a.get(i);
-        }
-        return *this;
-    }
+static inline float fastSigmoid(float x) {
+    return 0.5f + 0.5f * fastTanh(0.5f * x);
+}
 
-    // Assign the values of another array of the same size into this one.
-    inline Array1D& assign(const ReadArray1D& a) {
-        U_ASSERT(a.d1() == d1());
-        for (int32_t i = 0; i < d1(); i++) {
-            data_[i] = a.get(i);
+// Return the index which point to the max data in the array.
+static inline int32_t maxIndex(const float* data, int32_t length) {
+    int32_t index = 0;
+    float max = data[0];
+    for (int32_t i = 1; i < length; i++) {
+        if (data[i] > max) {
+            max = data[i];
+            index = i;
         }
-        return *this;
     }
+    return index;
+}
 
-    // Apply tanh to all the elements in the array.
-    inline Array1D& tanh() {
-        return tanh(*this);
-    }
+/**
+ * A read-only view of a row-major int8 matrix with one float scale per row
+ * (for the embedding table) or per column (for the weight matrices, so that
+ * each output unit has its own scale), as stored in quantized models.
+ */
+class ConstQuantizedArray2D {
+public:
+    ConstQuantizedArray2D() : data_(nullptr), scales_(nullptr), d1_(0), d2_(0) {}
 
-    // Apply tanh of a and store into this array.
-    inline Array1D& tanh(const Array1D& a) {
-        U_ASSERT(a.d1() == d1());
-        for (int32_t i = 0; i < d1_; i++) {
-            data_[i] = std::tanh(a.get(i));
-        }
-        return *this;
+    // Init the object, the object does not own the data nor copy.
+    void init(const int8_t* data, const int32_t* scales, int32_t d1, int32_t d2) {
+        U_ASSERT(IEEE_754 == 1);
+        data_ = data;
+        scales_ = reinterpret_cast<const float*>(scales);
+        d1_ = d1;
+        d2_ = d2;
     }
 
-    // Apply sigmoid to all the elements in the array.
-    inline Array1D& sigmoid() {
-        for (int32_t i = 0; i < d1_; i++) {
-            data_[i] = 1.0f/(1.0f + expf(-data_[i]));
-        }
-        return *this;
-    }
+    inline int32_t d1() const { return d1_; }
+    inline int32_t d2() const { return d2_; }
+    inline const int8_t* data() const { return data_; }
+    inline const float* scales() const { return scales_; }
 
-    inline Array1D& clear() {
-        uprv_memset(data_, 0, d1_ * sizeof(float));
-        return *this;
+    inline const int8_t* row(int32_t i) const {
+        U_ASSERT(i < d1_);
+        return data_ + i * d2_;
     }
 
 private:
-    void* memory_;
-    float* data_;
+    const int8_t* data_;
+    const float* scales_;
     int32_t d1_;
+    int32_t d2_;
 };
 
-Array1D::~Array1D()
-{
-    uprv_free(memory_);
-}
-
-class Array2D : public ReadArray2D {
-public:
-    Array2D() : memory_(nullptr), data_(nullptr), d1_(0), d2_(0) {}
-    Array2D(int32_t d1, int32_t d2, UErrorCode &status)
-        : memory_(uprv_malloc(d1 * d2 * sizeof(float))),
-          data_(static_cast<float*>(memory_)), d1_(d1), d2_(d2) {
-        if (U_SUCCESS(status)) {
-            if (memory_ == nullptr) {
-                status = U_MEMORY_ALLOCATION_ERROR;
-                return;
-            }
-            clear();
-        }
+// Quantize x symmetrically to int8 values in q and return the scale,
+// so that x[i] is approximately scale * q[i].
+static inline float quantize(const float* x, int32_t length, int8_t* q) {
+    float peak = 0.0f;
+    for (int32_t i = 0; i < length; i++) {
+        float a = x[i] < 0 ? -x[i] : x[i];
+        peak = a > peak ? a : peak;
     }
-    virtual ~Array2D();
-
-    // ReadArray2D methods.
-    virtual int32_t d1() const override { return d1_; }
-    virtual int32_t d2() const override { return d2_; }
-    virtual float get(int32_t i, int32_t j) const override {
-        U_ASSERT(i < d1_);
-        U_ASSERT(j < d2_);
-        return data_[i * d2_ + j];
+    if (peak == 0.0f) {
+        uprv_memset(q, 0, length);
+        return 0.0f;
     }
-
-    inline Array1D row(int32_t i) const {
-        U_ASSERT(i < d1_);
-        return Array1D(data_ + i * d2_, d2_);
+    const float inverse = 127.0f / peak;
+    for (int32_t i = 0; i < length; i++) {
+        float v = x[i] * inverse;
+        q[i] = static_cast<int8_t>(v < 0 ? v - 0.5f : v + 0.5f);
     }
+    return peak / 127.0f;
+}
 
-    inline Array2D& clear() {
-        uprv_memset(data_, 0, d1_ * d2_ * sizeof(float));
-        return *this;
+// y += xScale * (xq * W), where W has one scale per column.
+// The products are summed in integer arithmetic in acc, which holds W.d2()
+// values. Each int8 product fits into 16 bits and the inner loop has unit
+// stride like the float addDotProduct() above, so that compilers can use
+// 16-bit SIMD multiplies.
+static inline void addDotProduct(const int8_t* xq, float xScale, const ConstQuantizedArray2D& W,
+                                 int32_t* acc, float* y) {
+    const int32_t rows = W.d1();
+    const int32_t cols = W.d2();
+    const int8_t* w = W.data();
+    uprv_memset(acc, 0, cols * sizeof(int32_t));
+    for (int32_t j = 0; j < rows; j++, w += cols) {
+        const int16_t xj = xq[j];
+        for (int32_t i = 0; i < cols; i++) {
+            acc[i] += static_cast<int16_t>(xj * w[i]);
+        }
+    }
+    const float* scales = W.scales();
+    for (int32_t i = 0; i < cols; i++) {
+        y[i] += xScale * scales[i] * static_cast<float>(acc[i]);
     }
-
-private:
-    void* memory_;
-    float* data_;
-    int32_t d1_;
-    int32_t d2_;
-};
-
-Array2D::~Array2D()
-{
-    uprv_free(memory_);
 }
 
 typedef enum {
@@ -359,9 +258,32 @@ typedef enum {
 struct LSTMData : public UMemory {
     LSTMData(UResourceBundle* rb, UErrorCode &status);
     ~LSTMData();
+
+    // Run one time step of the forward or backward LSTM on the embedding
+    // of the given dictionary index, updating h and c in place.
+    // ifco holds 4 * fHunits floats. Only quantized models use q, which
+    // holds 2 * fHunits values, and acc, which holds 4 * fHunits values.
+    void step(UBool forward, int32_t index, float* h, float* c,
+              float* ifco, int8_t* q, int32_t* acc) const;
+    // Compute the 4 output values from the concatenated forward and
+    // backward hidden states in fbRow.
+    void output(const float* fbRow, float* logp, int8_t* q, int32_t* acc) const;
+
     UHashtable* fDict;
     EmbeddingType fType;
     const char16_t* fName;
+    int32_t fHunits;
+    // Quantized models store the matrices below in int8 instead of in the
+    // ConstArray2D members, with the same shapes. The embedding table has one
+    // scale per row, the other matrices one scale per column (output unit).
+    // The biases are float32 in both formats.
+    UBool fQuantized;
+    ConstQuantizedArray2D fQEmbedding;
+    ConstQuantizedArray2D fQForwardW;
+    ConstQuantizedArray2D fQForwardU;
+    ConstQuantizedArray2D fQBackwardW;
+    ConstQuantizedArray2D fQBackwardU;
+    ConstQuantizedArray2D fQOutputW;
     ConstArray2D fEmbedding;
     ConstArray2D fForwardW;
     ConstArray2D fForwardU;
@@ -373,11 +295,14 @@ struct LSTMData : public UMemory {
     ConstArray1D fOutputB;
 
 private:
+    void initQuantized(UResourceBundle* rb, int32_t num_index, int32_t embedding_size,
+                       int32_t hunits, const int32_t* data, int32_t data_len, UErrorCode &status);
+
     UResourceBundle* fBundle;
 };
 
 LSTMData::LSTMData(UResourceBundle* rb, UErrorCode &status)
-    : fDict(nullptr), fType(UNKNOWN), fName(nullptr),
+    : fDict(nullptr), fType(UNKNOWN), fName(nullptr), fHunits(0), fQuantized(false),
       fBundle(rb)
 {
     if (U_FAILURE(status)) {
@@ -394,6 +319,7 @@ LSTMData::LSTMData(UResourceBundle* rb, UErrorCode &status)
         ures_getByKey(rb, "hunits", nullptr, &status));
     if (U_FAILURE(status)) return;
     int32_t hunits = ures_getInt(hunits_res.getAlias(), &status);
+    fHunits = hunits;
     const char16_t* type = ures_getStringByKey(rb, "type", nullptr, &status);
     if (U_FAILURE(status)) return;
     if (u_strCompare(type, -1, u"codepoints", -1, false) == 0) {
@@ -431,6 +357,18 @@ LSTMData::LSTMData(UResourceBundle* rb, UErrorCode &status)
         printf("] map to %d\n", idx-1);
 #endif
     }
+    UErrorCode quantizationStatus = U_ZERO_ERROR;
+    const char16_t* quantization = ures_getStringByKey(rb, "quantization", nullptr, &quantizationStatus);
+    if (U_SUCCESS(quantizationStatus)) {
+        if (u_strCompare(quantization, -1, u"int8", -1, false) != 0) {
+            status = U_UNSUPPORTED_ERROR;
+            return;
+        }
+        fQuantized = true;
+        initQuantized(rb, num_index, embedding_size, hunits, data, data_len, status);
+        return;
+    }
+
     int32_t mat1_size = (num_index + 1) * embedding_size;
     int32_t mat2_size = embedding_size * 4 * hunits;
     int32_t mat3_size = hunits * 4 * hunits;
@@ -464,6 +402,50 @@ LSTMData::LSTMData(UResourceBundle* rb, UErrorCode &status)
     fOutputB.init(data, 4);
 }
 
+// Quantized models keep the int8 matrices in the "weights" binary and the
+// scales, interleaved with the float32 biases, in "data".
+// See python/icutools/lstm/quantize.py, which creates them.
+void LSTMData::initQuantized(UResourceBundle* rb, int32_t num_index, int32_t embedding_size,
+                             int32_t hunits, const int32_t* data, int32_t data_len,
+                             UErrorCode &status) {
+    LocalUResourceBundlePointer weightsRes(ures_getByKey(rb, "weights", nullptr, &status));
+    int32_t weights_len = 0;
+    const int8_t* weights = reinterpret_cast<const int8_t*>(
+        ures_getBinary(weightsRes.getAlias(), &weights_len, &status));
+    if (U_FAILURE(status)) return;
+
+    int32_t embedding_rows = num_index + 1;
+    if (weights_len != embedding_rows * embedding_size + 2 * 4 * hunits * (embedding_size + hunits) +
+            4 * 2 * hunits ||
+        data_len != embedding_rows + 6 * 4 * hunits + 2 * 4) {
+        status = U_INVALID_FORMAT_ERROR;
+        return;
+    }
+
+    fQEmbedding.init(weights, data, embedding_rows, embedding_size);
+    weights += embedding_rows * embedding_size;
+    data += embedding_rows;
+    fQForwardW.init(weights, data, embedding_size, 4 * hunits);
+    weights += 4 * hunits * embedding_size;
+    data += 4 * hunits;
+    fQForwardU.init(weights, data, hunits, 4 * hunits);
+    weights += 4 * hunits * hunits;
+    data += 4 * hunits;
+    fForwardB.init(data, 4 * hunits);
+    data += 4 * hunits;
+    fQBackwardW.init(weights, data, embedding_size, 4 * hunits);
+    weights += 4 * hunits * embedding_size;
+    data += 4 * hunits;
+    fQBackwardU.init(weights, data, hunits, 4 * hunits);
+    weights += 4 * hunits * hunits;
+    data += 4 * hunits;
+    fBackwardB.init(data, 4 * hunits);
+    data += 4 * hunits;
+    fQOutputW.init(weights, data, 2 * hunits, 4);
+    data += 4;
+    fOutputB.init(data, 4);
+}
+
 LSTMData::~LSTMData() {
     uhash_close(fDict);
     ures_close(fBundle);
@@ -540,14 +522,19 @@ void CodePointsVectorizer::vectorize(
 
 class GraphemeClusterVectorizer : public Vectorizer {
 public:
-    GraphemeClusterVectorizer(UHashtable* dict)
-        : Vectorizer(dict)
+    GraphemeClusterVectorizer(UHashtable* dict, UErrorCode &status)
+        : Vectorizer(dict),
+          fGraphemeIter(BreakIterator::createCharacterInstance(Locale(), status))
     {
     }
     virtual ~GraphemeClusterVectorizer();
     virtual void vectorize(UText *text, int32_t startPos, int32_t endPos,
                            UVector32 &offsets, UVector32 &indices,
                            UErrorCode &status) const override;
+private:
+    // Cloned for each call; cloning shares the rule data and is much cheaper
+    // than going through the BreakIterator factory every time.
+    LocalPointer<BreakIterator> fGraphemeIter;
 };
 
 GraphemeClusterVectorizer::~GraphemeClusterVectorizer()
@@ -566,7 +553,7 @@ void GraphemeClusterVectorizer::vectorize(
         return;
     }
     if (U_FAILURE(status)) return;
-    LocalPointer<BreakIterator> graphemeIter(BreakIterator::createCharacterInstance(Locale(), status));
+    LocalPointer<BreakIterator> graphemeIter(fGraphemeIter->clone(), status);
     if (U_FAILURE(status)) return;
     graphemeIter->setText(text, status);
     if (U_FAILURE(status)) return;
@@ -600,32 +587,91 @@ void GraphemeClusterVectorizer::vectorize(
     }
 }
 
+// Apply the gate activations to ifco = [i, f, c_, o] and update the cell
+// state c and the hidden state h in a single pass over the units.
+static inline void applyGates(int32_t hunits, const float* ifco, float* h, float* c) {
+    const float* iGate = ifco;
+    const float* fGate = ifco + hunits;
+    const float* cGate = ifco + 2 * hunits;
+    const float* oGate = ifco + 3 * hunits;
+    for (int32_t k = 0; k < hunits; k++) {
+        c[k] = c[k] * sigmoid(fGate[k]) + sigmoid(iGate[k]) * std::tanh(cGate[k]);
+        h[k] = std::tanh(c[k]) * sigmoid(oGate[k]);
+    }
+}
+
+// Same as applyGates() with the approximated activation functions.
+static inline void applyFastGates(int32_t hunits, const float* ifco, float* h, float* c) {
+    const float* iGate = ifco;
+    const float* fGate = ifco + hunits;
+    const float* cGate = ifco + 2 * hunits;
+    const float* oGate = ifco + 3 * hunits;
+    for (int32_t k = 0; k < hunits; k++) {
+        c[k] = c[k] * fastSigmoid(fGate[k]) + fastSigmoid(iGate[k]) * fastTanh(cGate[k]);
+        h[k] = fastTanh(c[k]) * fastSigmoid(oGate[k]);
+    }
+}
+
 // Computing LSTM as stated in
 // https://en.wikipedia.org/wiki/Long_short-term_memory#LSTM_with_a_forget_gate
-// ifco is temp array allocate outside which does not need to be
-// input/output value but could avoid unnecessary memory alloc/free if passing
-// in.
-void compute(
+// h and c hold hunits values each and are updated in place.
+// ifco is a scratch array of 4 * hunits values allocated by the caller, so that
+// one buffer serves all the time steps of a call.
+static void compute(
     int32_t hunits,
-    const ReadArray2D& W, const ReadArray2D& U, const ReadArray1D& b,
-    const ReadArray1D& x, Array1D& h, Array1D& c,
-    Array1D& ifco)
+    const ConstArray2D& W, const ConstArray2D& U, const ConstArray1D& b,
+    const float* x, float* h, float* c,
+    float* ifco)
 {
     // ifco = x * W + h * U + b
-    ifco.assign(b)
-        .addDotProduct(x, W)
-        .addDotProduct(h, U);
+    uprv_memcpy(ifco, b.data(), 4 * hunits * sizeof(float));
+    addDotProduct(x, W, ifco);
+    addDotProduct(h, U, ifco);
+    applyGates(hunits, ifco, h, c);
+}
 
-    ifco.slice(0*hunits, hunits).sigmoid();  // i: sigmod
-    ifco.slice(1*hunits, hunits).sigmoid(); // f: sigmoid
-    ifco.slice(2*hunits, hunits).tanh(); // c_: tanh
-    ifco.slice(3*hunits, hunits).sigmoid(); // o: sigmod
+// Same as above for a quantized model. The input x is given as int8 values
+// with a scale; h is quantized into hq before the recurrent product.
+static void compute(
+    int32_t hunits,
+    const ConstQuantizedArray2D& W, const ConstQuantizedArray2D& U, const ConstArray1D& b,
+    const int8_t* xq, float xScale, float* h, float* c,
+    float* ifco, int8_t* hq, int32_t* acc)
+{
+    uprv_memcpy(ifco, b.data(), 4 * hunits * sizeof(float));
+    addDotProduct(xq, xScale, W, acc, ifco);
+    float hScale = quantize(h, hunits, hq);
+    addDotProduct(hq, hScale, U, acc, ifco);
+    applyFastGates(hunits, ifco, h, c);
+}
 
-    c.hadamardProduct(ifco.slice(hunits, hunits))
-        .addHadamardProduct(ifco.slice(0, hunits), ifco.slice(2*hunits, hunits));
+void LSTMData::step(UBool forward, int32_t index, float* h, float* c,
+                    float* ifco, int8_t* q, int32_t* acc) const {
+    if (fQuantized) {
+        compute(fHunits,
+                forward ? fQForwardW : fQBackwardW,
+                forward ? fQForwardU : fQBackwardU,
+                forward ? fForwardB : fBackwardB,
+                fQEmbedding.row(index), fQEmbedding.scales()[index],
+                h, c, ifco, q, acc);
+    } else {
+        compute(fHunits,
+                forward ? fForwardW : fBackwardW,
+                forward ? fForwardU : fBackwardU,
+                forward ? fForwardB : fBackwardB,
+                fEmbedding.row(index).data(),
+                h, c, ifco);
+    }
+}
 
-    h.tanh(c)
-        .hadamardProduct(ifco.slice(3*hunits, hunits));
+void LSTMData::output(const float* fbRow, float* logp, int8_t* q, int32_t* acc) const {
+    uprv_memcpy(logp, fOutputB.data(), 4 * sizeof(float));
+    if (fQuantized) {
+        float scale = quantize(fbRow, 2 * fHunits, q);
+        addDotProduct(q, scale, fQOutputW, acc, logp);
+    } else {
+        addDotProduct(fbRow, fOutputW, logp);
+    }
 }
 
 // Minimum word size
@@ -659,81 +705,89 @@ LSTMBreakEngine::divideUpDictionaryRange( UText *text,
     int32_t* indicesBuf = indices.getBuffer();
 
     int32_t input_seq_len = indices.size();
-    int32_t hunits = fData->fForwardU.d1();
-
-    // ----- Begin of all the Array memory allocation needed for this function
-    // Allocate temp array used inside compute()
-    Array1D ifco(4 * hunits, status);
-
-    Array1D c(hunits, status);
-    Array1D logp(4, status);
-
+    if (input_seq_len == 0) return 0;
+    int32_t hunits = fData->fHunits;
+
+    // All the scratch memory needed for this function comes from one
+    // allocation, which stays on the stack for short runs:
+    //   ifco      4 * hunits   gate values inside compute()
+    //   c         hunits       cell state
+    //   fbRow     2 * hunits   forward and backward hidden state of one step
+    //   logp      4            output layer
+    //   hBackward input_seq_len * hunits
     // TODO: limit size of hBackward. If input_seq_len is too big, we could
     // run out of memory.
-    // Backward LSTM
-    Array2D hBackward(input_seq_len, hunits, status);
-
-    // Allocate fbRow and slice the internal array in two.
-    Array1D fbRow(2 * hunits, status);
-
-    // ----- End of all the Array memory allocation needed for this function
-    if (U_FAILURE(status)) return 0;
+    MaybeStackArray<float, 1024> scratch;
+    int32_t scratchSize = (7 + input_seq_len) * hunits + 4;
+    if (scratch.resize(scratchSize) == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    float* ifco = scratch.getAlias();
+    float* c = ifco + 4 * hunits;
+    float* fbRow = c + hunits;
+    float* logp = fbRow + 2 * hunits;
+    float* hBackward = logp + 4;
+    // Quantized models also need int8 copies of the hidden states and
+    // integer accumulators.
+    MaybeStackArray<int8_t, 256> q;
+    MaybeStackArray<int32_t, 512> acc;
+    if (fData->fQuantized &&
+            (q.resize(2 * hunits) == nullptr || acc.resize(4 * hunits) == nullptr)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    uprv_memset(c, 0, hunits * sizeof(float));
+    uprv_memset(hBackward + (input_seq_len - 1) * hunits, 0, hunits * sizeof(float));
 
     // To save the needed memory usage, the following is different from the
     // Python or ICU4X implementation. We first perform the Backward LSTM
     // and then merge the iteration of the forward LSTM and the output layer
     // together because we only neetdto remember the h[t-1] for Forward LSTM.
     for (int32_t i = input_seq_len - 1; i >= 0; i--) {
-        Array1D hRow = hBackward.row(i);
+        float* hRow = hBackward + i * hunits;
         if (i != input_seq_len - 1) {
-            hRow.assign(hBackward.row(i+1));
+            uprv_memcpy(hRow, hRow + hunits, hunits * sizeof(float));
         }
 #ifdef LSTM_DEBUG
         printf("hRow %d\n", i);
-        hRow.print();
+        ConstArray1D(hRow, hunits).print();
         printf("indicesBuf[%d] = %d\n", i, indicesBuf[i]);
-        printf("fData->fEmbedding.row(indicesBuf[%d]):\n", i);
-        fData->fEmbedding.row(indicesBuf[i]).print();
 #endif  // LSTM_DEBUG
-        compute(hunits,
-                fData->fBackwardW, fData->fBackwardU, fData->fBackwardB,
-                fData->fEmbedding.row(indicesBuf[i]),
-                hRow, c, ifco);
+        fData->step(false, indicesBuf[i], hRow, c, ifco, q.getAlias(), acc.getAlias());
     }
 
 
-    Array1D forwardRow = fbRow.slice(0, hunits);  // point to first half of data in fbRow.
-    Array1D backwardRow = fbRow.slice(hunits, hunits);  // point to second half of data n fbRow.
+    float* forwardRow = fbRow;  // point to first half of data in fbRow.
+    float* backwardRow = fbRow + hunits;  // point to second half of data n fbRow.
 
     // The following iteration merge the forward LSTM and the output layer
     // together.
-    c.clear();  // reuse c since it is the same size.
+    uprv_memset(forwardRow, 0, hunits * sizeof(float));
+    uprv_memset(c, 0, hunits * sizeof(float));  // reuse c since it is the same size.
     for (int32_t i = 0; i < input_seq_len; i++) {
 #ifdef LSTM_DEBUG
         printf("forwardRow %d\n", i);
-        forwardRow.print();
+        ConstArray1D(forwardRow, hunits).print();
 #endif  // LSTM_DEBUG
         // Forward LSTM
         // Calculate the result into forwardRow, which point to the data in the first half
         // of fbRow.
-        compute(hunits,
-                fData->fForwardW, fData->fForwardU, fData->fForwardB,
-                fData->fEmbedding.row(indicesBuf[i]),
-                forwardRow, c, ifco);
+        fData->step(true, indicesBuf[i], forwardRow, c, ifco, q.getAlias(), acc.getAlias());
 
         // assign the data from hBackward.row(i) to second half of fbRowa.
-        backwardRow.assign(hBackward.row(i));
+        uprv_memcpy(backwardRow, hBackward + i * hunits, hunits * sizeof(float));
 
-        logp.assign(fData->fOutputB).addDotProduct(fbRow, fData->fOutputW);
+        fData->output(fbRow, logp, q.getAlias(), acc.getAlias());
 #ifdef LSTM_DEBUG
         printf("backwardRow %d\n", i);
-        backwardRow.print();
+        ConstArray1D(backwardRow, hunits).print();
         printf("logp %d\n", i);
-        logp.print();
+        ConstArray1D(logp, 4).print();
 #endif  // LSTM_DEBUG
 
         // current = argmax(logp)
-        LSTMClass current = static_cast<LSTMClass>(logp.maxIndex());
+        LSTMClass current = static_cast<LSTMClass>(maxIndex(logp, 4));
         // BIES logic.
         if (current == BEGIN || current == SINGLE) {
             if (i != 0) {
@@ -753,9 +807,10 @@ Vectorizer* createVectorizer(const LSTMData* data, UErrorCode &status) {
         case CODE_POINTS:
             return new CodePointsVectorizer(data->fDict);
             break;
-        case GRAPHEME_CLUSTER:
-            return new GraphemeClusterVectorizer(data->fDict);
-            break;
+        case GRAPHEME_CLUSTER: {
+            LocalPointer<Vectorizer> vectorizer(new GraphemeClusterVectorizer(data->fDict, status), status);
+            return U_SUCCESS(status) ? vectorizer.orphan() : nullptr;
+        }
         default:
             break;
     }
@@ -15,15 +15,35 @@
 #include "uresimp.h"
 #include "util.h"
 #include "uvectr32.h"
+#include "uvectr64.h"
 
 U_NAMESPACE_BEGIN
 
-enum class ModelIndex { kUWStart = 0, kBWStart = 6, kTWStart = 9 };
+enum class ModelIndex { kUWStart = 0, kBWStart = 6, kTWStart = 9, kCount = 13 };
+
+namespace {
+
+// Packs a feature index and the IDs of its one to three characters.
+// The feature index is stored plus one, so that no n-gram is 0.
+inline uint64_t getNgram(int32_t feature, int32_t id0, int32_t id1, int32_t id2) {
+    return (static_cast<uint64_t>(feature + 1) << 48) | (static_cast<uint64_t>(id0) << 32) |
+           (static_cast<uint64_t>(id1) << 16) | static_cast<uint64_t>(id2);
+}
+
+inline int32_t getNgramFeature(uint64_t ngram) { return static_cast<int32_t>(ngram >> 48) - 1; }
+
+inline int32_t getNgramHash(uint64_t ngram, int32_t shift) {
+    return static_cast<int32_t>((ngram * 0x9e3779b97f4a7c15ULL) >> shift);
+}
+
+}  // namespace
 
 MlBreakEngine::MlBreakEngine(const UnicodeSet &digitOrOpenPunctuationOrAlphabetSet,
                              const UnicodeSet &closePunctuationSet, UErrorCode &status)
     : fDigitOrOpenPunctuationOrAlphabetSet(digitOrOpenPunctuationOrAlphabetSet),
       fClosePunctuationSet(closePunctuationSet),
+      fNumCharIds(0),
+      fNgramShift(0),
       fNegativeSum(0) {
     if (U_FAILURE(status)) {
         return;
@@ -35,7 +55,7 @@ MlBreakEngine::~MlBreakEngine() {}
 
 int32_t MlBreakEngine::divideUpRange(UText *inText, int32_t rangeStart, int32_t rangeEnd,
                                      UVector32 &foundBreaks, const UnicodeString &inString,
-                                     const LocalPointer<UVector32> &inputMap,
+                                     const UVector32 *inputMap,
                                      UErrorCode &status) const {
     if (U_FAILURE(status)) {
         return 0;
@@ -45,73 +65,51 @@ int32_t MlBreakEngine::divideUpRange(UText *inText, int32_t rangeStart, int32_t
         return 0;
     }
 
-    UVector32 boundary(inString.countChar32() + 1, status);
-    if (U_FAILURE(status)) {
-        return 0;
-    }
-    int32_t numBreaks = 0;
+    const char16_t *s = inString.getBuffer();
+    int32_t length = inString.length();
     int32_t codePointLength = inString.countChar32();
-    // The ML algorithm groups six char and evaluates whether the 4th char is a breakpoint.
-    // In each iteration, it evaluates the 4th char and then moves forward one char like a sliding
-    // window. Initially, the first six values in the indexList are [-1, -1, 0, 1, 2, 3]. After
-    // moving forward, finally the last six values in the indexList are
-    // [length-4, length-3, length-2, length-1, -1, -1]. The "+4" here means four extra "-1".
-    int32_t indexSize = codePointLength + 4;
-    LocalMemory<int32_t> indexList(static_cast<int32_t*>(uprv_malloc(indexSize * sizeof(int32_t))));
-    if (indexList.isNull()) {
-        status = U_MEMORY_ALLOCATION_ERROR;
-        return 0;
-    }
-    int32_t numCodeUnits = initIndexList(inString, indexList.getAlias(), status);
-
-    // Add a break for the start.
-    boundary.addElement(0, status);
-    numBreaks++;
-    if (U_FAILURE(status)) return 0;
-
-    for (int32_t idx = 0; idx + 1 < codePointLength && U_SUCCESS(status); idx++) {
-        numBreaks =
-            evaluateBreakpoint(inString, indexList.getAlias(), idx, numCodeUnits, numBreaks, boundary, status);
-        if (idx + 4 < codePointLength) {
-            indexList[idx + 6] = numCodeUnits;
-            numCodeUnits += U16_LENGTH(inString.char32At(indexList[idx + 6]));
-        }
-    }
-
-    if (U_FAILURE(status)) return 0;
-
-    // Add a break for the end if there is not one there already.
-    if (boundary.lastElementi() != inString.countChar32()) {
-        boundary.addElement(inString.countChar32(), status);
-        numBreaks++;
+    // The ML algorithm groups six chars and evaluates whether there is a breakpoint between the
+    // 3rd and the 4th char. It moves forward one char at a time like a sliding window, which
+    // holds the feature IDs of the chars, and 0 before the start and after the end of the text.
+    // Initially the window is [0, 0, 0, cp0, cp1, cp2] for the breakpoint before cp0.
+    int32_t window[6] = {0, 0, 0, 0, 0, 0};
+    int32_t next = 0;  // code unit index of the next char to enter the window
+    for (int32_t i = 3; i < 6 && next < length; i++) {
+        UChar32 c;
+        U16_NEXT(s, next, length, c);
+        window[i] = getCharId(c);
     }
 
-    int32_t prevCPPos = -1;
+    // Convert each breakpoint, a code point index in inString, to the native index in inText.
+    // There is always a break for the start and for the end.
     int32_t prevUTextPos = -1;
     int32_t correctedNumBreaks = 0;
-    for (int32_t i = 0; i < numBreaks; i++) {
-        int32_t cpPos = boundary.elementAti(i);
-        int32_t utextPos = inputMap.isValid() ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
-        U_ASSERT(cpPos > prevCPPos);
-        U_ASSERT(utextPos >= prevUTextPos);
-
-        if (utextPos > prevUTextPos) {
-            if (utextPos != rangeStart ||
-                (utextPos > 0 &&
-                 fClosePunctuationSet.contains(utext_char32At(inText, utextPos - 1)))) {
-                foundBreaks.push(utextPos, status);
-                correctedNumBreaks++;
-            }
-        } else {
-            // Normalization expanded the input text, the dictionary found a boundary
+    for (int32_t cpPos = 0; cpPos <= codePointLength; cpPos++) {
+        if (cpPos == 0 || cpPos == codePointLength || evaluateBreakpoint(window) > 0) {
+            int32_t utextPos = inputMap != nullptr ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
+            U_ASSERT(utextPos >= prevUTextPos);
+            // Normalization may have expanded the input text and the model found a boundary
             // within the expansion, giving two boundaries with the same index in the
             // original text. Ignore the second. See ticket #12918.
-            --numBreaks;
+            if (utextPos > prevUTextPos) {
+                if (utextPos != rangeStart ||
+                    (utextPos > 0 &&
+                     fClosePunctuationSet.contains(utext_char32At(inText, utextPos - 1)))) {
+                    foundBreaks.push(utextPos, status);
+                    correctedNumBreaks++;
+                }
+            }
+            prevUTextPos = utextPos;
+        }
+        uprv_memmove(window, window + 1, 5 * sizeof(int32_t));
+        window[5] = 0;
+        if (next < length) {
+            UChar32 c;
+            U16_NEXT(s, next, length, c);
+            window[5] = getCharId(c);
         }
-        prevCPPos = cpPos;
-        prevUTextPos = utextPos;
     }
-    (void)prevCPPos;  // suppress compiler warnings about unused variable
+    if (U_FAILURE(status)) return 0;
 
     UChar32 nextChar = utext_char32At(inText, rangeEnd);
     if (!foundBreaks.isEmpty() && foundBreaks.peeki() == rangeEnd) {
@@ -129,76 +127,42 @@ int32_t MlBreakEngine::divideUpRange(UText *inText, int32_t rangeStart, int32_t
     return correctedNumBreaks;
 }
 
-int32_t MlBreakEngine::evaluateBreakpoint(const UnicodeString &inString, int32_t *indexList,
-                                          int32_t startIdx, int32_t numCodeUnits, int32_t numBreaks,
-                                          UVector32 &boundary, UErrorCode &status) const {
-    if (U_FAILURE(status)) {
-        return numBreaks;
+int32_t MlBreakEngine::getNgramScore(uint64_t ngram) const {
+    const uint64_t *keys = fNgramKeys.getAlias();
+    int32_t mask = static_cast<int32_t>((static_cast<uint64_t>(1) << (64 - fNgramShift)) - 1);
+    for (int32_t i = getNgramHash(ngram, fNgramShift);; i = (i + 1) & mask) {
+        if (keys[i] == ngram) {
+            return fNgramScores[i];
+        }
+        if (keys[i] == 0) {
+            return 0;
+        }
     }
-    int32_t start = 0, end = 0;
-    int32_t score = fNegativeSum;
+}
 
-    for (int i = 0; i < 6; i++) {
+int32_t MlBreakEngine::evaluateBreakpoint(const int32_t *window) const {
+    int32_t score = fNegativeSum;
+    const int32_t *unigramScores = fUnigramScores.getAlias();
+    for (int32_t i = 0; i < 6; i++) {
         // UW1 ~ UW6
-        start = startIdx + i;
-        if (indexList[start] != -1) {
-            end = (indexList[start + 1] != -1) ? indexList[start + 1] : numCodeUnits;
-            score += fModel[static_cast<int32_t>(ModelIndex::kUWStart) + i].geti(
-                inString.tempSubString(indexList[start], end - indexList[start]));
-        }
+        // ID 0 has all-zero scores, so there is no need to check for it.
+        score += unigramScores[window[i] * 6 + i];
     }
-    for (int i = 0; i < 3; i++) {
+    for (int32_t i = 0; i < 3; i++) {
         // BW1 ~ BW3
-        start = startIdx + i + 1;
-        if (indexList[start] != -1 && indexList[start + 1] != -1) {
-            end = (indexList[start + 2] != -1) ? indexList[start + 2] : numCodeUnits;
-            score += fModel[static_cast<int32_t>(ModelIndex::kBWStart) + i].geti(
-                inString.tempSubString(indexList[start], end - indexList[start]));
+        if (window[i + 1] != 0 && window[i + 2] != 0) {
+            score += getNgramScore(getNgram(static_cast<int32_t>(ModelIndex::kBWStart) + i,
+                                            window[i + 1], window[i + 2], 0));
         }
     }
-    for (int i = 0; i < 4; i++) {
+    for (int32_t i = 0; i < 4; i++) {
         // TW1 ~ TW4
-        start = startIdx + i;
-        if (indexList[start] != -1 && indexList[start + 1] != -1 && indexList[start + 2] != -1) {
-            end = (indexList[start + 3] != -1) ? indexList[start + 3] : numCodeUnits;
-            score += fModel[static_cast<int32_t>(ModelIndex::kTWStart) + i].geti(
-                inString.tempSubString(indexList[start], end - indexList[start]));
+        if (window[i] != 0 && window[i + 1] != 0 && window[i + 2] != 0) {
+            score += getNgramScore(getNgram(static_cast<int32_t>(ModelIndex::kTWStart) + i,
+                                            window[i], window[i + 1], window[i + 2]));
         }
     }
-
-    if (score > 0) {
-        boundary.addElement(startIdx + 1, status);
-        numBreaks++;
-    }
-    return numBreaks;
-}
-
-int32_t MlBreakEngine::initIndexList(const UnicodeString &inString, int32_t *indexList,
-                                     UErrorCode &status) const {
-    if (U_FAILURE(status)) {
-        return 0;
-    }
-    int32_t index = 0;
-    int32_t length = inString.countChar32();
-    // Set all (lenght+4) items inside indexLength to -1 presuming -1 is 4 bytes of 0xff.
-    uprv_memset(indexList, 0xff, (length + 4) * sizeof(int32_t));
-    if (length > 0) {
-        indexList[2] = 0;
-        index = U16_LENGTH(inString.char32At(0));
-        if (length > 1) {
-            indexList[3] = index;
-            index += U16_LENGTH(inString.char32At(index));
-            if (length > 2) {
-                indexList[4] = index;
-                index += U16_LENGTH(inString.char32At(index));
-                if (length > 3) {
-                    indexList[5] = index;
-                    index += U16_LENGTH(inString.char32At(index));
-                }
-            }
-        }
-    }
-    return index;
+    return score;
 }
 
 void MlBreakEngine::loadMLModel(UErrorCode &error) {
@@ -208,37 +172,43 @@ void MlBreakEngine::loadMLModel(UErrorCode &error) {
 
     if (U_FAILURE(error)) return;
 
-    UnicodeString key;
-    StackUResourceBundle stackTempBundle;
-    ResourceDataValue modelKey;
-
     LocalUResourceBundlePointer rbp(ures_openDirect(U_ICUDATA_BRKITR, "jaml", &error));
     UResourceBundle *rb = rbp.getAlias();
     if (U_FAILURE(error)) return;
 
+    LocalUMutableCPTriePointer mutableCharIds(umutablecptrie_open(0, 0, &error));
+    UVector64 ngrams(error);
+    UVector32 scores(error);
+    if (U_FAILURE(error)) return;
+    UMutableCPTrie *ids = mutableCharIds.getAlias();
+
     int32_t index = 0;
-    initKeyValue(rb, "UW1Keys", "UW1Values", fModel[index++], error);
-    initKeyValue(rb, "UW2Keys", "UW2Values", fModel[index++], error);
-    initKeyValue(rb, "UW3Keys", "UW3Values", fModel[index++], error);
-    initKeyValue(rb, "UW4Keys", "UW4Values", fModel[index++], error);
-    initKeyValue(rb, "UW5Keys", "UW5Values", fModel[index++], error);
-    initKeyValue(rb, "UW6Keys", "UW6Values", fModel[index++], error);
-    initKeyValue(rb, "BW1Keys", "BW1Values", fModel[index++], error);
-    initKeyValue(rb, "BW2Keys", "BW2Values", fModel[index++], error);
-    initKeyValue(rb, "BW3Keys", "BW3Values", fModel[index++], error);
-    initKeyValue(rb, "TW1Keys", "TW1Values", fModel[index++], error);
-    initKeyValue(rb, "TW2Keys", "TW2Values", fModel[index++], error);
-    initKeyValue(rb, "TW3Keys", "TW3Values", fModel[index++], error);
-    initKeyValue(rb, "TW4Keys", "TW4Values", fModel[index++], error);
+    initKeyValue(rb, "UW1Keys", "UW1Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "UW2Keys", "UW2Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "UW3Keys", "UW3Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "UW4Keys", "UW4Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "UW5Keys", "UW5Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "UW6Keys", "UW6Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "BW1Keys", "BW1Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "BW2Keys", "BW2Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "BW3Keys", "BW3Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "TW1Keys", "TW1Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "TW2Keys", "TW2Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "TW3Keys", "TW3Values", index++, ids, ngrams, scores, error);
+    initKeyValue(rb, "TW4Keys", "TW4Values", index++, ids, ngrams, scores, error);
     fNegativeSum /= 2;
+
+    fCharIds.adoptInstead(
+        umutablecptrie_buildImmutable(ids, UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_16, &error));
+    buildScoreTables(ngrams, scores, error);
 }
 
 void MlBreakEngine::initKeyValue(UResourceBundle *rb, const char *keyName, const char *valueName,
-                                 Hashtable &model, UErrorCode &error) {
+                                 int32_t feature, UMutableCPTrie *mutableCharIds,
+                                 UVector64 &ngrams, UVector32 &scores, UErrorCode &error) {
     int32_t keySize = 0;
     int32_t valueSize = 0;
     int32_t stringLength = 0;
-    UnicodeString key;
     StackUResourceBundle stackTempBundle;
     ResourceDataValue modelKey;
 
@@ -253,14 +223,88 @@ void MlBreakEngine::initKeyValue(UResourceBundle *rb, const char *keyName, const
     keySize = stringArray.getSize();
     if (U_FAILURE(error)) return;
 
-    for (int32_t idx = 0; idx < keySize; idx++) {
+    // The UW features are single characters, BW bigrams and TW trigrams.
+    int32_t numChars = feature < static_cast<int32_t>(ModelIndex::kBWStart)   ? 1
+                       : feature < static_cast<int32_t>(ModelIndex::kTWStart) ? 2
+                                                                              : 3;
+    for (int32_t idx = 0; idx < keySize && U_SUCCESS(error); idx++) {
         stringArray.getValue(idx, modelKey);
-        key = UnicodeString(modelKey.getString(stringLength, error));
-        if (U_SUCCESS(error)) {
-            U_ASSERT(idx < valueSize);
-            fNegativeSum -= value[idx];
-            model.puti(key, value[idx], error);
+        const char16_t *key = modelKey.getString(stringLength, error);
+        if (U_FAILURE(error)) {
+            break;
+        }
+        U_ASSERT(idx < valueSize);
+        fNegativeSum -= value[idx];
+
+        int32_t charIds[3] = {0, 0, 0};
+        int32_t count = 0;
+        for (int32_t i = 0; i < stringLength && count <= numChars;) {
+            UChar32 c;
+            U16_NEXT(key, i, stringLength, c);
+            int32_t id = static_cast<int32_t>(umutablecptrie_get(mutableCharIds, c));
+            if (id == 0) {
+                if (fNumCharIds == 0xffff) {
+                    error = U_INVALID_FORMAT_ERROR;
+                    return;
+                }
+                id = ++fNumCharIds;
+                umutablecptrie_set(mutableCharIds, c, id, &error);
+            }
+            if (count < numChars) {
+                charIds[count] = id;
+            }
+            count++;
+        }
+        // A key with a different number of characters can never match.
+        if (count == numChars) {
+            ngrams.addElement(static_cast<int64_t>(
+                getNgram(feature, charIds[0], charIds[1], charIds[2])), error);
+            scores.addElement(value[idx], error);
+        }
+    }
+}
+
+void MlBreakEngine::buildScoreTables(const UVector64 &ngrams, const UVector32 &scores,
+                                     UErrorCode &error) {
+    if (U_FAILURE(error)) return;
+    // ID 0 is for all other characters, and has no scores.
+    int32_t unigramLength = (fNumCharIds + 1) * 6;
+    int32_t numNgrams = 0;
+    for (int32_t i = 0; i < ngrams.size(); i++) {
+        if (getNgramFeature(static_cast<uint64_t>(ngrams.elementAti(i))) >=
+                static_cast<int32_t>(ModelIndex::kBWStart)) {
+            numNgrams++;
+        }
+    }
+    // At most half full.
+    int32_t tableBits = 3;
+    while ((1 << tableBits) < 2 * numNgrams) {
+        tableBits++;
+    }
+    int32_t tableSize = 1 << tableBits;
+    if (fUnigramScores.allocateInsteadAndReset(unigramLength) == nullptr ||
+            fNgramKeys.allocateInsteadAndReset(tableSize) == nullptr ||
+            fNgramScores.allocateInsteadAndReset(tableSize) == nullptr) {
+        error = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    fNgramShift = 64 - tableBits;
+
+    // As in a hash map, a later duplicate key replaces the earlier one.
+    for (int32_t i = 0; i < ngrams.size(); i++) {
+        uint64_t ngram = static_cast<uint64_t>(ngrams.elementAti(i));
+        int32_t feature = getNgramFeature(ngram);
+        if (feature < static_cast<int32_t>(ModelIndex::kBWStart)) {
+            int32_t id = static_cast<int32_t>(ngram >> 32) & 0xffff;
+            fUnigramScores[id * 6 + feature] = scores.elementAti(i);
+            continue;
+        }
+        int32_t j = getNgramHash(ngram, fNgramShift);
+        while (fNgramKeys[j] != 0 && fNgramKeys[j] != ngram) {
+            j = (j + 1) & (tableSize - 1);
         }
+        fNgramKeys[j] = ngram;
+        fNgramScores[j] = scores.elementAti(i);
     }
 }
 
@@ -4,11 +4,14 @@
 #ifndef MLBREAKENGINE_H
 #define MLBREAKENGINE_H
 
-#include "hash.h"
+#include "cmemory.h"
 #include "unicode/resbund.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/uniset.h"
 #include "unicode/utext.h"
 #include "uvectr32.h"
+#include "uvectr64.h"
 
 U_NAMESPACE_BEGIN
 
@@ -44,13 +47,14 @@ class MlBreakEngine : public UMemory {
      * @param rangeEnd The end of the range of the characters
      * @param foundBreaks Output of C array of int32_t break positions, or 0
      * @param inString The normalized string of text ranging from rangeStart to rangeEnd
-     * @param inputMap The vector storing the native index of inText
+     * @param inputMap The vector storing the native index of inText, or nullptr if
+     *                 inString maps 1:1 to inText starting at rangeStart
      * @param status Information on any errors encountered.
      * @return The number of breaks found
      */
     int32_t divideUpRange(UText *inText, int32_t rangeStart, int32_t rangeEnd,
                           UVector32 &foundBreaks, const UnicodeString &inString,
-                          const LocalPointer<UVector32> &inputMap, UErrorCode &status) const;
+                          const UVector32 *inputMap, UErrorCode &status) const;
 
    private:
     /**
@@ -67,44 +71,61 @@ class MlBreakEngine : public UMemory {
      * @param rb A ResouceBundle corresponding to the model file.
      * @param keyName The kay name in the model file.
      * @param valueName The value name in the model file.
-     * @param model A hashtable to store the pairs of the feature and its score.
+     * @param feature The index of the feature, 0..12 for {UW1..UW6, BW1..BW3, TW1..TW4}.
+     * @param mutableCharIds A trie that maps each character of a key to its ID.
+     * @param ngrams Receives the packed n-gram of each key, see getNgram().
+     * @param scores Receives the score of each key.
      * @param error Information on any errors encountered.
      */
     void initKeyValue(UResourceBundle *rb, const char *keyName, const char *valueName,
-                      Hashtable &model, UErrorCode &error);
+                      int32_t feature, UMutableCPTrie *mutableCharIds, UVector64 &ngrams,
+                      UVector32 &scores, UErrorCode &error);
 
     /**
-     * Initialize the index list from the input string.
+     * Build the lookup tables for the scores from the model's n-grams.
      *
-     * @param inString A input string to be segmented.
-     * @param indexList A code unit index list of inString.
-     * @param status Information on any errors encountered.
-     * @return The number of code units of the first four characters in inString.
+     * @param ngrams The packed n-grams.
+     * @param scores The corresponding scores.
+     * @param error Information on any errors encountered.
      */
-    int32_t initIndexList(const UnicodeString &inString, int32_t *indexList,
-                          UErrorCode &status) const;
+    void buildScoreTables(const UVector64 &ngrams, const UVector32 &scores, UErrorCode &error);
 
     /**
-     * Evaluate whether the index is a potential breakpoint.
-     *
-     * @param inString A input string to be segmented.
-     * @param indexList A code unit index list of the inString.
-     * @param startIdx The start index of the indexList.
-     * @param numCodeUnits  The current code unit boundary of the indexList.
-     * @param numBreaks The accumulated number of breakpoints.
-     * @param boundary A vector including the index of the breakpoint.
-     * @param status Information on any errors encountered.
-     * @return The number of breakpoints
+     * @param c A code point.
+     * @return The feature ID of c: 1..fNumCharIds for the characters of the model, otherwise 0.
+     */
+    inline int32_t getCharId(UChar32 c) const {
+        return UCPTRIE_FAST_GET(fCharIds.getAlias(), UCPTRIE_16, c);
+    }
+
+    /**
+     * @return The score of a bigram or trigram feature, or 0 if the model does not have it.
      */
-    int32_t evaluateBreakpoint(const UnicodeString &inString, int32_t *indexList, int32_t startIdx,
-                               int32_t numCodeUnits, int32_t numBreaks, UVector32 &boundary,
-                               UErrorCode &status) const;
+    int32_t getNgramScore(uint64_t ngram) const;
 
-    void printUnicodeString(const UnicodeString &s) const;
+    /**
+     * Evaluate whether there is a breakpoint between window[2] and window[3].
+     *
+     * @param window The feature IDs of the six characters around the potential breakpoint,
+     *               with 0 for positions outside of the text.
+     * @return The score of the breakpoint; it is a breakpoint if the score is positive.
+     */
+    int32_t evaluateBreakpoint(const int32_t *window) const;
 
     UnicodeSet fDigitOrOpenPunctuationOrAlphabetSet;
     UnicodeSet fClosePunctuationSet;
-    Hashtable fModel[13];  // {UW1, UW2, ... UW6, BW1, ... BW3, TW1, TW2, ... TW4} 6+3+4= 13
+    // The model is compiled into integer feature IDs. Each character that
+    // occurs in the model's keys has an ID, and an n-gram packs the feature
+    // index and up to three IDs into a uint64_t.
+    LocalUCPTriePointer fCharIds;
+    int32_t fNumCharIds;
+    // Scores of the unigram features UW1..UW6, six per character ID.
+    LocalMemory<int32_t> fUnigramScores;
+    // Open-addressing hash table of the bigram and trigram features
+    // {BW1, ... BW3, TW1, ... TW4}. Empty slots have the key 0.
+    LocalMemory<uint64_t> fNgramKeys;
+    LocalMemory<int32_t> fNgramScores;
+    int32_t fNgramShift;
     int32_t fNegativeSum;
 };
 
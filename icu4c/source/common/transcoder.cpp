@@ -0,0 +1,100 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// transcoder.cpp
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_CONVERSION
+
+#include "unicode/bytestream.h"
+#include "unicode/stringpiece.h"
+#include "unicode/transcoder.h"
+#include "unicode/ucnv.h"
+#include "cmemory.h"
+#include "ucnv_imp.h"
+
+U_NAMESPACE_BEGIN
+
+Transcoder::Transcoder(const char *sourceCharset, const char *targetCharset, UErrorCode &errorCode) :
+        sourceCnv(nullptr), targetCnv(nullptr),
+        pivotSource(pivotBuffer), pivotTarget(pivotBuffer),
+        sourceBytesConsumed(0), targetBytesProduced(0) {
+    if (U_FAILURE(errorCode)) { return; }
+    sourceCnv = ucnv_open(sourceCharset, &errorCode);
+    targetCnv = ucnv_open(targetCharset, &errorCode);
+}
+
+Transcoder::~Transcoder() {
+    ucnv_close(sourceCnv);
+    ucnv_close(targetCnv);
+}
+
+UBool
+Transcoder::transcode(const char *&source, const char *sourceLimit,
+                      char *&target, const char *targetLimit,
+                      UBool flush, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return false; }
+    if (sourceCnv == nullptr || targetCnv == nullptr) {
+        errorCode = U_INVALID_STATE_ERROR;
+        return false;
+    }
+    const char *sourceStart = source;
+    char *targetStart = target;
+    // The pivot buffer and the converters keep any partial state between calls.
+    // With direct UTF-8 conversion, ucnv_convertEx() uses at most 32 units of the pivot.
+    ucnv_convertExUnterminated(targetCnv, sourceCnv,
+                               &target, targetLimit,
+                               &source, sourceLimit,
+                               pivotBuffer, &pivotSource, &pivotTarget, pivotBuffer + PIVOT_CAPACITY,
+                               false, flush, &errorCode);
+    sourceBytesConsumed += source - sourceStart;
+    targetBytesProduced += target - targetStart;
+    if (errorCode == U_BUFFER_OVERFLOW_ERROR) {
+        // Back-pressure: the output continues with the next call.
+        errorCode = U_ZERO_ERROR;
+        return true;
+    }
+    return false;
+}
+
+void
+Transcoder::transcode(StringPiece source, ByteSink &sink, UBool flush, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return; }
+    const char *s = source.data();
+    const char *sourceLimit = s + source.length();
+    if (s == nullptr) {
+        // ucnv_convertEx() requires a non-null source pointer.
+        s = sourceLimit = "";
+    }
+    char scratch[1024];
+    UBool more;
+    do {
+        int32_t capacity;
+        int32_t desiredCapacity = static_cast<int32_t>(sourceLimit - s);
+        if (desiredCapacity < (INT32_MAX / 2)) {
+            desiredCapacity = 2 * desiredCapacity + 16;
+        } else {
+            desiredCapacity = INT32_MAX;
+        }
+        char *buffer = sink.GetAppendBuffer(16, desiredCapacity,
+                                            scratch, UPRV_LENGTHOF(scratch), &capacity);
+        char *t = buffer;
+        more = transcode(s, sourceLimit, t, buffer + capacity, flush, errorCode);
+        if (t > buffer) {
+            sink.Append(buffer, static_cast<int32_t>(t - buffer));
+        }
+    } while (more && U_SUCCESS(errorCode));
+}
+
+void
+Transcoder::reset() {
+    ucnv_resetToUnicode(sourceCnv);
+    ucnv_resetFromUnicode(targetCnv);
+    pivotSource = pivotTarget = pivotBuffer;
+    sourceBytesConsumed = targetBytesProduced = 0;
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_CONVERSION
@@ -326,24 +326,10 @@ ucnv_clone(const UConverter* cnv, UErrorCode *status)
     return ucnv_safeClone(cnv, nullptr, nullptr, status);
 }
 
-/*Decreases the reference counter in the shared immutable section of the object
- *and frees the mutable part*/
-
-U_CAPI void  U_EXPORT2
-ucnv_close (UConverter * converter)
-{
-    UErrorCode errorCode = U_ZERO_ERROR;
-
-    UTRACE_ENTRY_OC(UTRACE_UCNV_CLOSE);
-
-    if (converter == nullptr)
-    {
-        UTRACE_EXIT();
-        return;
-    }
-
-    UTRACE_DATA3(UTRACE_OPEN_CLOSE, "close converter %s at %p, isCopyLocal=%b",
-        ucnv_getName(converter, &errorCode), converter, converter->isCopyLocal);
+/* Notifies the callback functions that the converter is closed. */
+static void
+_notifyClose(UConverter *converter) {
+    UErrorCode errorCode;
 
     /* In order to speed up the close, only call the callbacks when they have been changed.
     This performance check will only work when the callbacks are set within a shared library
@@ -380,6 +366,30 @@ ucnv_close (UConverter * converter)
         errorCode = U_ZERO_ERROR;
         converter->fromUCharErrorBehaviour(converter->fromUContext, &fromUArgs, nullptr, 0, 0, UCNV_CLOSE, &errorCode);
     }
+}
+
+/*Decreases the reference counter in the shared immutable section of the object
+ *and frees the mutable part*/
+
+U_CAPI void  U_EXPORT2
+ucnv_close (UConverter * converter)
+{
+#if U_ENABLE_TRACING
+    UErrorCode errorCode = U_ZERO_ERROR;
+#endif
+
+    UTRACE_ENTRY_OC(UTRACE_UCNV_CLOSE);
+
+    if (converter == nullptr)
+    {
+        UTRACE_EXIT();
+        return;
+    }
+
+    UTRACE_DATA3(UTRACE_OPEN_CLOSE, "close converter %s at %p, isCopyLocal=%b",
+        ucnv_getName(converter, &errorCode), converter, converter->isCopyLocal);
+
+    _notifyClose(converter);
 
     if (converter->sharedData->impl->close != nullptr) {
         converter->sharedData->impl->close(converter);
@@ -647,6 +657,167 @@ ucnv_resetFromUnicode(UConverter *converter)
     _reset(converter, UCNV_RESET_FROM_UNICODE, true);
 }
 
+/* converter pool ----------------------------------------------------------- */
+
+/* Converters acquired with longer names are not kept in the pool. */
+#define UCNV_POOL_MAX_NAME_LENGTH 64
+
+typedef struct UConverterPoolEntry {
+    UConverter *cnv;
+    UBool inUse;
+    /* ucnv_open() warning, returned again when the converter is reused */
+    UErrorCode warning;
+    /* substitution character settings after ucnv_open(), restored on release */
+    int8_t subCharLen;
+    uint8_t subChar1;
+    uint8_t subChars[UCNV_MAX_SUBCHAR_LEN];
+    char name[UCNV_POOL_MAX_NAME_LENGTH];
+} UConverterPoolEntry;
+
+struct UConverterPool {
+    int32_t capacity;
+    int32_t length;
+    UConverterPoolEntry *entries;
+};
+
+U_CAPI UConverterPool * U_EXPORT2
+ucnv_openPool(int32_t capacity, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return nullptr;
+    }
+    if(capacity <= 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return nullptr;
+    }
+    UConverterPool *pool = (UConverterPool *)uprv_malloc(sizeof(UConverterPool));
+    UConverterPoolEntry *entries =
+        (UConverterPoolEntry *)uprv_malloc(capacity * sizeof(UConverterPoolEntry));
+    if(pool == nullptr || entries == nullptr) {
+        uprv_free(pool);
+        uprv_free(entries);
+        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    pool->capacity = capacity;
+    pool->length = 0;
+    pool->entries = entries;
+    return pool;
+}
+
+U_CAPI void U_EXPORT2
+ucnv_closePool(UConverterPool *pool) {
+    if(pool == nullptr) {
+        return;
+    }
+    for(int32_t i = 0; i < pool->length; ++i) {
+        ucnv_close(pool->entries[i].cnv);
+    }
+    uprv_free(pool->entries);
+    uprv_free(pool);
+}
+
+U_CAPI UConverter * U_EXPORT2
+ucnv_acquire(UConverterPool *pool, const char *converterName, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) {
+        return nullptr;
+    }
+    if(pool == nullptr) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return nullptr;
+    }
+    if(converterName == nullptr) {
+        converterName = ucnv_getDefaultName();
+    }
+
+    int32_t i, freeIndex = -1;
+    for(i = 0; i < pool->length; ++i) {
+        UConverterPoolEntry *entry = pool->entries + i;
+        if(!entry->inUse) {
+            if(uprv_strcmp(entry->name, converterName) == 0) {
+                entry->inUse = true;
+                if(entry->warning != U_ZERO_ERROR) {
+                    *pErrorCode = entry->warning;
+                }
+                return entry->cnv;
+            }
+            freeIndex = i;
+        }
+    }
+
+    UErrorCode openErrorCode = U_ZERO_ERROR;
+    UConverter *cnv = ucnv_open(converterName, &openErrorCode);
+    if(U_FAILURE(openErrorCode)) {
+        *pErrorCode = openErrorCode;
+        return nullptr;
+    }
+    if(openErrorCode != U_ZERO_ERROR) {
+        *pErrorCode = openErrorCode;
+    }
+    if(uprv_strlen(converterName) >= UCNV_POOL_MAX_NAME_LENGTH) {
+        return cnv;  /* not pooled, closed by ucnv_release() */
+    }
+
+    /* Append a new entry, or replace the last released converter with a different name. */
+    UConverterPoolEntry *entry;
+    if(pool->length < pool->capacity) {
+        entry = pool->entries + pool->length++;
+    } else if(freeIndex >= 0) {
+        entry = pool->entries + freeIndex;
+        ucnv_close(entry->cnv);
+    } else {
+        return cnv;  /* the pool is full of acquired converters */
+    }
+    entry->cnv = cnv;
+    entry->inUse = true;
+    entry->warning = openErrorCode;
+    entry->subCharLen = cnv->subCharLen;
+    entry->subChar1 = cnv->subChar1;
+    uprv_memcpy(entry->subChars, cnv->subChars, UCNV_MAX_SUBCHAR_LEN);
+    uprv_strcpy(entry->name, converterName);
+    return cnv;
+}
+
+U_CAPI void U_EXPORT2
+ucnv_release(UConverterPool *pool, UConverter *converter) {
+    if(converter == nullptr) {
+        return;
+    }
+    UConverterPoolEntry *entry = nullptr;
+    if(pool != nullptr) {
+        for(int32_t i = 0; i < pool->length; ++i) {
+            if(pool->entries[i].cnv == converter && pool->entries[i].inUse) {
+                entry = pool->entries + i;
+                break;
+            }
+        }
+    }
+    if(entry == nullptr) {
+        ucnv_close(converter);
+        return;
+    }
+
+    /* Make the converter look like one that was just opened, without reallocating it. */
+    _notifyClose(converter);
+    converter->fromCharErrorBehaviour = UCNV_TO_U_DEFAULT_CALLBACK;
+    converter->fromUCharErrorBehaviour = UCNV_FROM_U_DEFAULT_CALLBACK;
+    converter->toUContext = nullptr;
+    converter->fromUContext = nullptr;
+    converter->toUCallbackReason = UCNV_ILLEGAL;
+    converter->useFallback = false;
+
+    if(converter->subChars != (uint8_t *)converter->subUChars) {
+        uprv_free(converter->subChars);
+        converter->subChars = (uint8_t *)converter->subUChars;
+    }
+    converter->subCharLen = entry->subCharLen;
+    converter->subChar1 = entry->subChar1;
+    converter->useSubChar1 = false;
+    uprv_memcpy(converter->subChars, entry->subChars, UCNV_MAX_SUBCHAR_LEN);
+
+    _reset(converter, UCNV_RESET_BOTH, false);
+    entry->inUse = false;
+}
+
 U_CAPI int8_t   U_EXPORT2
 ucnv_getMaxCharSize (const UConverter * converter)
 {
@@ -2039,14 +2210,14 @@ ucnv_getNextUChar(UConverter *cnv,
 
 /* ucnv_convert() and siblings ---------------------------------------------- */
 
-U_CAPI void U_EXPORT2
-ucnv_convertEx(UConverter *targetCnv, UConverter *sourceCnv,
-               char **target, const char *targetLimit,
-               const char **source, const char *sourceLimit,
-               char16_t *pivotStart, char16_t **pivotSource,
-               char16_t **pivotTarget, const char16_t *pivotLimit,
-               UBool reset, UBool flush,
-               UErrorCode *pErrorCode) {
+U_CFUNC void
+ucnv_convertExUnterminated(UConverter *targetCnv, UConverter *sourceCnv,
+                           char **target, const char *targetLimit,
+                           const char **source, const char *sourceLimit,
+                           char16_t *pivotStart, char16_t **pivotSource,
+                           char16_t **pivotTarget, const char16_t *pivotLimit,
+                           UBool reset, UBool flush,
+                           UErrorCode *pErrorCode) {
     char16_t pivotBuffer[CHUNK_SIZE];
     const char16_t *myPivotSource;
     char16_t *myPivotTarget;
@@ -2383,9 +2554,24 @@ ucnv_convertEx(UConverter *targetCnv, UConverter *sourceCnv,
 
     *source=toUArgs.source;
     *target=fromUArgs.target;
+}
+
+U_CAPI void U_EXPORT2
+ucnv_convertEx(UConverter *targetCnv, UConverter *sourceCnv,
+               char **target, const char *targetLimit,
+               const char **source, const char *sourceLimit,
+               char16_t *pivotStart, char16_t **pivotSource,
+               char16_t **pivotTarget, const char16_t *pivotLimit,
+               UBool reset, UBool flush,
+               UErrorCode *pErrorCode) {
+    ucnv_convertExUnterminated(targetCnv, sourceCnv,
+                               target, targetLimit,
+                               source, sourceLimit,
+                               pivotStart, pivotSource, pivotTarget, pivotLimit,
+                               reset, flush, pErrorCode);
 
     /* terminate the target buffer if possible */
-    if(flush && U_SUCCESS(*pErrorCode)) {
+    if(flush && pErrorCode!=nullptr && U_SUCCESS(*pErrorCode)) {
         if(*target!=targetLimit) {
             **target=0;
             if(*pErrorCode==U_STRING_NOT_TERMINATED_WARNING) {
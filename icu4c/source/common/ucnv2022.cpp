@@ -37,6 +37,7 @@
 #include "unicode/ucnv_err.h"
 #include "unicode/ucnv_cb.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "ucnv_imp.h"
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
@@ -2320,6 +2321,291 @@ UConverter_toUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
     args->source = mySource;
 }
 
+/*************** direct UTF-8 conversion *******************/
+
+/*
+ * Direct ISO-2022-JP <-> UTF-8 conversion for the common case of text that
+ * only switches among ASCII, JIS X 0201 Roman and JIS X 0208, as in mail bodies.
+ * Runs within one G0 charset are converted in tight loops.
+ *
+ * Everything else is left to pivoting conversion by returning U_USING_DEFAULT_WARNING:
+ * SO/SI and single shifts, G2 and the other charsets, 8-bit bytes,
+ * unmappable and illegal sequences, partial sequences at buffer boundaries,
+ * and the end of the target buffer.
+ * The state is kept in the same converter fields as for the regular functions,
+ * so that both can be interleaved.
+ */
+
+/*
+ * Minimum target capacity for converting one more character directly:
+ * a 3-byte designation sequence plus a double-byte character,
+ * or one BMP code point in UTF-8.
+ */
+#define ISO2022JP_DIRECT_MIN_CAPACITY 5
+
+static void U_CALLCONV
+ucnv_ISO2022JPToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                     UConverterToUnicodeArgs *pToUArgs,
+                     UErrorCode *pErrorCode) {
+    UConverter *cnv = pToUArgs->converter;
+    UConverterDataISO2022 *myData = static_cast<UConverterDataISO2022*>(cnv->extraInfo);
+    ISO2022State *pToU2022State = &myData->toU2022State;
+    const UConverterSharedData *sjis = myData->myConverterArray[JISX208];
+    const int32_t (*stateTable)[256] = sjis->mbcs.stateTable;
+    const uint16_t *unicodeCodeUnits = sjis->mbcs.unicodeCodeUnits;
+    const uint8_t *source = reinterpret_cast<const uint8_t*>(pToUArgs->source);
+    const uint8_t *sourceLimit = reinterpret_cast<const uint8_t*>(pToUArgs->sourceLimit);
+    uint8_t *target = reinterpret_cast<uint8_t*>(pFromUArgs->target);
+    const uint8_t *targetLimit = reinterpret_cast<const uint8_t*>(pFromUArgs->targetLimit);
+    int8_t cs;
+
+    if(myData->key != 0 || cnv->toULength != 0 ||
+            pToU2022State->g != 0 || pToU2022State->cs[2] != 0 ||
+            pFromUArgs->converter->fromUChar32 != 0) {
+        /* continue a partial sequence or a shifted state with pivoting */
+        *pErrorCode = U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    cs = pToU2022State->cs[0];
+    while(source < sourceLimit && (targetLimit - target) >= ISO2022JP_DIRECT_MIN_CAPACITY) {
+        uint8_t b = *source;
+        if(b == ESC_2022) {
+            /* G0 designations of the three common charsets */
+            int8_t newCs;
+            if((sourceLimit - source) < 3 || (myData->version == 0 && myData->isEmptySegment)) {
+                break;
+            }
+            if(source[1] == 0x28 && source[2] == 0x42) {
+                newCs = static_cast<int8_t>(ASCII);
+            } else if(source[1] == 0x28 && source[2] == 0x4a) {
+                newCs = static_cast<int8_t>(JISX201);
+            } else if(source[1] == 0x24 && (source[2] == 0x42 || source[2] == 0x40)) {
+                newCs = static_cast<int8_t>(JISX208);
+            } else {
+                break;
+            }
+            source += 3;
+            pToU2022State->cs[0] = cs = newCs;
+            myData->isEmptySegment = true;
+        } else if(cs == ASCII) {
+            /* copy a run of ASCII; CR/LF do not change this state */
+            int32_t count = static_cast<int32_t>(sourceLimit - source);
+            int32_t i;
+            if(count > (targetLimit - target)) {
+                count = static_cast<int32_t>(targetLimit - target);
+            }
+            for(i = 0; i < count && (b = source[i]) <= 0x7f && !IS_2022_CONTROL(b); ++i) {
+                target[i] = b;
+            }
+            if(i == 0) {
+                break;  /* SO, SI or an 8-bit byte */
+            }
+            source += i;
+            target += i;
+            myData->isEmptySegment = false;
+        } else if(cs == JISX208) {
+            const uint8_t *runStart = source;
+            if(b == CR || b == LF) {
+                /* automatically reset to single-byte mode */
+                pToU2022State->cs[0] = cs = static_cast<int8_t>(ASCII);
+                continue;
+            }
+            /* convert a run of JIS X 0208 byte pairs via the Shift-JIS table */
+            while((sourceLimit - source) >= 2 && (targetLimit - target) >= 3) {
+                char sjisBytes[2];
+                uint8_t lead = source[0], trail = source[1];
+                int32_t entry, length;
+                uint32_t offset;
+                UChar32 c;
+
+                if (static_cast<uint8_t>(lead - 0x21) > (0x7e - 0x21) ||
+                    static_cast<uint8_t>(trail - 0x21) > (0x7e - 0x21)
+                ) {
+                    break;
+                }
+                _2022ToSJIS(lead, trail, sjisBytes);
+                entry = stateTable[0][static_cast<uint8_t>(sjisBytes[0])];
+                if(!MBCS_ENTRY_IS_TRANSITION(entry)) {
+                    break;
+                }
+                offset = MBCS_ENTRY_TRANSITION_OFFSET(entry);
+                entry = stateTable[MBCS_ENTRY_TRANSITION_STATE(entry)][static_cast<uint8_t>(sjisBytes[1])];
+                if(!(MBCS_ENTRY_IS_FINAL(entry) &&
+                     MBCS_ENTRY_FINAL_ACTION(entry) == MBCS_STATE_VALID_16 &&
+                     (c = unicodeCodeUnits[offset + MBCS_ENTRY_FINAL_VALUE_16(entry)]) < 0xfffe)
+                ) {
+                    break;  /* unassigned or fallback */
+                }
+                source += 2;
+                length = 0;
+                U8_APPEND_UNSAFE(target, length, c);
+                target += length;
+            }
+            if(source == runStart) {
+                break;
+            }
+            myData->isEmptySegment = false;
+        } else if(cs == JISX201) {
+            int32_t length = 0;
+            if(b > 0x7f || IS_2022_CONTROL(b)) {
+                break;
+            }
+            ++source;
+            U8_APPEND_UNSAFE(target, length, jisx201ToU(b));
+            target += length;
+            myData->isEmptySegment = false;
+        } else {
+            break;
+        }
+    }
+
+    if(source < sourceLimit) {
+        *pErrorCode = U_USING_DEFAULT_WARNING;
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source = reinterpret_cast<const char*>(source);
+    pFromUArgs->target = reinterpret_cast<char*>(target);
+}
+
+static void U_CALLCONV
+ucnv_ISO2022JPFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                       UConverterToUnicodeArgs *pToUArgs,
+                       UErrorCode *pErrorCode) {
+    UConverter *utf8 = pToUArgs->converter;
+    UConverter *cnv = pFromUArgs->converter;
+    UConverterDataISO2022 *converterData = static_cast<UConverterDataISO2022*>(cnv->extraInfo);
+    ISO2022State *pFromU2022State = &converterData->fromU2022State;
+    const UConverterSharedData *sjis = converterData->myConverterArray[JISX208];
+    const uint16_t *table = sjis->mbcs.fromUnicodeTable;
+    const uint8_t *bytes = sjis->mbcs.fromUnicodeBytes;
+    const uint8_t *source = reinterpret_cast<const uint8_t*>(pToUArgs->source);
+    const uint8_t *sourceLimit = reinterpret_cast<const uint8_t*>(pToUArgs->sourceLimit);
+    uint8_t *target = reinterpret_cast<uint8_t*>(pFromUArgs->target);
+    const uint8_t *targetLimit = reinterpret_cast<const uint8_t*>(pFromUArgs->targetLimit);
+    int8_t cs;
+
+    if(utf8->toULength > 0 || cnv->fromUChar32 != 0 ||
+            pFromU2022State->g != 0 || pFromU2022State->cs[2] != 0) {
+        /* continue a partial character or a shifted state with pivoting */
+        *pErrorCode = U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    cs = pFromU2022State->cs[0];
+    if(cs != ASCII && cs != JISX201 && cs != JISX208) {
+        *pErrorCode = U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    while(source < sourceLimit && (targetLimit - target) >= ISO2022JP_DIRECT_MIN_CAPACITY) {
+        uint8_t b = *source;
+        if(b <= 0x7f) {
+            int32_t count, i;
+            if(IS_2022_CONTROL(b)) {
+                break;  /* do not convert SO/SI/ESC */
+            }
+            if(cs == JISX208 || (cs == JISX201 && (b == 0x5c || b == 0x7e))) {
+                uprv_memcpy(target, escSeqChars[ASCII], 3);
+                target += 3;
+                pFromU2022State->cs[0] = cs = static_cast<int8_t>(ASCII);
+            }
+            /* copy a run of ASCII, or of JIS X 0201 Roman without the two bytes that differ */
+            count = static_cast<int32_t>(sourceLimit - source);
+            if(count > (targetLimit - target)) {
+                count = static_cast<int32_t>(targetLimit - target);
+            }
+            if(cs == ASCII) {
+                for(i = 0; i < count && (b = source[i]) <= 0x7f && !IS_2022_CONTROL(b); ++i) {
+                    target[i] = b;
+                }
+            } else {
+                for(i = 0;
+                    i < count && (b = source[i]) <= 0x7f && !IS_2022_CONTROL(b) && b != 0x5c && b != 0x7e;
+                    ++i) {
+                    target[i] = b;
+                }
+            }
+            source += i;
+            target += i;
+        } else {
+            /*
+             * Convert a run of U+0100..U+FFFF with JIS X 0208 round trips.
+             * ASCII, JIS X 0201 and ISO-8859-1 precede JIS X 0208 in jpCharsetPref[]
+             * and cover none of these except U+203E, and the G2 charset is not set,
+             * so the regular function would choose JIS X 0208 as well.
+             */
+            const uint8_t *runStart = source;
+            while(source < sourceLimit && (targetLimit - target) >= ISO2022JP_DIRECT_MIN_CAPACITY) {
+                uint32_t stage2Entry, value;
+                int32_t length;
+                UChar32 c;
+
+                b = *source;
+                if(0xe0 <= b && b <= 0xef) {
+                    if((sourceLimit - source) >= 3 &&
+                        U8_IS_VALID_LEAD3_AND_T1(b, source[1]) && U8_IS_TRAIL(source[2])
+                    ) {
+                        c = ((b & 0xf) << 12) | ((source[1] & 0x3f) << 6) | (source[2] & 0x3f);
+                        length = 3;
+                    } else {
+                        break;
+                    }
+                } else if(0xc4 <= b && b < 0xe0 && (sourceLimit - source) >= 2 && U8_IS_TRAIL(source[1])) {
+                    c = ((b & 0x1f) << 6) | (source[1] & 0x3f);
+                    length = 2;
+                } else {
+                    break;
+                }
+                if(c == 0x203e) {
+                    break;  /* JIS X 0201 Roman overline */
+                }
+                stage2Entry = MBCS_STAGE_2_FROM_U(table, c);
+                if(!MBCS_FROM_U_IS_ROUNDTRIP(stage2Entry, c)) {
+                    break;
+                }
+                value = MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+                if(value <= 0xff || (value = _2022FromSJIS(value)) == 0) {
+                    break;  /* single-byte Shift-JIS, or beyond JIS X 0208 */
+                }
+                if(cs != JISX208) {
+                    uprv_memcpy(target, escSeqChars[JISX208], 3);
+                    target += 3;
+                    pFromU2022State->cs[0] = cs = static_cast<int8_t>(JISX208);
+                }
+                target[0] = static_cast<uint8_t>(value >> 8);
+                target[1] = static_cast<uint8_t>(value);
+                target += 2;
+                source += length;
+            }
+            if(source == runStart) {
+                break;
+            }
+        }
+    }
+
+    if(source < sourceLimit) {
+        *pErrorCode = U_USING_DEFAULT_WARNING;
+    } else if(pToUArgs->flush && cs != ASCII) {
+        /*
+         * ucnv_convertEx() does not flush the fromUnicode converter after
+         * direct conversion, so return to ASCII at the end of the text here.
+         */
+        if((targetLimit - target) >= 3) {
+            uprv_memcpy(target, escSeqChars[ASCII], 3);
+            target += 3;
+            pFromU2022State->cs[0] = static_cast<int8_t>(ASCII);
+        } else {
+            *pErrorCode = U_USING_DEFAULT_WARNING;
+        }
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source = reinterpret_cast<const char*>(source);
+    pFromUArgs->target = reinterpret_cast<char*>(target);
+}
+
 
 #if !UCONFIG_ONLY_HTML_CONVERSION
 /***************************************************************
@@ -3841,8 +4127,8 @@ static const UConverterImpl _ISO2022JPImpl={
     _ISO_2022_SafeClone,
     _ISO_2022_GetUnicodeSet,
 
-    nullptr,
-    nullptr
+    ucnv_ISO2022JPToUTF8,
+    ucnv_ISO2022JPFromUTF8
 };
 static const UConverterStaticData _ISO2022JPStaticData={
     sizeof(UConverterStaticData),
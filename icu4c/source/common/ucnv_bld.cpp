@@ -198,6 +198,53 @@ static icu::UMutex cnvCacheMutex;
 /*  Note:  the global mutex is used for      */
 /*         reference count updates.          */
 
+/*
+ * Converter name cache.
+ *
+ * Maps a converter name exactly as passed to ucnv_open() (including any options)
+ * to the result of ucnv_loadSharedData(): the parsed name pieces and the shared data.
+ * A hit skips option parsing, alias lookup and cnvCacheMutex; for data-based
+ * converters it only adds a reference with an atomic increment.
+ *
+ * The cache is a small direct-mapped array of immutable entries.
+ * Entries are only added while holding cnvCacheMutex, and only into empty slots,
+ * so that readers never see an entry being freed while new names are looked up.
+ * ucnv_flushCache() sets gNameCacheFlushing, empties the array and then waits until
+ * no reader is between loading a slot and incrementing a reference counter
+ * (gNameCacheReaders==0) before it deletes any shared data with a reference counter of 0.
+ * Readers that see gNameCacheFlushing do not count themselves; they take the slow path,
+ * which waits for cnvCacheMutex. So the flush only waits for readers that were
+ * already inside, and new ucnv_open() calls cannot keep it waiting.
+ */
+#define UCNV_NAME_CACHE_SIZE 64
+#define UCNV_NAME_CACHE_MAX_KEY_LENGTH 64
+
+typedef struct UConverterNameCacheEntry {
+    UConverterSharedData *sharedData;
+    /* The name pieces and the warning as set by a full ucnv_loadSharedData(). */
+    UConverterNamePieces pieces;
+    UErrorCode warning;
+    char key[UCNV_NAME_CACHE_MAX_KEY_LENGTH];
+} UConverterNameCacheEntry;
+
+static std::atomic<UConverterNameCacheEntry *> gNameCache[UCNV_NAME_CACHE_SIZE];
+static icu::u_atomic_int32_t gNameCacheReaders {0};
+static icu::u_atomic_int32_t gNameCacheFlushing {0};
+
+/*
+ * Reference counters are updated and read atomically, via this function,
+ * because the converter name cache adds references without holding cnvCacheMutex.
+ * UConverterSharedData is also used from C, so the field is a plain int32_t.
+ */
+static_assert(sizeof(icu::u_atomic_int32_t) == sizeof(int32_t) &&
+              alignof(icu::u_atomic_int32_t) == alignof(int32_t),
+              "referenceCounter must have the layout of u_atomic_int32_t");
+
+static inline icu::u_atomic_int32_t *
+ucnv_refCounter(UConverterSharedData *sharedData) {
+    return reinterpret_cast<icu::u_atomic_int32_t *>(&sharedData->referenceCounter);
+}
+
 static const char **gAvailableConverters = nullptr;
 static uint16_t gAvailableConverterCount = 0;
 static icu::UInitOnce gAvailableConvertersInitOnce {};
@@ -514,7 +561,7 @@ ucnv_deleteSharedConverterData(UConverterSharedData * deadSharedData)
     UTRACE_ENTRY_OC(UTRACE_UCNV_UNLOAD);
     UTRACE_DATA2(UTRACE_OPEN_CLOSE, "unload converter %s shared data %p", deadSharedData->staticData->name, deadSharedData);
 
-    if (deadSharedData->referenceCounter > 0) {
+    if (ucnv_refCounter(deadSharedData)->load() > 0) {
         UTRACE_EXIT_VALUE((int32_t)false);
         return false;
     }
@@ -571,7 +618,7 @@ ucnv_load(UConverterLoadArgs *pArgs, UErrorCode *err) {
     {
         /* The data for this converter was already in the cache.            */
         /* Update the reference counter on the shared data: one more client */
-        mySharedConverterData->referenceCounter++;
+        icu::umtx_atomic_inc(ucnv_refCounter(mySharedConverterData));
     }
 
     return mySharedConverterData;
@@ -585,11 +632,12 @@ ucnv_load(UConverterLoadArgs *pArgs, UErrorCode *err) {
 U_CAPI void
 ucnv_unload(UConverterSharedData *sharedData) {
     if(sharedData != nullptr) {
-        if (sharedData->referenceCounter > 0) {
-            sharedData->referenceCounter--;
+        int32_t referenceCounter = ucnv_refCounter(sharedData)->load();
+        if (referenceCounter > 0) {
+            referenceCounter = icu::umtx_atomic_dec(ucnv_refCounter(sharedData));
         }
 
-        if((sharedData->referenceCounter <= 0)&&(sharedData->sharedDataCached == false)) {
+        if((referenceCounter <= 0)&&(sharedData->sharedDataCached == false)) {
             ucnv_deleteSharedConverterData(sharedData);
         }
     }
@@ -610,7 +658,7 @@ ucnv_incrementRefCount(UConverterSharedData *sharedData)
 {
     if(sharedData != nullptr && sharedData->isReferenceCounted) {
         umtx_lock(&cnvCacheMutex);
-        sharedData->referenceCounter++;
+        icu::umtx_atomic_inc(ucnv_refCounter(sharedData));
         umtx_unlock(&cnvCacheMutex);
     }
 }
@@ -701,6 +749,123 @@ parseConverterOptions(const char *inName,
     }
 }
 
+/*
+ * Returns the converter name cache slot for the name as passed to ucnv_open(),
+ * or -1 if the name is too long to be cached.
+ */
+static int32_t
+ucnv_getNameCacheSlot(const char *name) {
+    uint32_t hash = 0;
+    int32_t length = 0;
+    char c;
+
+    while((c = name[length]) != 0) {
+        if(++length >= UCNV_NAME_CACHE_MAX_KEY_LENGTH) {
+            return -1;
+        }
+        hash = hash * 37 + static_cast<uint8_t>(c);
+    }
+    return static_cast<int32_t>((hash ^ (hash >> 8)) & (UCNV_NAME_CACHE_SIZE - 1));
+}
+
+/*
+ * Looks up a converter name in the name cache without taking cnvCacheMutex.
+ * On a hit, sets *pPieces and *pArgs as ucnv_loadSharedData() would,
+ * adds a reference to the shared data and returns it.
+ * Returns nullptr on a miss.
+ */
+static UConverterSharedData *
+ucnv_getCachedSharedData(const char *converterName, int32_t slot,
+                         UConverterNamePieces *pPieces,
+                         UConverterLoadArgs *pArgs,
+                         UErrorCode *err) {
+    UConverterSharedData *sharedData = nullptr;
+
+    if(gNameCacheFlushing.load() != 0) {
+        return nullptr;
+    }
+    icu::umtx_atomic_inc(&gNameCacheReaders);
+    const UConverterNameCacheEntry *entry = gNameCache[slot].load();
+    if(entry != nullptr && uprv_strcmp(entry->key, converterName) == 0) {
+        sharedData = entry->sharedData;
+        if(sharedData->isReferenceCounted) {
+            /* The entry is not freed, and its shared data not deleted, until we leave. */
+            icu::umtx_atomic_inc(ucnv_refCounter(sharedData));
+            pArgs->nestedLoads = 1;
+            pArgs->pkg = nullptr;
+        }
+        uprv_memcpy(pPieces, &entry->pieces, sizeof(UConverterNamePieces));
+        if(entry->warning != U_ZERO_ERROR) {
+            *err = entry->warning;
+        }
+    }
+    icu::umtx_atomic_dec(&gNameCacheReaders);
+
+    if(sharedData != nullptr) {
+        pArgs->name = pPieces->cnvName;
+        pArgs->locale = pPieces->locale;
+        pArgs->options = pPieces->options;
+    }
+    return sharedData;
+}
+
+/*
+ * Adds the result of a full ucnv_loadSharedData() to the name cache
+ * if the slot is still empty.
+ * Data-based shared data must be in the SHARED_DATA_HASHTABLE.
+ * This function must be called inside umtx_lock(&cnvCacheMutex).
+ */
+static void
+ucnv_cacheSharedData(const char *converterName, int32_t slot,
+                     UConverterSharedData *sharedData,
+                     const UConverterLoadArgs *pArgs,
+                     UErrorCode warning) {
+    if(gNameCache[slot].load() != nullptr ||
+            uprv_strlen(pArgs->name) >= UCNV_MAX_CONVERTER_NAME_LENGTH) {
+        return;
+    }
+    UConverterNameCacheEntry *entry =
+        static_cast<UConverterNameCacheEntry *>(uprv_malloc(sizeof(UConverterNameCacheEntry)));
+    if(entry == nullptr) {
+        return;
+    }
+    entry->sharedData = sharedData;
+    uprv_strcpy(entry->pieces.cnvName, pArgs->name);
+    uprv_strcpy(entry->pieces.locale, pArgs->locale);
+    entry->pieces.options = pArgs->options;
+    entry->warning = warning;
+    uprv_strcpy(entry->key, converterName);
+    gNameCache[slot].store(entry);
+    ucnv_enableCleanup();
+}
+
+/*
+ * Empties the name cache.
+ * This function must be called inside umtx_lock(&cnvCacheMutex),
+ * before shared data is deleted.
+ */
+static void
+ucnv_flushNameCache() {
+    UConverterNameCacheEntry *entries[UCNV_NAME_CACHE_SIZE];
+    int32_t i;
+
+    gNameCacheFlushing.store(1);
+    for(i = 0; i < UCNV_NAME_CACHE_SIZE; ++i) {
+        entries[i] = gNameCache[i].exchange(nullptr);
+    }
+    /*
+     * Readers that loaded an entry before it was removed may still be copying it
+     * or incrementing its shared data's reference counter.
+     * Readers that start now see gNameCacheFlushing and do not enter,
+     * so this waits at most for the few short critical sections already under way.
+     */
+    while(gNameCacheReaders.load() != 0) {}
+    for(i = 0; i < UCNV_NAME_CACHE_SIZE; ++i) {
+        uprv_free(entries[i]);
+    }
+    gNameCacheFlushing.store(0);
+}
+
 /*Logic determines if the converter is Algorithmic AND/OR cached
  *depending on that:
  * -we either go to get data from disk and cache it (Data=true, Cached=false)
@@ -719,6 +884,7 @@ ucnv_loadSharedData(const char *converterName,
     UErrorCode internalErrorCode = U_ZERO_ERROR;
     UBool mayContainOption = true;
     UBool checkForAlgorithmic = true;
+    int32_t nameCacheSlot = -1;
 
     if (U_FAILURE (*err)) {
         return nullptr;
@@ -773,6 +939,16 @@ ucnv_loadSharedData(const char *converterName,
         return (UConverterSharedData *)converterData[UCNV_UTF8];
     }
     else {
+        if (!pArgs->onlyTestIsLoadable) {
+            nameCacheSlot = ucnv_getNameCacheSlot(converterName);
+            if (nameCacheSlot >= 0) {
+                mySharedConverterData = ucnv_getCachedSharedData(converterName, nameCacheSlot, pPieces, pArgs, err);
+                if (mySharedConverterData != nullptr) {
+                    return mySharedConverterData;
+                }
+            }
+        }
+
         /* separate the converter name from the options */
         parseConverterOptions(converterName, pPieces, pArgs, err);
         if (U_FAILURE(*err)) {
@@ -801,6 +977,12 @@ ucnv_loadSharedData(const char *converterName,
     /* get the shared data for an algorithmic converter, if it is one */
     if (checkForAlgorithmic) {
         mySharedConverterData = (UConverterSharedData *)getAlgorithmicTypeFromName(pArgs->name);
+        if (mySharedConverterData != nullptr && nameCacheSlot >= 0 && gNameCache[nameCacheSlot].load() == nullptr) {
+            umtx_lock(&cnvCacheMutex);
+            ucnv_cacheSharedData(converterName, nameCacheSlot, mySharedConverterData, pArgs,
+                                 internalErrorCode == U_AMBIGUOUS_ALIAS_WARNING ? internalErrorCode : U_ZERO_ERROR);
+            umtx_unlock(&cnvCacheMutex);
+        }
     }
     if (mySharedConverterData == nullptr)
     {
@@ -814,6 +996,11 @@ ucnv_loadSharedData(const char *converterName,
 
         umtx_lock(&cnvCacheMutex);
         mySharedConverterData = ucnv_load(pArgs, err);
+        if (nameCacheSlot >= 0 && U_SUCCESS(*err) &&
+                mySharedConverterData != nullptr && mySharedConverterData->sharedDataCached) {
+            ucnv_cacheSharedData(converterName, nameCacheSlot, mySharedConverterData, pArgs,
+                                 internalErrorCode == U_AMBIGUOUS_ALIAS_WARNING ? internalErrorCode : U_ZERO_ERROR);
+        }
         umtx_unlock(&cnvCacheMutex);
         if (U_FAILURE (*err) || (mySharedConverterData == nullptr))
         {
@@ -1042,10 +1229,19 @@ ucnv_flushCache ()
     /* Close the default converter without creating a new one so that everything will be flushed. */
     u_flushDefaultConverter();
 
+    umtx_lock(&cnvCacheMutex);
+
+    /*
+     * Empty the converter name cache first so that no other thread can find
+     * shared data without going through the hash table while we delete it.
+     */
+    ucnv_flushNameCache();
+
     /*if shared data hasn't even been lazy evaluated yet
     * return 0
     */
     if (SHARED_DATA_HASHTABLE == nullptr) {
+        umtx_unlock(&cnvCacheMutex);
         UTRACE_EXIT_VALUE((int32_t)0);
         return 0;
     }
@@ -1059,9 +1255,8 @@ ucnv_flushCache ()
     *                   ucnv_close while the iteration is in process, but this is
     *                   benign.  It can't be incremented (in ucnv_createConverter())
     *                   because the sequence of looking up in the cache + incrementing
-    *                   is protected by cnvCacheMutex.
+    *                   is protected by cnvCacheMutex, and the name cache is empty.
     */
-    umtx_lock(&cnvCacheMutex);
     /*
      * double loop: A delta/extension-only converter has a pointer to its base table's
      * shared data; the first iteration of the outer loop may see the delta converter
@@ -1076,7 +1271,7 @@ ucnv_flushCache ()
         {
             mySharedData = (UConverterSharedData *) e->value.pointer;
             /*deletes only if reference counter == 0 */
-            if (mySharedData->referenceCounter == 0)
+            if (ucnv_refCounter(mySharedData)->load() == 0)
             {
                 tableDeletedNum++;
 
@@ -95,7 +95,12 @@ typedef struct UConverterStaticData {   /* +offset: size */
  */
 struct UConverterSharedData {
     uint32_t structSize;            /* Size of this structure */
-    uint32_t referenceCounter;      /* used to count number of clients, unused for static/immutable SharedData */
+    /*
+     * Number of clients, unused for static/immutable SharedData.
+     * ucnv_bld.cpp updates it with atomic operations because the converter name cache
+     * adds references without holding cnvCacheMutex.
+     */
+    int32_t referenceCounter;
 
     const void *dataMemory;         /* from udata_openChoice() - for cleanup */
 
@@ -127,7 +132,7 @@ struct UConverterSharedData {
 /** UConverterSharedData initializer for static, non-reference-counted converters. */
 #define UCNV_IMMUTABLE_SHARED_DATA_INITIALIZER(pStaticData, pImpl) \
     { \
-        sizeof(UConverterSharedData), ~((uint32_t)0), \
+        sizeof(UConverterSharedData), -1, \
         NULL, pStaticData, false, false, pImpl, \
         0, UCNV_MBCS_TABLE_INITIALIZER \
     }
@@ -127,6 +127,21 @@ ucnv_unloadSharedDataIfReady(UConverterSharedData *sharedData);
 U_CFUNC void
 ucnv_incrementRefCount(UConverterSharedData *sharedData);
 
+/**
+ * Same as ucnv_convertEx() but never NUL-terminates the target
+ * nor sets U_STRING_NOT_TERMINATED_WARNING,
+ * so that streaming conversion does not write past its output.
+ * @internal
+ */
+U_CFUNC void
+ucnv_convertExUnterminated(UConverter *targetCnv, UConverter *sourceCnv,
+                           char **target, const char *targetLimit,
+                           const char **source, const char *sourceLimit,
+                           char16_t *pivotStart, char16_t **pivotSource,
+                           char16_t **pivotTarget, const char16_t *pivotLimit,
+                           UBool reset, UBool flush,
+                           UErrorCode *pErrorCode);
+
 /**
  * These are the default error handling callbacks for the charset conversion framework.
  * For performance reasons, they are only called to handle an error (not normally called for a reset or close).
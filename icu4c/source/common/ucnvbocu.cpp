@@ -388,6 +388,36 @@ packDiff(int32_t diff) {
 }
 
 
+/*
+ * ASCII fast paths.
+ *
+ * While prev==BOCU1_ASCII_PREV, C0 controls and space are written as themselves
+ * and US-ASCII characters 0x21..0x7f are single-byte differences
+ * that do not change prev; the same holds for decoding.
+ * Runs of such characters therefore need neither prev updates nor range tests on diff.
+ */
+
+/**
+ * Encodes the prefix of source code units that are US-ASCII,
+ * with prev==BOCU1_ASCII_PREV before and after the run.
+ * @return the number of code units converted, 0<=count<=length
+ */
+static inline int32_t
+encodeBocu1AsciiRun(const char16_t *source, uint8_t *target, int32_t length) {
+    int32_t i;
+    for(i=0; i<length; ++i) {
+        uint32_t c=source[i];
+        if(c<=0x20) {
+            target[i] = static_cast<uint8_t>(c);
+        } else if(c<=0x7f) {
+            target[i] = static_cast<uint8_t>(PACK_SINGLE_DIFF(c-BOCU1_ASCII_PREV));
+        } else {
+            break;
+        }
+    }
+    return i;
+}
+
 static void U_CALLCONV
 _Bocu1FromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                              UErrorCode *pErrorCode) {
@@ -432,6 +462,15 @@ _Bocu1FromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
     if(targetCapacity>diff) {
         targetCapacity=diff;
     }
+    if(prev==BOCU1_ASCII_PREV) {
+        diff=encodeBocu1AsciiRun(source, target, targetCapacity);
+        for(int32_t i=0; i<diff; ++i) {
+            *offsets++=nextSourceIndex++;
+        }
+        source+=diff;
+        target+=diff;
+        targetCapacity-=diff;
+    }
     while(targetCapacity>0 && (c=*source)<0x3000) {
         if(c<=0x20) {
             if(c!=0x20) {
@@ -685,6 +724,12 @@ _Bocu1FromUnicode(UConverterFromUnicodeArgs *pArgs,
     if(targetCapacity>diff) {
         targetCapacity=diff;
     }
+    if(prev==BOCU1_ASCII_PREV) {
+        diff=encodeBocu1AsciiRun(source, target, targetCapacity);
+        source+=diff;
+        target+=diff;
+        targetCapacity-=diff;
+    }
     while(targetCapacity>0 && (c=*source)<0x3000) {
         if(c<=0x20) {
             if(c!=0x20) {
@@ -952,6 +997,28 @@ decodeBocu1TrailByte(int32_t count, int32_t b) {
     }
 }
 
+/**
+ * Decodes the prefix of source bytes that are single-byte differences
+ * for US-ASCII characters or C0 controls and space,
+ * with prev==BOCU1_ASCII_PREV before and after the run.
+ * @return the number of bytes converted, 0<=count<=length
+ */
+static inline int32_t
+decodeBocu1AsciiRun(const uint8_t *source, char16_t *target, int32_t length) {
+    int32_t i;
+    for(i=0; i<length; ++i) {
+        uint32_t b=source[i];
+        if((b-BOCU1_START_NEG_2)<(BOCU1_START_POS_2-BOCU1_START_NEG_2)) {
+            target[i] = static_cast<char16_t>(b-(BOCU1_MIDDLE-BOCU1_ASCII_PREV));
+        } else if(b<=0x20) {
+            target[i] = static_cast<char16_t>(b);
+        } else {
+            break;
+        }
+    }
+    return i;
+}
+
 static void U_CALLCONV
 _Bocu1ToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                            UErrorCode *pErrorCode) {
@@ -1005,6 +1072,15 @@ _Bocu1ToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
     if(count>diff) {
         count=diff;
     }
+    if(prev==BOCU1_ASCII_PREV) {
+        diff=decodeBocu1AsciiRun(source, target, count);
+        for(int32_t i=0; i<diff; ++i) {
+            *offsets++=nextSourceIndex++;
+        }
+        source+=diff;
+        target+=diff;
+        count-=diff;
+    }
     while(count>0) {
         if(BOCU1_START_NEG_2<=(c=*source) && c<BOCU1_START_POS_2) {
             c=prev+(c-BOCU1_MIDDLE);
@@ -1219,6 +1295,12 @@ _Bocu1ToUnicode(UConverterToUnicodeArgs *pArgs,
     if(count>diff) {
         count=diff;
     }
+    if(prev==BOCU1_ASCII_PREV) {
+        diff=decodeBocu1AsciiRun(source, target, count);
+        source+=diff;
+        target+=diff;
+        count-=diff;
+    }
     while(count>0) {
         if(BOCU1_START_NEG_2<=(c=*source) && c<BOCU1_START_POS_2) {
             c=prev+(c-BOCU1_MIDDLE);
@@ -431,6 +431,16 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                   UConverterToUnicodeArgs *pToUArgs,
                   UErrorCode *pErrorCode);
 
+static void U_CALLCONV
+ucnv_MBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode);
+
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode);
+
 static const UConverterImpl _SBCSUTF8Impl={
     UCNV_MBCS,
 
@@ -453,7 +463,7 @@ static const UConverterImpl _SBCSUTF8Impl={
     nullptr,
     ucnv_MBCSGetUnicodeSet,
 
-    nullptr,
+    ucnv_MBCSToUTF8,
     ucnv_SBCSFromUTF8
 };
 
@@ -479,11 +489,11 @@ static const UConverterImpl _DBCSUTF8Impl={
     nullptr,
     ucnv_MBCSGetUnicodeSet,
 
-    nullptr,
+    ucnv_MBCSToUTF8,
     ucnv_DBCSFromUTF8
 };
 
-static const UConverterImpl _MBCSImpl={
+static const UConverterImpl _MBCSUTF8Impl={
     UCNV_MBCS,
 
     ucnv_MBCSLoad,
@@ -504,7 +514,33 @@ static const UConverterImpl _MBCSImpl={
     ucnv_MBCSWriteSub,
     nullptr,
     ucnv_MBCSGetUnicodeSet,
+
+    ucnv_MBCSToUTF8,
+    ucnv_MBCSFromUTF8
+};
+
+static const UConverterImpl _MBCSImpl={
+    UCNV_MBCS,
+
+    ucnv_MBCSLoad,
+    ucnv_MBCSUnload,
+
+    ucnv_MBCSOpen,
+    nullptr,
+    nullptr,
+
+    ucnv_MBCSToUnicodeWithOffsets,
+    ucnv_MBCSToUnicodeWithOffsets,
+    ucnv_MBCSFromUnicodeWithOffsets,
+    ucnv_MBCSFromUnicodeWithOffsets,
+    ucnv_MBCSGetNextUChar,
+
+    ucnv_MBCSGetStarters,
+    ucnv_MBCSGetName,
+    ucnv_MBCSWriteSub,
     nullptr,
+    ucnv_MBCSGetUnicodeSet,
+    ucnv_MBCSToUTF8,
     nullptr
 };
 
@@ -1863,8 +1899,13 @@ ucnv_MBCSLoad(UConverterSharedData *sharedData,
         } else {
             if(mbcsTable->outputType==MBCS_OUTPUT_2) {
                 sharedData->impl=&_DBCSUTF8Impl;
+            } else if(mbcsTable->outputType!=MBCS_OUTPUT_2_SISO) {
+                sharedData->impl=&_MBCSUTF8Impl;
             }
         }
+    } else if(mbcsTable->outputType!=MBCS_OUTPUT_2_SISO) {
+        /* no direct UTF-8 to SI/SO-stateful conversion, see ucnv_MBCSFromUTF8() */
+        sharedData->impl=&_MBCSUTF8Impl;
     }
 
     if(mbcsTable->outputType==MBCS_OUTPUT_DBCS_ONLY || mbcsTable->outputType==MBCS_OUTPUT_2_SISO) {
@@ -2175,6 +2216,101 @@ ucnv_MBCSSingleToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
     pArgs->offsets=offsets;
 }
 
+/*
+ * ASCII run fast paths.
+ *
+ * A run of ASCII bytes or code units that round-trip (see asciiRoundtrips)
+ * converts 1:1 without table lookups while the converter is in its initial state.
+ * The run is tested 8 units at a time with one mask over whole words,
+ * which compilers turn into vector code; the end of the run is handled one unit at a time.
+ * Other input, and thus every unassigned or illegal sequence,
+ * is left for the regular conversion loop with its callbacks.
+ */
+#define MBCS_ALL_ASCII_ROUNDTRIPS 0xffffffff
+
+/* Returns 1 if all 8 ASCII units at s round-trip, 0 otherwise. */
+#define MBCS_ASCII_ROUNDTRIPS_8(s, asciiRoundtrips) ( \
+    (asciiRoundtrips)==MBCS_ALL_ASCII_ROUNDTRIPS ? 1 : \
+    ((asciiRoundtrips)>>((s)[0]>>2))&((asciiRoundtrips)>>((s)[1]>>2))& \
+    ((asciiRoundtrips)>>((s)[2]>>2))&((asciiRoundtrips)>>((s)[3]>>2))& \
+    ((asciiRoundtrips)>>((s)[4]>>2))&((asciiRoundtrips)>>((s)[5]>>2))& \
+    ((asciiRoundtrips)>>((s)[6]>>2))&((asciiRoundtrips)>>((s)[7]>>2))&1)
+
+/**
+ * Converts the prefix of round-tripping ASCII source bytes to UTF-16.
+ * @return the number of bytes converted, 0<=count<=length
+ */
+static inline int32_t
+ucnv_MBCSASCIIRunToUnicode(const uint8_t *source, char16_t *target, int32_t length,
+                           uint32_t asciiRoundtrips) {
+    int32_t i=0;
+    while((length-i)>=8) {
+        uint64_t word;
+        uprv_memcpy(&word, source+i, 8);
+        if((word&0x8080808080808080ULL)!=0 || !MBCS_ASCII_ROUNDTRIPS_8(source+i, asciiRoundtrips)) {
+            break;
+        }
+        for(int32_t j=0; j<8; ++j) {
+            target[i+j]=source[i+j];
+        }
+        i+=8;
+    }
+    while(i<length && source[i]<=0x7f && IS_ASCII_ROUNDTRIP(source[i], asciiRoundtrips)) {
+        target[i]=source[i];
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Converts the prefix of round-tripping ASCII UTF-16 code units to bytes.
+ * @return the number of code units converted, 0<=count<=length
+ */
+static inline int32_t
+ucnv_MBCSASCIIRunFromUnicode(const char16_t *source, uint8_t *target, int32_t length,
+                             uint32_t asciiRoundtrips) {
+    int32_t i=0;
+    while((length-i)>=8) {
+        uint64_t words[2];
+        uprv_memcpy(words, source+i, 16);
+        if(((words[0]|words[1])&0xff80ff80ff80ff80ULL)!=0 ||
+                !MBCS_ASCII_ROUNDTRIPS_8(source+i, asciiRoundtrips)) {
+            break;
+        }
+        for(int32_t j=0; j<8; ++j) {
+            target[i+j]=static_cast<uint8_t>(source[i+j]);
+        }
+        i+=8;
+    }
+    while(i<length && source[i]<=0x7f && IS_ASCII_ROUNDTRIP(source[i], asciiRoundtrips)) {
+        target[i]=static_cast<uint8_t>(source[i]);
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Returns the length of the prefix of round-tripping ASCII bytes,
+ * which are the same in the codepage and in UTF-8.
+ * @return the number of bytes, 0<=count<=length
+ */
+static inline int32_t
+ucnv_MBCSASCIIRunLength(const uint8_t *source, int32_t length, uint32_t asciiRoundtrips) {
+    int32_t i=0;
+    while((length-i)>=8) {
+        uint64_t word;
+        uprv_memcpy(&word, source+i, 8);
+        if((word&0x8080808080808080ULL)!=0 || !MBCS_ASCII_ROUNDTRIPS_8(source+i, asciiRoundtrips)) {
+            break;
+        }
+        i+=8;
+    }
+    while(i<length && source[i]<=0x7f && IS_ASCII_ROUNDTRIP(source[i], asciiRoundtrips)) {
+        ++i;
+    }
+    return i;
+}
+
 /*
  * This version of ucnv_MBCSSingleToUnicodeWithOffsets() is optimized for single-byte, single-state codepages
  * that only map to and from the BMP.
@@ -2191,6 +2327,7 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
     int32_t *offsets;
 
     const int32_t (*stateTable)[256];
+    uint32_t asciiRoundtrips;
 
     int32_t sourceIndex;
 
@@ -2207,8 +2344,10 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
         stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+        asciiRoundtrips=0;
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
+        asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
     }
 
     /* sourceIndex=-1 if the current character began in the previous buffer */
@@ -2233,6 +2372,19 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
         loops=count=targetCapacity>>4;
         do {
+            if(asciiRoundtrips==MBCS_ALL_ASCII_ROUNDTRIPS) {
+                /* widen 16 ASCII bytes without table lookups */
+                uint64_t words[2];
+                uprv_memcpy(words, source, 16);
+                if(((words[0]|words[1])&0x8080808080808080ULL)==0) {
+                    for(int32_t i=0; i<16; ++i) {
+                        target[i]=source[i];
+                    }
+                    source+=16;
+                    target+=16;
+                    continue;
+                }
+            }
             oredEntries=entry=stateTable[0][*source++];
             *target++ = static_cast<char16_t>(MBCS_ENTRY_FINAL_VALUE_16(entry));
             oredEntries|=entry=stateTable[0][*source++];
@@ -2304,6 +2456,14 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     /* conversion loop */
     while(targetCapacity > 0 && source < sourceLimit) {
+        if(*source<=0x7f && IS_ASCII_ROUNDTRIP(*source, asciiRoundtrips)) {
+            /* offsets are set from lastSource, see below */
+            int32_t count=ucnv_MBCSASCIIRunToUnicode(source, target, targetCapacity, asciiRoundtrips);
+            source+=count;
+            target+=count;
+            targetCapacity-=count;
+            continue;
+        }
         entry=stateTable[0][*source++];
         /* MBCS_ENTRY_IS_FINAL(entry) */
 
@@ -2472,6 +2632,7 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     const int32_t (*stateTable)[256];
     const uint16_t *unicodeCodeUnits;
+    uint32_t asciiRoundtrips;
 
     uint32_t offset;
     uint8_t state;
@@ -2517,8 +2678,10 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
         stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+        asciiRoundtrips=0;
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
+        asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
     }
     unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
 
@@ -2560,6 +2723,16 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
             /* optimized loop for 1/2-byte input and BMP output */
             if(offsets==nullptr) {
                 do {
+                    if(state==0 && *source<=0x7f && IS_ASCII_ROUNDTRIP(*source, asciiRoundtrips)) {
+                        int32_t count=(int32_t)(sourceLimit-source);
+                        if(count>(targetLimit-target)) {
+                            count=(int32_t)(targetLimit-target);
+                        }
+                        count=ucnv_MBCSASCIIRunToUnicode(source, target, count, asciiRoundtrips);
+                        source+=count;
+                        target+=count;
+                        continue;
+                    }
                     entry=stateTable[state][*source];
                     if(MBCS_ENTRY_IS_TRANSITION(entry)) {
                         state=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
@@ -2595,6 +2768,21 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                 } while(source<sourceLimit && target<targetLimit);
             } else /* offsets!=nullptr */ {
                 do {
+                    if(state==0 && *source<=0x7f && IS_ASCII_ROUNDTRIP(*source, asciiRoundtrips)) {
+                        int32_t count=(int32_t)(sourceLimit-source);
+                        if(count>(targetLimit-target)) {
+                            count=(int32_t)(targetLimit-target);
+                        }
+                        count=ucnv_MBCSASCIIRunToUnicode(source, target, count, asciiRoundtrips);
+                        source+=count;
+                        target+=count;
+                        while(count>0) {
+                            *offsets++=sourceIndex;
+                            sourceIndex=++nextSourceIndex;
+                            --count;
+                        }
+                        continue;
+                    }
                     entry=stateTable[state][*source];
                     if(MBCS_ENTRY_IS_TRANSITION(entry)) {
                         state=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
@@ -3481,6 +3669,22 @@ ucnv_MBCSDoubleFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 }
                 --targetCapacity;
                 c=0;
+                /* convert the rest of the ASCII run */
+                int32_t count = static_cast<int32_t>(sourceLimit - source);
+                if(count>targetCapacity) {
+                    count=targetCapacity;
+                }
+                count=ucnv_MBCSASCIIRunFromUnicode(source, target, count, asciiRoundtrips);
+                source+=count;
+                target+=count;
+                targetCapacity-=count;
+                nextSourceIndex+=count;
+                if(offsets!=nullptr) {
+                    while(count>0) {
+                        *offsets++=sourceIndex++;
+                        --count;
+                    }
+                }
                 continue;
             }
             /*
@@ -3940,6 +4144,11 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
             *target++ = static_cast<uint8_t>(c);
             --targetCapacity;
             c=0;
+            /* convert the rest of the ASCII run; offsets are set from lastSource */
+            int32_t count=ucnv_MBCSASCIIRunFromUnicode(source, target, targetCapacity, asciiRoundtrips);
+            source+=count;
+            target+=count;
+            targetCapacity-=count;
             continue;
         }
         value=MBCS_SINGLE_RESULT_FROM_U(table, results, c);
@@ -4211,6 +4420,23 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 }
                 --targetCapacity;
                 c=0;
+                /* convert the rest of the ASCII run */
+                int32_t count=(int32_t)(sourceLimit-source);
+                if(count>targetCapacity) {
+                    count=targetCapacity;
+                }
+                count=ucnv_MBCSASCIIRunFromUnicode(source, target, count, asciiRoundtrips);
+                source+=count;
+                target+=count;
+                targetCapacity-=count;
+                nextSourceIndex+=count;
+                if(offsets!=nullptr) {
+                    while(count>0) {
+                        prevSourceIndex=sourceIndex;
+                        *offsets++=sourceIndex++;
+                        --count;
+                    }
+                }
                 continue;
             }
             /*
@@ -5622,6 +5848,817 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target = reinterpret_cast<char*>(target);
 }
 
+/*
+ * Looks up the codepage bytes for a code point, for ucnv_MBCSFromUTF8().
+ * Same as in ucnv_MBCSFromUnicodeWithOffsets() except that it does not
+ * handle MBCS_OUTPUT_2_SISO, for which there is no direct UTF-8 conversion.
+ *
+ * @return the number of bytes in *pValue (1..4), or 0 if c is not mapped
+ *         (c is then to be tried with an extension mapping)
+ */
+static inline int32_t
+ucnv_MBCSGetBytesFromUTF8(const UConverter *cnv, const uint8_t *bytes,
+                          UChar32 c, uint32_t *pValue) {
+    const uint16_t *table;
+    const uint8_t *p;
+    uint32_t stage2Entry;
+    uint32_t value;
+    int32_t length;
+
+    /* BMP-only codepages are stored without stage 1 entries for supplementary code points */
+    if(c>=0x10000 && !(cnv->sharedData->mbcs.unicodeMask&UCNV_HAS_SUPPLEMENTARY)) {
+        return 0;
+    }
+    table=cnv->sharedData->mbcs.fromUnicodeTable;
+
+    if(cnv->sharedData->mbcs.outputType==MBCS_OUTPUT_1) {
+        value=MBCS_SINGLE_RESULT_FROM_U(table, (const uint16_t *)bytes, c);
+        /* is this code point assigned, or do we use fallbacks? */
+        if(cnv->useFallback ? value>=0x800 : value>=0xc00) {
+            *pValue=value&0xff;
+            return 1;
+        }
+        return 0;
+    }
+
+    stage2Entry=MBCS_STAGE_2_FROM_U(table, c);
+
+    /* get the bytes and the length for the output */
+    switch(cnv->sharedData->mbcs.outputType) {
+    case MBCS_OUTPUT_2:
+        value=MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+        if(value<=0xff) {
+            length=1;
+        } else {
+            length=2;
+        }
+        break;
+    case MBCS_OUTPUT_DBCS_ONLY:
+        /* table with single-byte results, but only DBCS mappings used */
+        value=MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+        if(value<=0xff) {
+            /* no mapping or SBCS result, not taken for DBCS-only */
+            return 0;
+        } else {
+            length=2;
+        }
+        break;
+    case MBCS_OUTPUT_3:
+        p=MBCS_POINTER_3_FROM_STAGE_2(bytes, stage2Entry, c);
+        value=((uint32_t)*p<<16)|((uint32_t)p[1]<<8)|p[2];
+        if(value<=0xff) {
+            length=1;
+        } else if(value<=0xffff) {
+            length=2;
+        } else {
+            length=3;
+        }
+        break;
+    case MBCS_OUTPUT_4:
+        value=MBCS_VALUE_4_FROM_STAGE_2(bytes, stage2Entry, c);
+        if(value<=0xff) {
+            length=1;
+        } else if(value<=0xffff) {
+            length=2;
+        } else if(value<=0xffffff) {
+            length=3;
+        } else {
+            length=4;
+        }
+        break;
+    case MBCS_OUTPUT_3_EUC:
+        value=MBCS_VALUE_2_FROM_STAGE_2(bytes, stage2Entry, c);
+        /* EUC 16-bit fixed-length representation */
+        if(value<=0xff) {
+            length=1;
+        } else if((value&0x8000)==0) {
+            value|=0x8e8000;
+            length=3;
+        } else if((value&0x80)==0) {
+            value|=0x8f0080;
+            length=3;
+        } else {
+            length=2;
+        }
+        break;
+    case MBCS_OUTPUT_4_EUC:
+        p=MBCS_POINTER_3_FROM_STAGE_2(bytes, stage2Entry, c);
+        value=((uint32_t)*p<<16)|((uint32_t)p[1]<<8)|p[2];
+        /* EUC 16-bit fixed-length representation applied to the first two bytes */
+        if(value<=0xff) {
+            length=1;
+        } else if(value<=0xffff) {
+            length=2;
+        } else if((value&0x800000)==0) {
+            value|=0x8e800000;
+            length=4;
+        } else if((value&0x8000)==0) {
+            value|=0x8f008000;
+            length=4;
+        } else {
+            length=3;
+        }
+        break;
+    default:
+        /* must not occur */
+        return 0;
+    }
+
+    /* is this code point assigned, or do we use fallbacks? */
+    if( MBCS_FROM_U_IS_ROUNDTRIP(stage2Entry, c) ||
+        (UCNV_FROM_U_USE_FALLBACK(cnv, c) && value!=0)
+    ) {
+        *pValue=value;
+        return length;
+    }
+    return 0;
+}
+
+/*
+ * Direct UTF-8-to-MBCS conversion for all codepages except the
+ * SI/SO-stateful ones, which need their final Shift-In written
+ * by the fromUnicode flush.
+ * Same structure as ucnv_DBCSFromUTF8() but with the general
+ * stage 2/3 lookup instead of the mbcsIndex, so that it also works for
+ * tables that are not utf8Friendly and for 3- and 4-byte codepages.
+ */
+static void U_CALLCONV
+ucnv_MBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode) {
+    UConverter *utf8, *cnv;
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    int32_t targetCapacity;
+
+    const uint8_t *bytes;
+
+    int8_t oldToULength, toULength, toULimit;
+
+    UChar32 c;
+    uint8_t b, t1, t2;
+
+    uint32_t asciiRoundtrips;
+    uint32_t value;
+    int32_t length;
+    UBool hasSupplementary;
+
+    /* set up the local pointers */
+    utf8=pToUArgs->converter;
+    cnv=pFromUArgs->converter;
+    source=(uint8_t *)pToUArgs->source;
+    sourceLimit=(uint8_t *)pToUArgs->sourceLimit;
+    target = reinterpret_cast<uint8_t*>(pFromUArgs->target);
+    targetCapacity = static_cast<int32_t>(pFromUArgs->targetLimit - pFromUArgs->target);
+
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        bytes=cnv->sharedData->mbcs.swapLFNLFromUnicodeBytes;
+        asciiRoundtrips=0;
+    } else {
+        bytes=cnv->sharedData->mbcs.fromUnicodeBytes;
+        asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    }
+
+    hasSupplementary = static_cast<UBool>(cnv->sharedData->mbcs.unicodeMask & UCNV_HAS_SUPPLEMENTARY);
+
+    /* get the converter state from the UTF-8 UConverter */
+    if(utf8->toULength > 0) {
+        toULength=oldToULength=utf8->toULength;
+        toULimit = static_cast<int8_t>(utf8->mode);
+        c = static_cast<UChar32>(utf8->toUnicodeStatus);
+    } else {
+        toULength=oldToULength=toULimit=0;
+        c = 0;
+    }
+
+    // The conversion loop checks source<sourceLimit only once per 1/2/3-byte character.
+    // If the buffer ends with a truncated 2- or 3-byte sequence,
+    // then we reduce the sourceLimit to before that,
+    // and collect the remaining bytes after the conversion loop.
+    {
+        // Do not go back into the bytes that will be read for finishing a partial
+        // sequence from the previous buffer.
+        int32_t srcLength = static_cast<int32_t>(sourceLimit - source) - (toULimit - oldToULength);
+        if(srcLength>0) {
+            uint8_t b1=*(sourceLimit-1);
+            if(U8_IS_SINGLE(b1)) {
+                // common ASCII character
+            } else if(U8_IS_TRAIL(b1) && srcLength>=2) {
+                uint8_t b2=*(sourceLimit-2);
+                if(0xe0<=b2 && b2<0xf0 && U8_IS_VALID_LEAD3_AND_T1(b2, b1)) {
+                    // truncated 3-byte sequence
+                    sourceLimit-=2;
+                }
+            } else if(0xc2<=b1 && b1<0xf0) {
+                // truncated 2- or 3-byte sequence
+                --sourceLimit;
+            }
+        }
+    }
+
+    if(c!=0 && targetCapacity>0) {
+        utf8->toUnicodeStatus=0;
+        utf8->toULength=0;
+        goto moreBytes;
+        /* See note in ucnv_SBCSFromUTF8() about this goto. */
+    }
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(targetCapacity>0) {
+            b=*source++;
+            if(U8_IS_SINGLE(b)) {
+                if(IS_ASCII_ROUNDTRIP(b, asciiRoundtrips)) {
+                    /* convert ASCII, and copy the rest of a run of round-tripping ASCII */
+                    int32_t count;
+                    *target++=b;
+                    count=(int32_t)(sourceLimit-source);
+                    if(count>=targetCapacity) {
+                        count=targetCapacity-1;
+                    }
+                    count=ucnv_MBCSASCIIRunLength(source, count, asciiRoundtrips);
+                    uprv_memcpy(target, source, count);
+                    source+=count;
+                    target+=count;
+                    targetCapacity-=count+1;
+                    continue;
+                }
+                c=b;
+            } else if(b>=0xe0) {
+                if( /* handle U+0800..U+FFFF inline */
+                    b<0xf0 &&
+                    U8_IS_VALID_LEAD3_AND_T1(b, t1=source[0]) &&
+                    (t2 = static_cast<uint8_t>(source[1] - 0x80)) <= 0x3f
+                ) {
+                    c=((b&0xf)<<12)|((t1&0x3f)<<6)|t2;
+                    source+=2;
+                } else {
+                    c=-1;
+                }
+            } else {
+                if( /* handle U+0080..U+07FF inline */
+                    b>=0xc2 &&
+                    (t1 = static_cast<uint8_t>(*source - 0x80)) <= 0x3f
+                ) {
+                    c=((b&0x1f)<<6)|t1;
+                    ++source;
+                } else {
+                    c=-1;
+                }
+            }
+
+            if(c<0) {
+                /* handle "complicated" and error cases, and continuing partial characters */
+                oldToULength=0;
+                toULength=1;
+                toULimit=U8_COUNT_BYTES_NON_ASCII(b);
+                c=b;
+moreBytes:
+                while(toULength<toULimit) {
+                    /*
+                     * The sourceLimit may have been adjusted before the conversion loop
+                     * to stop before a truncated sequence.
+                     * Here we need to use the real limit in case we have two truncated
+                     * sequences at the end.
+                     * See ticket #7492.
+                     */
+                    if(source<(uint8_t *)pToUArgs->sourceLimit) {
+                        b=*source;
+                        if(icu::UTF8::isValidTrail(c, b, toULength, toULimit)) {
+                            ++source;
+                            ++toULength;
+                            c=(c<<6)+b;
+                        } else {
+                            break; /* sequence too short, stop with toULength<toULimit */
+                        }
+                    } else {
+                        /* store the partial UTF-8 character, compatible with the regular UTF-8 converter */
+                        source-=(toULength-oldToULength);
+                        while(oldToULength<toULength) {
+                            utf8->toUBytes[oldToULength++]=*source++;
+                        }
+                        utf8->toUnicodeStatus=c;
+                        utf8->toULength=toULength;
+                        utf8->mode=toULimit;
+                        pToUArgs->source=(char *)source;
+                        pFromUArgs->target = reinterpret_cast<char*>(target);
+                        return;
+                    }
+                }
+
+                if(toULength==toULimit) {
+                    c-=utf8_offsets[toULength];
+                    if(toULength>3 && !hasSupplementary) {
+                        /* BMP-only codepages are stored without stage 1 entries for supplementary code points */
+                        goto unassigned;
+                    }
+                } else {
+                    /* error handling: illegal UTF-8 byte sequence */
+                    source-=(toULength-oldToULength);
+                    while(oldToULength<toULength) {
+                        utf8->toUBytes[oldToULength++]=*source++;
+                    }
+                    utf8->toULength=toULength;
+                    pToUArgs->source=(char *)source;
+                    pFromUArgs->target = reinterpret_cast<char*>(target);
+                    *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+                    return;
+                }
+            }
+
+            /* get the bytes and the length for the output */
+            length=ucnv_MBCSGetBytesFromUTF8(cnv, bytes, c, &value);
+            if(length==0) {
+                goto unassigned;
+            }
+
+            /* write the output character bytes from value and length */
+            /* from the first if in the loop we know that targetCapacity>0 */
+            if(length<=targetCapacity) {
+                switch(length) {
+                    /* each branch falls through to the next one */
+                case 4:
+                    *target++=(uint8_t)(value>>24);
+                    U_FALLTHROUGH;
+                case 3:
+                    *target++=(uint8_t)(value>>16);
+                    U_FALLTHROUGH;
+                case 2:
+                    *target++=(uint8_t)(value>>8);
+                    U_FALLTHROUGH;
+                case 1:
+                    *target++=(uint8_t)value;
+                    U_FALLTHROUGH;
+                default:
+                    /* will never occur */
+                    break;
+                }
+                targetCapacity-=length;
+            } else {
+                uint8_t *charErrorBuffer;
+
+                /*
+                 * We actually do this backwards here:
+                 * In order to save an intermediate variable, we output
+                 * first to the overflow buffer what does not fit into the
+                 * regular target.
+                 */
+                /* we know that 1<=targetCapacity<length<=4 */
+                length-=targetCapacity;
+                charErrorBuffer=(uint8_t *)cnv->charErrorBuffer;
+                switch(length) {
+                    /* each branch falls through to the next one */
+                case 3:
+                    *charErrorBuffer++=(uint8_t)(value>>16);
+                    U_FALLTHROUGH;
+                case 2:
+                    *charErrorBuffer++=(uint8_t)(value>>8);
+                    U_FALLTHROUGH;
+                case 1:
+                    *charErrorBuffer=(uint8_t)value;
+                    U_FALLTHROUGH;
+                default:
+                    /* will never occur */
+                    break;
+                }
+                cnv->charErrorBufferLength=(int8_t)length;
+
+                /* now output what fits into the regular target */
+                value>>=8*length; /* length was reduced by targetCapacity */
+                switch(targetCapacity) {
+                    /* each branch falls through to the next one */
+                case 3:
+                    *target++=(uint8_t)(value>>16);
+                    U_FALLTHROUGH;
+                case 2:
+                    *target++=(uint8_t)(value>>8);
+                    U_FALLTHROUGH;
+                case 1:
+                    *target++=(uint8_t)value;
+                    U_FALLTHROUGH;
+                default:
+                    /* will never occur */
+                    break;
+                }
+
+                /* target overflow */
+                *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+                break;
+            }
+            continue;
+
+unassigned:
+            {
+                /*
+                 * Try an extension mapping.
+                 * Pass in no source because we don't have UTF-16 input.
+                 * If we have a partial match on c, we will return and revert
+                 * to UTF-8->UTF-16->charset conversion.
+                 */
+                static const char16_t nul=0;
+                const char16_t *noSource=&nul;
+                c=_extFromU(cnv, cnv->sharedData,
+                            c, &noSource, noSource,
+                            &target, target+targetCapacity,
+                            nullptr, -1,
+                            pFromUArgs->flush,
+                            pErrorCode);
+
+                if(U_FAILURE(*pErrorCode)) {
+                    /* not mappable or buffer overflow */
+                    cnv->fromUChar32=c;
+                    break;
+                } else if(cnv->preFromUFirstCP>=0) {
+                    /*
+                     * Partial match, return and revert to pivoting.
+                     * In normal from-UTF-16 conversion, we would just continue
+                     * but then exit the loop because the extension match would
+                     * have consumed the source.
+                     */
+                    *pErrorCode=U_USING_DEFAULT_WARNING;
+                    break;
+                } else {
+                    /* a mapping was written to the target, continue */
+
+                    /* recalculate the targetCapacity after an extension mapping */
+                    targetCapacity = static_cast<int32_t>(pFromUArgs->targetLimit - reinterpret_cast<char*>(target));
+                    continue;
+                }
+            }
+        } else {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+    }
+
+    /*
+     * The sourceLimit may have been adjusted before the conversion loop
+     * to stop before a truncated sequence.
+     * If so, then collect the truncated sequence now.
+     */
+    if(U_SUCCESS(*pErrorCode) &&
+            cnv->preFromUFirstCP<0 &&
+            source<(sourceLimit=(uint8_t *)pToUArgs->sourceLimit)) {
+        c=utf8->toUBytes[0]=b=*source++;
+        toULength=1;
+        toULimit=U8_COUNT_BYTES(b);
+        while(source<sourceLimit) {
+            utf8->toUBytes[toULength++]=b=*source++;
+            c=(c<<6)+b;
+        }
+        utf8->toUnicodeStatus=c;
+        utf8->toULength=toULength;
+        utf8->mode=toULimit;
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source=(char *)source;
+    pFromUArgs->target = reinterpret_cast<char*>(target);
+}
+
+/* MBCS-to-UTF-8 conversion functions ------------------------------------- */
+
+/*
+ * Minimum target capacity for ucnv_MBCSToUTF8() before it starts
+ * converting a character that is not round-tripping ASCII.
+ * An extension mapping can output up to UCNV_EXT_MAX_UCHARS UTF-16 code units,
+ * which take at most 3 UTF-8 bytes each.
+ * Below this capacity, the end of the target buffer is left to
+ * pivoting conversion, which handles the target overflow.
+ */
+#define MBCS_TO_UTF8_MIN_CAPACITY (3*UCNV_EXT_MAX_UCHARS)
+
+/*
+ * Direct MBCS-to-UTF-8 conversion for all codepages.
+ * Same state machine as ucnv_MBCSToUnicodeWithOffsets(), with the same
+ * state in the UConverter, but writing UTF-8 instead of UTF-16 output.
+ */
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode) {
+    UConverter *cnv;
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    int32_t targetCapacity;
+
+    const int32_t (*stateTable)[256];
+    const uint16_t *unicodeCodeUnits;
+    uint32_t asciiRoundtrips;
+
+    uint32_t offset;
+    uint8_t state;
+    int8_t byteIndex;
+    uint8_t *bytes;
+
+    int32_t entry;
+    UChar32 c;
+    uint8_t action;
+
+    /* set up the local pointers */
+    cnv=pToUArgs->converter;
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetCapacity=(int32_t)(pFromUArgs->targetLimit-pFromUArgs->target);
+
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+        asciiRoundtrips=0;
+    } else {
+        stateTable=cnv->sharedData->mbcs.stateTable;
+        asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    }
+    unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
+
+    /* get the converter state from UConverter */
+    offset=cnv->toUnicodeStatus;
+    byteIndex=cnv->toULength;
+    bytes=cnv->toUBytes;
+
+    /*
+     * if we are in the SBCS state for a DBCS-only converter,
+     * then load the DBCS state from the MBCS data
+     * (dbcsOnlyState==0 if it is not a DBCS-only converter)
+     */
+    if((state=(uint8_t)(cnv->mode))==0) {
+        state=cnv->sharedData->mbcs.dbcsOnlyState;
+    }
+
+    /*
+     * Revert to pivoting if the UTF-8 converter holds a lead surrogate
+     * from earlier pivoting conversion, or to finish a partial character
+     * near the end of the target buffer.
+     */
+    if(pFromUArgs->converter->fromUChar32!=0 ||
+            (byteIndex>0 && targetCapacity<MBCS_TO_UTF8_MIN_CAPACITY)) {
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(byteIndex==0) {
+            /* optimized loop for ASCII runs, and for 1/2-byte input with BMP output */
+            while(targetCapacity>=MBCS_TO_UTF8_MIN_CAPACITY) {
+                if(state==0 && *source<=0x7f && IS_ASCII_ROUNDTRIP(*source, asciiRoundtrips)) {
+                    /* copy a run of round-tripping ASCII */
+                    int32_t count=(int32_t)(sourceLimit-source);
+                    if(count>targetCapacity) {
+                        count=targetCapacity;
+                    }
+                    count=ucnv_MBCSASCIIRunLength(source, count, asciiRoundtrips);
+                    uprv_memcpy(target, source, count);
+                    source+=count;
+                    target+=count;
+                    targetCapacity-=count;
+                    if(source>=sourceLimit) {
+                        break;
+                    }
+                    continue;
+                }
+                entry=stateTable[state][*source];
+                if(MBCS_ENTRY_IS_TRANSITION(entry)) {
+                    state=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
+                    offset=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+
+                    ++source;
+                    if( source<sourceLimit &&
+                        MBCS_ENTRY_IS_FINAL(entry=stateTable[state][*source]) &&
+                        MBCS_ENTRY_FINAL_ACTION(entry)==MBCS_STATE_VALID_16 &&
+                        (c=unicodeCodeUnits[offset+MBCS_ENTRY_FINAL_VALUE_16(entry)])<0xfffe
+                    ) {
+                        ++source;
+                        state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+                        offset=0;
+                    } else {
+                        /* set the state and leave the optimized loop */
+                        bytes[0]=*(source-1);
+                        byteIndex=1;
+                        break;
+                    }
+                } else if(MBCS_ENTRY_FINAL_IS_VALID_DIRECT_16(entry)) {
+                    ++source;
+                    c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+                    state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+                } else {
+                    /* leave the optimized loop */
+                    break;
+                }
+
+                /* output the BMP code point */
+                if(c<=0x7f) {
+                    *target++=(uint8_t)c;
+                    --targetCapacity;
+                } else {
+                    int32_t length=0;
+                    U8_APPEND_UNSAFE(target, length, c);
+                    target+=length;
+                    targetCapacity-=length;
+                }
+                if(source>=sourceLimit) {
+                    break;
+                }
+            }
+
+            /*
+             * these tests and break statements could be put inside the loop
+             * if C had "break outerLoop" like Java
+             */
+            if(source>=sourceLimit) {
+                break;
+            }
+            if(byteIndex==0 && targetCapacity<MBCS_TO_UTF8_MIN_CAPACITY) {
+                /* leave the end of the target buffer to pivoting conversion */
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            }
+
+            /* the optimized loop set the entry for this byte */
+            bytes[byteIndex++]=*source++;
+        } else /* byteIndex>0 */ {
+            entry=stateTable[state][bytes[byteIndex++]=*source++];
+        }
+
+        if(MBCS_ENTRY_IS_TRANSITION(entry)) {
+            state=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
+            offset+=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+            continue;
+        }
+
+        /* save the previous state for proper extension mapping with SI/SO-stateful converters */
+        cnv->mode=state;
+
+        /* set the next state early so that we can reuse the entry variable */
+        state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+
+        /* get the code point c, or c<0 if the sequence is unassigned or illegal */
+        c=U_SENTINEL;
+        action=(uint8_t)(MBCS_ENTRY_FINAL_ACTION(entry));
+        if(action==MBCS_STATE_VALID_16) {
+            offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            c=unicodeCodeUnits[offset];
+            if(c<0xfffe) {
+                /* BMP code point */
+            } else if(c==0xfffe) {
+                if(UCNV_TO_U_USE_FALLBACK(cnv) && (entry=(int32_t)ucnv_MBCSGetFallback(&cnv->sharedData->mbcs, offset))!=0xfffe) {
+                    /* fallback BMP code point */
+                    c=entry;
+                } else {
+                    c=U_SENTINEL;
+                }
+            } else {
+                /* callback(illegal) */
+                *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+                c=U_SENTINEL;
+            }
+        } else if(action==MBCS_STATE_VALID_DIRECT_16) {
+            c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+        } else if(action==MBCS_STATE_VALID_16_PAIR) {
+            offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            c=unicodeCodeUnits[offset++];
+            if(c<0xd800) {
+                /* BMP code point below 0xd800 */
+            } else if(UCNV_TO_U_USE_FALLBACK(cnv) ? c<=0xdfff : c<=0xdbff) {
+                /* roundtrip or fallback supplementary code point */
+                c=U16_GET_SUPPLEMENTARY(c&0xdbff, unicodeCodeUnits[offset]);
+            } else if(UCNV_TO_U_USE_FALLBACK(cnv) ? (c&0xfffe)==0xe000 : c==0xe000) {
+                /* roundtrip BMP code point above 0xd800 or fallback BMP code point */
+                c=unicodeCodeUnits[offset];
+            } else {
+                if(c==0xffff) {
+                    /* callback(illegal) */
+                    *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+                }
+                c=U_SENTINEL;
+            }
+        } else if(action==MBCS_STATE_VALID_DIRECT_20 ||
+                  (action==MBCS_STATE_FALLBACK_DIRECT_20 && UCNV_TO_U_USE_FALLBACK(cnv))
+        ) {
+            c=(UChar32)(0x10000+MBCS_ENTRY_FINAL_VALUE(entry));
+        } else if(action==MBCS_STATE_CHANGE_ONLY) {
+            /*
+             * This serves as a state change without any output.
+             * See ucnv_MBCSToUnicodeWithOffsets().
+             */
+            if(cnv->sharedData->mbcs.dbcsOnlyState==0) {
+                byteIndex=0;
+            } else {
+                /* SI/SO are illegal for DBCS-only conversion */
+                state=(uint8_t)(cnv->mode); /* restore the previous state */
+
+                /* callback(illegal) */
+                *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+            }
+        } else if(action==MBCS_STATE_FALLBACK_DIRECT_16) {
+            if(UCNV_TO_U_USE_FALLBACK(cnv)) {
+                c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            }
+        } else if(action==MBCS_STATE_UNASSIGNED) {
+            /* just fall through */
+        } else if(action==MBCS_STATE_ILLEGAL) {
+            /* callback(illegal) */
+            *pErrorCode=U_ILLEGAL_CHAR_FOUND;
+        } else {
+            /* reserved, must never occur */
+            byteIndex=0;
+        }
+
+        /* end of action codes: prepare for a new character */
+        offset=0;
+
+        if(c>=0) {
+            /* output the code point; the target capacity was checked at the start of the character */
+            int32_t length=0;
+            U8_APPEND_UNSAFE(target, length, c);
+            target+=length;
+            targetCapacity-=length;
+            byteIndex=0;
+        } else if(byteIndex==0) {
+            /* state change only, or reserved action code */
+        } else if(U_FAILURE(*pErrorCode)) {
+            /* callback(illegal) */
+            if(cnv->sharedData->mbcs.countStates==1) {
+                /*
+                 * The single-byte toUnicode functions report an illegal byte
+                 * without setting it as the invalid input.
+                 * Back it out and let pivoting conversion handle it the same way.
+                 */
+                --source;
+                byteIndex=0;
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+            } else if(byteIndex>1) {
+                /*
+                 * Ticket 5691: consistent illegal sequences:
+                 * - We include at least the first byte in the illegal sequence.
+                 * - If any of the non-initial bytes could be the start of a character,
+                 *   we stop the illegal sequence before the first one of those.
+                 */
+                UBool isDBCSOnly=(UBool)(cnv->sharedData->mbcs.dbcsOnlyState!=0);
+                int8_t i;
+                for(i=1;
+                    i<byteIndex && !isSingleOrLead(stateTable, state, isDBCSOnly, bytes[i]);
+                    ++i) {}
+                if(i<byteIndex) {
+                    /* Back out some bytes. */
+                    int8_t backOutDistance=byteIndex-i;
+                    int32_t bytesFromThisBuffer=(int32_t)(source-(const uint8_t *)pToUArgs->source);
+                    byteIndex=i;  /* length of reported illegal byte sequence */
+                    if(backOutDistance<=bytesFromThisBuffer) {
+                        source-=backOutDistance;
+                    } else {
+                        /* Back out bytes from the previous buffer: Need to replay them. */
+                        cnv->preToULength=(int8_t)(bytesFromThisBuffer-backOutDistance);
+                        /* preToULength is negative! */
+                        uprv_memcpy(cnv->preToU, bytes+i, -cnv->preToULength);
+                        source=(const uint8_t *)pToUArgs->source;
+                    }
+                }
+            }
+            break;
+        } else /* unassigned sequences indicated with byteIndex>0 */ {
+            /* try an extension mapping into a UTF-16 buffer, then write it as UTF-8 */
+            char16_t buffer[UCNV_EXT_MAX_UCHARS];
+            char16_t *t16=buffer;
+            int32_t i, length16;
+
+            byteIndex=_extToU(cnv, cnv->sharedData,
+                              byteIndex, &source, sourceLimit,
+                              &t16, buffer+UCNV_EXT_MAX_UCHARS,
+                              nullptr, -1,
+                              pToUArgs->flush,
+                              pErrorCode);
+            if(U_FAILURE(*pErrorCode)) {
+                /* not mappable */
+                break;
+            }
+
+            length16=(int32_t)(t16-buffer);
+            for(i=0; i<length16;) {
+                int32_t length=0;
+                U16_NEXT(buffer, i, length16, c);
+                U8_APPEND_UNSAFE(target, length, c);
+                target+=length;
+                targetCapacity-=length;
+            }
+            if(cnv->preToULength>0) {
+                /* partial match at the end of the input, continue with pivoting */
+                break;
+            }
+        }
+    }
+
+    /* set the converter state back into UConverter */
+    cnv->toUnicodeStatus=offset;
+    cnv->mode=state;
+    cnv->toULength=byteIndex;
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 /* miscellaneous ------------------------------------------------------------ */
 
 static void U_CALLCONV
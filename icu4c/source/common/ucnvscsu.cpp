@@ -153,6 +153,41 @@ enum {
     lGeneric, l_ja
 };
 
+/*
+ * Single-window fast path for the encoder.
+ *
+ * In single-byte mode, a run of US-ASCII graphic characters, CR/LF/TAB/NUL
+ * and characters in the current dynamic window encodes to one byte each
+ * and does not change the state.
+ * The caller clamps the run length to both the source and the target,
+ * so the loop needs no per-unit capacity checks,
+ * and the offsets are written in one go after the run.
+ */
+
+/**
+ * Encodes the prefix of source code units that are either passed through
+ * (US-ASCII graphic characters, DEL, CR/LF/TAB/NUL) or are in the current dynamic window at offset.
+ * @return the number of code units converted, 0<=count<=length
+ */
+static inline int32_t
+encodeSingleWindowRun(const char16_t *source, uint8_t *target, int32_t length, uint32_t offset) {
+    int32_t i;
+    for(i=0; i<length; ++i) {
+        uint32_t c=source[i], delta;
+        if((c-0x20)<=0x5f) {
+            target[i]=(uint8_t)c;
+        } else if((delta=c-offset)<=0x7f) {
+            target[i]=(uint8_t)(delta|0x80);
+        } else if(c<0x20 && ((1UL<<c)&0x2601)!=0) {
+            /* CR/LF/TAB/NUL */
+            target[i]=(uint8_t)c;
+        } else {
+            break;
+        }
+    }
+    return i;
+}
+
 /* SCSU setup functions ----------------------------------------------------- */
 U_CDECL_BEGIN
 static void U_CALLCONV
@@ -1060,6 +1095,27 @@ _SCSUFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
             goto getTrailSingle;
         }
 
+        /* bulk-encode a run of characters within the current window */
+        if(source<sourceLimit && ((uint32_t)(*source-0x20)<=0x5f || (uint32_t)(*source-currentOffset)<=0x7f)) {
+            int32_t count=(int32_t)(sourceLimit-source);
+            if(count>targetCapacity) {
+                count=targetCapacity;
+            }
+            count=encodeSingleWindowRun(source, target, count, currentOffset);
+            if(count>0) {
+                if(offsets!=nullptr) {
+                    for(int32_t i=0; i<count; ++i) {
+                        *offsets++=sourceIndex+i;
+                    }
+                }
+                source+=count;
+                target+=count;
+                targetCapacity-=count;
+                nextSourceIndex+=count;
+                sourceIndex=nextSourceIndex;
+            }
+        }
+
         /* state machine for single-byte mode */
 /* singleByteMode: */
         while(source<sourceLimit) {
@@ -1560,6 +1616,18 @@ _SCSUFromUnicode(UConverterFromUnicodeArgs *pArgs,
             goto getTrailSingle;
         }
 
+        /* bulk-encode a run of characters within the current window */
+        if(source<sourceLimit && ((uint32_t)(*source-0x20)<=0x5f || (uint32_t)(*source-currentOffset)<=0x7f)) {
+            int32_t count=(int32_t)(sourceLimit-source);
+            if(count>targetCapacity) {
+                count=targetCapacity;
+            }
+            count=encodeSingleWindowRun(source, target, count, currentOffset);
+            source+=count;
+            target+=count;
+            targetCapacity-=count;
+        }
+
         /* state machine for single-byte mode */
 /* singleByteMode: */
         while(source<sourceLimit) {
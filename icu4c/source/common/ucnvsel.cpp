@@ -601,8 +601,7 @@ U_CDECL_BEGIN
 
 static void U_CALLCONV
 ucnvsel_close_selector_iterator(UEnumeration *enumerator) {
-  uprv_free(((Enumerator*)(enumerator->context))->index);
-  uprv_free(enumerator->context);
+  // the Enumerator and its index share the UEnumeration's memory block
   uprv_free(enumerator);
 }
 
@@ -665,7 +664,7 @@ static const UEnumeration defaultEncodings = {
 
 // internal fn to intersect two sets of masks
 // returns whether the mask has reduced to all zeros
-static UBool intersectMasks(uint32_t* dest, const uint32_t* source1, int32_t len) {
+static inline UBool intersectMasks(uint32_t* dest, const uint32_t* source1, int32_t len) {
   int32_t i;
   uint32_t oredDest = 0;
   for (i = 0 ; i < len ; ++i) {
@@ -676,88 +675,65 @@ static UBool intersectMasks(uint32_t* dest, const uint32_t* source1, int32_t len
 
 // internal fn to count how many 1's are there in a mask
 // algorithm taken from  http://graphics.stanford.edu/~seander/bithacks.html
-static int16_t countOnes(uint32_t* mask, int32_t len) {
+// (counting bits set, in parallel)
+static int16_t countOnes(const uint32_t* mask, int32_t len) {
   int32_t i, totalOnes = 0;
   for (i = 0 ; i < len ; ++i) {
     uint32_t ent = mask[i];
-    for (; ent; totalOnes++)
-    {
-      ent &= ent - 1; // clear the least significant bit set
-    }
+    ent = ent - ((ent >> 1) & 0x55555555);
+    ent = (ent & 0x33333333) + ((ent >> 2) & 0x33333333);
+    totalOnes += (int32_t)((((ent + (ent >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24);
   }
   return static_cast<int16_t>(totalOnes);
 }
 
+// Remembers which rows of the bit vectors were already intersected into a mask.
+// Text uses few distinct rows, and intersecting with the same row again
+// changes nothing, so most code points skip the intersection altogether.
+// Direct-mapped: a collision only costs a redundant intersection.
+#define ROW_CACHE_SIZE 32
 
-/* internal function! */
-static UEnumeration *selectForMask(const UConverterSelector* sel,
-                                   uint32_t *theMask, UErrorCode *status) {
-  LocalMemory<uint32_t> mask(theMask);
-  // this is the context we will use. Store a table of indices to which
-  // encodings are legit.
-  LocalMemory<Enumerator> result(static_cast<Enumerator *>(uprv_malloc(sizeof(Enumerator))));
-  if (result.isNull()) {
-    *status = U_MEMORY_ALLOCATION_ERROR;
-    return nullptr;
-  }
-  result->index = nullptr;  // this will be allocated later!
-  result->length = result->cur = 0;
-  result->sel = sel;
+namespace {
 
-  LocalMemory<UEnumeration> en(static_cast<UEnumeration *>(uprv_malloc(sizeof(UEnumeration))));
-  if (en.isNull()) {
-    // TODO(markus): Combine Enumerator and UEnumeration into one struct.
-    *status = U_MEMORY_ALLOCATION_ERROR;
-    return nullptr;
-  }
-  memcpy(en.getAlias(), &defaultEncodings, sizeof(UEnumeration));
-  
-  int32_t columns = (sel->encodingsCount+31)/32;
-  int16_t numOnes = countOnes(mask.getAlias(), columns);
-  // now, we know the exact space we need for index
-  if (numOnes > 0) {
-    result->index = static_cast<int16_t*>(uprv_malloc(numOnes * sizeof(int16_t)));
-    if (result->index == nullptr) {
-      *status = U_MEMORY_ALLOCATION_ERROR;
-      return nullptr;
+class RowCache {
+public:
+  RowCache() {
+    for (int32_t i = 0; i < ROW_CACHE_SIZE; ++i) {
+      rows[i] = -1;
     }
-    int32_t i, j;
-    int16_t k = 0;
-    for (j = 0 ; j < columns; j++) {
-      uint32_t v = mask[j];
-      for (i = 0 ; i < 32 && k < sel->encodingsCount; i++, k++) {
-        if ((v & 1) != 0) {
-          result->index[result->length++] = k;
-        }
-        v >>= 1;
-      }
+    ascii[0] = ascii[1] = ascii[2] = ascii[3] = 0;
+  }
+  // An ASCII character that was seen before needs neither the trie lookup
+  // nor the row check.
+  // returns true if the ASCII character was not seen before, and remembers it
+  inline UBool addASCII(int32_t c) {
+    uint32_t bit = static_cast<uint32_t>(1) << (c & 31);
+    if ((ascii[c >> 5] & bit) != 0) {
+      return false;
     }
-  } //otherwise, index will remain nullptr (and will never be touched by
-    //the enumerator code anyway)
-  en->context = result.orphan();
-  return en.orphan();
-}
-
-/* check a string against the selector - UTF16 version */
-U_CAPI UEnumeration * U_EXPORT2
-ucnvsel_selectForString(const UConverterSelector* sel,
-                        const char16_t *s, int32_t length, UErrorCode *status) {
-  // check if already failed
-  if (U_FAILURE(*status)) {
-    return nullptr;
-  }
-  // ensure args make sense!
-  if (sel == nullptr || (s == nullptr && length != 0)) {
-    *status = U_ILLEGAL_ARGUMENT_ERROR;
-    return nullptr;
+    ascii[c >> 5] |= bit;
+    return true;
+  }
+  // returns true if the row was not seen before, and remembers it
+  inline UBool add(uint16_t pvIndex) {
+    int32_t *row = rows + ((pvIndex * 0x9E3779B1u) >> 27);
+    if (*row == pvIndex) {
+      return false;
+    }
+    *row = pvIndex;
+    return true;
   }
+private:
+  int32_t rows[ROW_CACHE_SIZE];
+  uint32_t ascii[4];
+};
 
+}  // namespace
+
+// internal fn to compute the mask for a UTF-16 string, see ucnvsel_selectForString()
+static void selectMask(const UConverterSelector* sel, uint32_t* mask,
+                       const char16_t *s, int32_t length) {
   int32_t columns = (sel->encodingsCount+31)/32;
-  uint32_t* mask = (uint32_t*) uprv_malloc(columns * 4);
-  if (mask == nullptr) {
-    *status = U_MEMORY_ALLOCATION_ERROR;
-    return nullptr;
-  }
   uprv_memset(mask, ~0, columns *4);
 
   if(s!=nullptr) {
@@ -767,23 +743,94 @@ ucnvsel_selectForString(const UConverterSelector* sel,
     } else {
       limit = nullptr;
     }
-    
+    RowCache seen;
+
     while (limit == nullptr ? *s != 0 : s != limit) {
       UChar32 c;
       uint16_t pvIndex;
+      if (*s < 0x80 && !seen.addASCII(*s)) {
+        ++s;
+        continue;
+      }
       UTRIE2_U16_NEXT16(sel->trie, s, limit, c, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
+      if (seen.add(pvIndex) && intersectMasks(mask, sel->pv+pvIndex, columns)) {
         break;
       }
     }
   }
-  return selectForMask(sel, mask, status);
 }
 
-/* check a string against the selector - UTF8 version */
-U_CAPI UEnumeration * U_EXPORT2
-ucnvsel_selectForUTF8(const UConverterSelector* sel,
-                      const char *s, int32_t length, UErrorCode *status) {
+// internal fn to compute the mask for a UTF-8 string, see ucnvsel_selectForUTF8()
+static void selectMask(const UConverterSelector* sel, uint32_t* mask,
+                       const char *s, int32_t length) {
+  int32_t columns = (sel->encodingsCount+31)/32;
+  uprv_memset(mask, ~0, columns *4);
+
+  if(s!=nullptr) {
+    if (length < 0) {
+      length = (int32_t)uprv_strlen(s);
+    }
+    const char *limit = s + length;
+    RowCache seen;
+
+    while (s != limit) {
+      uint16_t pvIndex;
+      if (U8_IS_SINGLE(*s) && !seen.addASCII(static_cast<uint8_t>(*s))) {
+        ++s;
+        continue;
+      }
+      UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex);
+      if (seen.add(pvIndex) && intersectMasks(mask, sel->pv+pvIndex, columns)) {
+        break;
+      }
+    }
+  }
+}
+
+/* internal function! */
+static UEnumeration *selectForMask(const UConverterSelector* sel,
+                                   const uint32_t *mask, UErrorCode *status) {
+  int32_t columns = (sel->encodingsCount+31)/32;
+  int16_t numOnes = countOnes(mask, columns);
+  // Allocate the enumeration, its context and the table of indices
+  // to which encodings are legit in one block.
+  UEnumeration *en = static_cast<UEnumeration *>(
+      uprv_malloc(sizeof(UEnumeration) + sizeof(Enumerator) + numOnes * sizeof(int16_t)));
+  if (en == nullptr) {
+    *status = U_MEMORY_ALLOCATION_ERROR;
+    return nullptr;
+  }
+  memcpy(en, &defaultEncodings, sizeof(UEnumeration));
+
+  Enumerator *result = reinterpret_cast<Enumerator *>(en + 1);
+  result->index = reinterpret_cast<int16_t *>(result + 1);
+  result->cur = 0;
+  result->sel = sel;
+
+  // local copies: stores into the index could otherwise alias the counters
+  int16_t* index = result->index;
+  int32_t encodingsCount = sel->encodingsCount;
+  int32_t j, k, length = 0;
+  for (j = 0 ; j < columns && length < numOnes; j++) {
+    uint32_t v = mask[j];
+    for (k = j * 32; v != 0 && k < encodingsCount; k++) {
+      if ((v & 1) != 0) {
+        index[length++] = static_cast<int16_t>(k);
+      }
+      v >>= 1;
+    }
+  }
+  result->length = static_cast<int16_t>(length);
+  en->context = result;
+  return en;
+}
+
+// Most selectors have at most 16*32 encodings, and their masks fit on the stack.
+typedef MaybeStackArray<uint32_t, 16> SelectorMask;
+
+template<typename CharType>
+static UEnumeration *selectForString(const UConverterSelector* sel,
+                                     const CharType *s, int32_t length, UErrorCode *status) {
   // check if already failed
   if (U_FAILURE(*status)) {
     return nullptr;
@@ -794,30 +841,92 @@ ucnvsel_selectForUTF8(const UConverterSelector* sel,
     return nullptr;
   }
 
+  SelectorMask mask;
   int32_t columns = (sel->encodingsCount+31)/32;
-  uint32_t* mask = (uint32_t*) uprv_malloc(columns * 4);
-  if (mask == nullptr) {
+  if (columns > mask.getCapacity() && mask.resize(columns) == nullptr) {
     *status = U_MEMORY_ALLOCATION_ERROR;
     return nullptr;
   }
-  uprv_memset(mask, ~0, columns *4);
+  selectMask(sel, mask.getAlias(), s, length);
+  return selectForMask(sel, mask.getAlias(), status);
+}
 
-  if (length < 0) {
-    length = (int32_t)uprv_strlen(s);
+template<typename CharType>
+static void selectForStrings(const UConverterSelector* sel,
+                             const CharType* const strings[], const int32_t lengths[],
+                             int32_t count, UEnumeration* results[], UErrorCode* status) {
+  // all results are nullptr on failure
+  int32_t i;
+  if (results != nullptr) {
+    for (i = 0; i < count; ++i) {
+      results[i] = nullptr;
+    }
+  }
+  // check if already failed
+  if (U_FAILURE(*status)) {
+    return;
+  }
+  // ensure args make sense!
+  if (sel == nullptr || count < 0 || (count > 0 && (strings == nullptr || results == nullptr))) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return;
+  }
+  for (i = 0; i < count; ++i) {
+    if (strings[i] == nullptr && (lengths == nullptr || lengths[i] != 0)) {
+      *status = U_ILLEGAL_ARGUMENT_ERROR;
+      return;
+    }
   }
 
-  if(s!=nullptr) {
-    const char *limit = s + length;
-    
-    while (s != limit) {
-      uint16_t pvIndex;
-      UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
-        break;
+  // one mask for all of the strings
+  SelectorMask mask;
+  int32_t columns = (sel->encodingsCount+31)/32;
+  if (columns > mask.getCapacity() && mask.resize(columns) == nullptr) {
+    *status = U_MEMORY_ALLOCATION_ERROR;
+    return;
+  }
+  for (i = 0; i < count; ++i) {
+    selectMask(sel, mask.getAlias(), strings[i], lengths != nullptr ? lengths[i] : -1);
+    results[i] = selectForMask(sel, mask.getAlias(), status);
+    if (U_FAILURE(*status)) {
+      while (i > 0) {
+        --i;
+        uenum_close(results[i]);
+        results[i] = nullptr;
       }
+      return;
     }
   }
-  return selectForMask(sel, mask, status);
+}
+
+/* check a string against the selector - UTF16 version */
+U_CAPI UEnumeration * U_EXPORT2
+ucnvsel_selectForString(const UConverterSelector* sel,
+                        const char16_t *s, int32_t length, UErrorCode *status) {
+  return selectForString(sel, s, length, status);
+}
+
+/* check a string against the selector - UTF8 version */
+U_CAPI UEnumeration * U_EXPORT2
+ucnvsel_selectForUTF8(const UConverterSelector* sel,
+                      const char *s, int32_t length, UErrorCode *status) {
+  return selectForString(sel, s, length, status);
+}
+
+/* check many strings against the selector - UTF16 version */
+U_CAPI void U_EXPORT2
+ucnvsel_selectForStrings(const UConverterSelector* sel,
+                         const char16_t* const strings[], const int32_t lengths[],
+                         int32_t count, UEnumeration* results[], UErrorCode* status) {
+  selectForStrings(sel, strings, lengths, count, results, status);
+}
+
+/* check many strings against the selector - UTF8 version */
+U_CAPI void U_EXPORT2
+ucnvsel_selectForUTF8Strings(const UConverterSelector* sel,
+                             const char* const strings[], const int32_t lengths[],
+                             int32_t count, UEnumeration* results[], UErrorCode* status) {
+  selectForStrings(sel, strings, lengths, count, results, status);
 }
 
 #endif  // !UCONFIG_NO_CONVERSION
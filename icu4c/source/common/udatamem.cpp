@@ -118,8 +118,7 @@ udata_getMemory(UDataMemory *pData) {
  * For example, the length of the last item in a .dat package could be
  * computed from the size of the whole .dat package minus the offset of the
  * last item.
- * The size of a file that was directly memory-mapped could be determined
- * using some system API.
+ * The length of a directly memory-mapped file is the size of the file.
  *
  * In order to get perfect values for all data items, we may have to add a
  * length field to UDataInfo, but that complicates data generation
@@ -127,7 +126,7 @@ udata_getMemory(UDataMemory *pData) {
  *
  * @param pData The data item.
  * @return the length of the data item, or -1 if not known
- * @internal Currently used only in cintltst/udatatst.c
+ * @internal Used for collation data and in cintltst/udatatst.c
  */
 U_CAPI int32_t U_EXPORT2
 udata_getLength(const UDataMemory *pData) {
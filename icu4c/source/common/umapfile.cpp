@@ -171,6 +171,13 @@ typedef HANDLE MemoryMap;
             return false;
         }
 
+        /* determine the length of the file, for udata_getLength() */
+        LARGE_INTEGER fileSize;
+        int32_t length = -1;
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart <= INT32_MAX) {
+            length = static_cast<int32_t>(fileSize.QuadPart);
+        }
+
         // Note: We use nullptr/nullptr for lpAttributes parameter below.
         // This means our handle cannot be inherited and we will get the default security descriptor.
         /* create an unnamed Windows file-mapping object for the specified file */
@@ -193,6 +200,7 @@ typedef HANDLE MemoryMap;
             return false;
         }
         pData->map = map;
+        pData->length = length;
         return true;
     }
 
@@ -249,6 +257,7 @@ typedef HANDLE MemoryMap;
         pData->map = (char *)data + length;
         pData->pHeader=(const DataHeader *)data;
         pData->mapAddr = data;
+        pData->length = length;
 #if U_PLATFORM == U_PF_IPHONE
         posix_madvise(data, length, POSIX_MADV_RANDOM);
 #endif
@@ -327,6 +336,7 @@ typedef HANDLE MemoryMap;
         pData->map=p;
         pData->pHeader=(const DataHeader *)p;
         pData->mapAddr=p;
+        pData->length=fileLength;
         return true;
     }
 
@@ -467,6 +477,7 @@ typedef HANDLE MemoryMap;
             pData->map = (char *)data + length;
             pData->pHeader=(const DataHeader *)data;
             pData->mapAddr = data;
+            pData->length = length;
             return true;
         }
 
@@ -0,0 +1,191 @@
+// © 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// transcoder.h
+
+#ifndef __TRANSCODER_H__
+#define __TRANSCODER_H__
+
+#include "unicode/utypes.h"
+
+#if U_SHOW_CPLUSPLUS_API
+
+#if !UCONFIG_NO_CONVERSION
+
+#include "unicode/bytestream.h"
+#include "unicode/stringpiece.h"
+#include "unicode/ucnv.h"
+#include "unicode/uobject.h"
+
+/**
+ * \file
+ * \brief C++ API: Streaming conversion from one charset to another.
+ */
+
+U_NAMESPACE_BEGIN
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Streaming conversion of bytes in one charset to bytes in another charset,
+ * for example between buffers of an asynchronous I/O loop.
+ *
+ * A Transcoder owns a pair of converters and the small UTF-16 pivot buffer
+ * that ucnv_convertEx() needs, so that the caller only handles its own byte buffers.
+ * Each transcode() call converts as much as fits from a source byte range
+ * into a target byte range and advances both.
+ * When the target is full, transcode() returns true rather than an error,
+ * and the partial state stays in the Transcoder until the caller makes room.
+ * Bytes that have been consumed from the source can be released immediately,
+ * so the source and target can be segments of caller-owned ring buffers:
+ * call transcode() once per contiguous segment.
+ *
+ * Conversion from or to UTF-8 uses the converters' direct UTF-8 paths where available,
+ * without going through UTF-16.
+ *
+ * Conversion errors are handled by the converter callbacks,
+ * which substitute by default; see getSourceConverter() and getTargetConverter().
+ *
+ * A Transcoder is not thread-safe.
+ *
+ * \code
+ * Transcoder transcoder("Shift_JIS", "UTF-8", errorCode);
+ * // for each chunk of input
+ * const char *source = in, *sourceLimit = in + inLength;
+ * UBool more;
+ * do {
+ *     char *target = out;
+ *     more = transcoder.transcode(source, sourceLimit, target, out + outCapacity, atEnd, errorCode);
+ *     write(out, target - out);
+ * } while (more && U_SUCCESS(errorCode));
+ * \endcode
+ *
+ * @draft ICU 76
+ */
+class U_COMMON_API Transcoder : public UMemory {
+public:
+    /**
+     * Opens converters for the source and target charsets.
+     * @param sourceCharset name of the charset of the input bytes, as for ucnv_open()
+     * @param targetCharset name of the charset of the output bytes, as for ucnv_open()
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @draft ICU 76
+     */
+    Transcoder(const char *sourceCharset, const char *targetCharset, UErrorCode &errorCode);
+
+    /**
+     * Destructor. Closes the converters.
+     * @draft ICU 76
+     */
+    ~Transcoder();
+
+    /** Copying is not supported. @draft ICU 76 */
+    Transcoder(const Transcoder &) = delete;
+    /** Copying is not supported. @draft ICU 76 */
+    Transcoder &operator=(const Transcoder &) = delete;
+
+    /**
+     * Converts bytes from [source, sourceLimit) into [target, targetLimit)
+     * and advances source and target past the consumed and produced bytes.
+     *
+     * Returns true if the conversion stopped because the target is full.
+     * In that case, call this function again with more target space
+     * and the rest of the source (or an empty source).
+     * Returns false if all of the source was consumed and all output was written.
+     *
+     * With flush=true, the source is the end of the input stream:
+     * Partial input sequences are reported as errors, stateful encodings
+     * return to their initial state, and once this function returns false
+     * the Transcoder is ready for a new stream.
+     *
+     * Unlike ucnv_convertEx(), this function never writes past the produced output
+     * (no NUL termination).
+     *
+     * @param source in/out: start of the input bytes; advanced past the consumed bytes
+     * @param sourceLimit end of the input bytes
+     * @param target in/out: start of the output space; advanced past the produced bytes
+     * @param targetLimit end of the output space
+     * @param flush true if the source ends the input stream
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     *                  A conversion error stops the conversion;
+     *                  call reset() before continuing with other input.
+     * @return true if the target is full and more output is pending
+     * @draft ICU 76
+     */
+    UBool transcode(const char *&source, const char *sourceLimit,
+                    char *&target, const char *targetLimit,
+                    UBool flush, UErrorCode &errorCode);
+
+    /**
+     * Converts all of the source bytes and appends the output to the sink.
+     * The output is written into the sink's append buffers where it provides them.
+     * A ByteSink cannot refuse bytes, so there is no back-pressure.
+     *
+     * @param source input bytes
+     * @param sink output sink
+     * @param flush true if the source ends the input stream, see the other transcode()
+     * @param errorCode ICU error code in/out parameter.
+     *                  Must fulfill U_SUCCESS before the function call.
+     * @draft ICU 76
+     */
+    void transcode(StringPiece source, ByteSink &sink, UBool flush, UErrorCode &errorCode);
+
+    /**
+     * Resets the converters and discards pending output,
+     * and sets the byte counts to 0.
+     * @draft ICU 76
+     */
+    void reset();
+
+    /**
+     * @return the number of source bytes consumed since construction or reset()
+     * @draft ICU 76
+     */
+    int64_t getSourceBytesConsumed() const { return sourceBytesConsumed; }
+
+    /**
+     * @return the number of target bytes produced since construction or reset()
+     * @draft ICU 76
+     */
+    int64_t getTargetBytesProduced() const { return targetBytesProduced; }
+
+    /**
+     * Returns the converter for the source charset, for example for setting
+     * its toUnicode callback. It is owned by the Transcoder; do not close it.
+     * @return the source converter, or nullptr if construction failed
+     * @draft ICU 76
+     */
+    UConverter *getSourceConverter() { return sourceCnv; }
+
+    /**
+     * Returns the converter for the target charset, for example for setting
+     * its fromUnicode callback or substitution string.
+     * It is owned by the Transcoder; do not close it.
+     * @return the target converter, or nullptr if construction failed
+     * @draft ICU 76
+     */
+    UConverter *getTargetConverter() { return targetCnv; }
+
+private:
+    static constexpr int32_t PIVOT_CAPACITY = 1024;
+
+    UConverter *sourceCnv;
+    UConverter *targetCnv;
+    char16_t *pivotSource;
+    char16_t *pivotTarget;
+    int64_t sourceBytesConsumed;
+    int64_t targetBytesProduced;
+    char16_t pivotBuffer[PIVOT_CAPACITY];
+};
+
+#endif  // U_HIDE_DRAFT_API
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_CONVERSION
+
+#endif  // U_SHOW_CPLUSPLUS_API
+
+#endif  // __TRANSCODER_H__
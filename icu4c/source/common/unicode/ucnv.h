@@ -600,6 +600,110 @@ U_NAMESPACE_END
 
 #endif
 
+#ifndef U_HIDE_DRAFT_API
+
+struct UConverterPool;
+/**
+ * A pool of converters that can be reused without allocating them again.
+ * See ucnv_openPool().
+ * @draft ICU 76
+ */
+typedef struct UConverterPool UConverterPool;
+
+/**
+ * Opens a pool of reusable converters.
+ *
+ * ucnv_acquire() takes a converter for a name from the pool, or opens one,
+ * and ucnv_release() resets it and returns it to the pool.
+ * Released converters keep their UConverter storage and their references to
+ * the shared conversion tables, so that acquiring a converter for the same
+ * name again does not allocate memory.
+ *
+ * A pool is not thread-safe: Use one pool per thread, or synchronize access.
+ * The converters themselves may be used on any thread while they are acquired.
+ *
+ * @param capacity the maximum number of converters that the pool keeps
+ *                 (acquired and released); must be positive
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the pool, or NULL if an error occurred
+ * @see ucnv_closePool
+ * @draft ICU 76
+ */
+U_CAPI UConverterPool * U_EXPORT2
+ucnv_openPool(int32_t capacity, UErrorCode *pErrorCode);
+
+/**
+ * Closes a converter pool and all of the converters that it holds.
+ * Converters that are still acquired are closed as well,
+ * so all of them must have been released (or not be used any more).
+ *
+ * @param pool the pool to close; may be NULL
+ * @draft ICU 76
+ */
+U_CAPI void U_EXPORT2
+ucnv_closePool(UConverterPool *pool);
+
+/**
+ * Returns a converter for the given name, like ucnv_open().
+ * If the pool holds a released converter that was acquired with exactly the
+ * same name (including options), then that converter is returned.
+ * It was reset when it was released: Its conversion state is reset as with
+ * ucnv_reset(), its callbacks are the default callbacks, and its substitution
+ * characters and fallback setting are the ones it had after opening.
+ * Otherwise a new converter is opened and, if the pool has space, added to it.
+ *
+ * The converter must be returned with ucnv_release() to the same pool,
+ * not closed with ucnv_close().
+ *
+ * @param pool the converter pool
+ * @param converterName the converter name, as for ucnv_open();
+ *                      NULL for the default converter
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the converter, or NULL if an error occurred
+ * @see ucnv_release
+ * @see ucnv_open
+ * @draft ICU 76
+ */
+U_CAPI UConverter * U_EXPORT2
+ucnv_acquire(UConverterPool *pool, const char *converterName, UErrorCode *pErrorCode);
+
+/**
+ * Returns a converter from ucnv_acquire() to its pool.
+ * The converter is notified with UCNV_CLOSE as in ucnv_close(), and reset
+ * for reuse; it must not be used any more by the caller.
+ * If the pool does not hold this converter, then it is closed.
+ *
+ * @param pool the converter pool that the converter was acquired from
+ * @param converter the converter; may be NULL
+ * @see ucnv_acquire
+ * @draft ICU 76
+ */
+U_CAPI void U_EXPORT2
+ucnv_release(UConverterPool *pool, UConverter *converter);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUConverterPoolPointer
+ * "Smart pointer" class, closes a UConverterPool via ucnv_closePool().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 76
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUConverterPoolPointer, UConverterPool, ucnv_closePool);
+
+U_NAMESPACE_END
+
+#endif
+
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Fills in the output parameter, subChars, with the substitution characters
  * as multiple bytes.
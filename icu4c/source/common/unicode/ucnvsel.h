@@ -188,6 +188,54 @@ U_CAPI UEnumeration * U_EXPORT2
 ucnvsel_selectForUTF8(const UConverterSelector* sel,
                       const char *s, int32_t length, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Select converters for each of several UTF-16 strings.
+ * Equivalent to calling ucnvsel_selectForString() for each string,
+ * but with less overhead per string.
+ *
+ * @param sel a selector
+ * @param strings array of count UTF-16 strings
+ * @param lengths array of count string lengths (each -1 if NUL-terminated),
+ *                or NULL if all of the strings are NUL-terminated
+ * @param count number of strings
+ * @param results array of count elements; receives one enumeration of
+ *                encoding names for each string, as returned by
+ *                ucnvsel_selectForString(). The caller must close each of them.
+ *                On failure, all of the elements are set to NULL.
+ * @param status an in/out ICU UErrorCode
+ *
+ * @draft ICU 76
+ */
+U_CAPI void U_EXPORT2
+ucnvsel_selectForStrings(const UConverterSelector* sel,
+                         const UChar* const strings[], const int32_t lengths[],
+                         int32_t count, UEnumeration* results[], UErrorCode* status);
+
+/**
+ * Select converters for each of several UTF-8 strings.
+ * Equivalent to calling ucnvsel_selectForUTF8() for each string,
+ * but with less overhead per string.
+ *
+ * @param sel a selector
+ * @param strings array of count UTF-8 strings
+ * @param lengths array of count string lengths (each -1 if NUL-terminated),
+ *                or NULL if all of the strings are NUL-terminated
+ * @param count number of strings
+ * @param results array of count elements; receives one enumeration of
+ *                encoding names for each string, as returned by
+ *                ucnvsel_selectForUTF8(). The caller must close each of them.
+ *                On failure, all of the elements are set to NULL.
+ * @param status an in/out ICU UErrorCode
+ *
+ * @draft ICU 76
+ */
+U_CAPI void U_EXPORT2
+ucnvsel_selectForUTF8Strings(const UConverterSelector* sel,
+                             const char* const strings[], const int32_t lengths[],
+                             int32_t count, UEnumeration* results[], UErrorCode* status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #endif  /* !UCONFIG_NO_CONVERSION */
 
 #endif  /* __ICU_UCNV_SEL_H__ */
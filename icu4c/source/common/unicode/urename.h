@@ -627,6 +627,7 @@
 #define ucnv_MBCSIsLeadByte U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSIsLeadByte)
 #define ucnv_MBCSSimpleGetNextUChar U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSSimpleGetNextUChar)
 #define ucnv_MBCSToUnicodeWithOffsets U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSToUnicodeWithOffsets)
+#define ucnv_acquire U_ICU_ENTRY_POINT_RENAME(ucnv_acquire)
 #define ucnv_bld_countAvailableConverters U_ICU_ENTRY_POINT_RENAME(ucnv_bld_countAvailableConverters)
 #define ucnv_bld_getAvailableConverter U_ICU_ENTRY_POINT_RENAME(ucnv_bld_getAvailableConverter)
 #define ucnv_canCreateConverter U_ICU_ENTRY_POINT_RENAME(ucnv_canCreateConverter)
@@ -637,9 +638,11 @@
 #define ucnv_cbToUWriteUChars U_ICU_ENTRY_POINT_RENAME(ucnv_cbToUWriteUChars)
 #define ucnv_clone U_ICU_ENTRY_POINT_RENAME(ucnv_clone)
 #define ucnv_close U_ICU_ENTRY_POINT_RENAME(ucnv_close)
+#define ucnv_closePool U_ICU_ENTRY_POINT_RENAME(ucnv_closePool)
 #define ucnv_compareNames U_ICU_ENTRY_POINT_RENAME(ucnv_compareNames)
 #define ucnv_convert U_ICU_ENTRY_POINT_RENAME(ucnv_convert)
 #define ucnv_convertEx U_ICU_ENTRY_POINT_RENAME(ucnv_convertEx)
+#define ucnv_convertExUnterminated U_ICU_ENTRY_POINT_RENAME(ucnv_convertExUnterminated)
 #define ucnv_countAliases U_ICU_ENTRY_POINT_RENAME(ucnv_countAliases)
 #define ucnv_countAvailable U_ICU_ENTRY_POINT_RENAME(ucnv_countAvailable)
 #define ucnv_countStandards U_ICU_ENTRY_POINT_RENAME(ucnv_countStandards)
@@ -702,8 +705,10 @@
 #define ucnv_openAllNames U_ICU_ENTRY_POINT_RENAME(ucnv_openAllNames)
 #define ucnv_openCCSID U_ICU_ENTRY_POINT_RENAME(ucnv_openCCSID)
 #define ucnv_openPackage U_ICU_ENTRY_POINT_RENAME(ucnv_openPackage)
+#define ucnv_openPool U_ICU_ENTRY_POINT_RENAME(ucnv_openPool)
 #define ucnv_openStandardNames U_ICU_ENTRY_POINT_RENAME(ucnv_openStandardNames)
 #define ucnv_openU U_ICU_ENTRY_POINT_RENAME(ucnv_openU)
+#define ucnv_release U_ICU_ENTRY_POINT_RENAME(ucnv_release)
 #define ucnv_reset U_ICU_ENTRY_POINT_RENAME(ucnv_reset)
 #define ucnv_resetFromUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_resetFromUnicode)
 #define ucnv_resetToUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_resetToUnicode)
@@ -729,7 +734,9 @@
 #define ucnvsel_open U_ICU_ENTRY_POINT_RENAME(ucnvsel_open)
 #define ucnvsel_openFromSerialized U_ICU_ENTRY_POINT_RENAME(ucnvsel_openFromSerialized)
 #define ucnvsel_selectForString U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForString)
+#define ucnvsel_selectForStrings U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForStrings)
 #define ucnvsel_selectForUTF8 U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForUTF8)
+#define ucnvsel_selectForUTF8Strings U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForUTF8Strings)
 #define ucnvsel_serialize U_ICU_ENTRY_POINT_RENAME(ucnvsel_serialize)
 #define ucol_clone U_ICU_ENTRY_POINT_RENAME(ucol_clone)
 #define ucol_cloneBinary U_ICU_ENTRY_POINT_RENAME(ucol_cloneBinary)
@@ -759,6 +766,11 @@
 #define ucol_getRulesEx U_ICU_ENTRY_POINT_RENAME(ucol_getRulesEx)
 #define ucol_getShortDefinitionString U_ICU_ENTRY_POINT_RENAME(ucol_getShortDefinitionString)
 #define ucol_getSortKey U_ICU_ENTRY_POINT_RENAME(ucol_getSortKey)
+#define ucol_getSortKeyPrefix U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeyPrefix)
+#define ucol_getSortKeyPrefixUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeyPrefixUTF8)
+#define ucol_getSortKeyUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeyUTF8)
+#define ucol_getSortKeys U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeys)
+#define ucol_getSortKeysUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeysUTF8)
 #define ucol_getStrength U_ICU_ENTRY_POINT_RENAME(ucol_getStrength)
 #define ucol_getTailoredSet U_ICU_ENTRY_POINT_RENAME(ucol_getTailoredSet)
 #define ucol_getUCAVersion U_ICU_ENTRY_POINT_RENAME(ucol_getUCAVersion)
@@ -777,8 +789,10 @@
 #define ucol_openAvailableLocales U_ICU_ENTRY_POINT_RENAME(ucol_openAvailableLocales)
 #define ucol_openBinary U_ICU_ENTRY_POINT_RENAME(ucol_openBinary)
 #define ucol_openElements U_ICU_ENTRY_POINT_RENAME(ucol_openElements)
+#define ucol_openElementsUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_openElementsUTF8)
 #define ucol_openFromShortString U_ICU_ENTRY_POINT_RENAME(ucol_openFromShortString)
 #define ucol_openRules U_ICU_ENTRY_POINT_RENAME(ucol_openRules)
+#define ucol_openRulesCached U_ICU_ENTRY_POINT_RENAME(ucol_openRulesCached)
 #define ucol_prepareShortStringOpen U_ICU_ENTRY_POINT_RENAME(ucol_prepareShortStringOpen)
 #define ucol_previous U_ICU_ENTRY_POINT_RENAME(ucol_previous)
 #define ucol_primaryOrder U_ICU_ENTRY_POINT_RENAME(ucol_primaryOrder)
@@ -792,7 +806,9 @@
 #define ucol_setReorderCodes U_ICU_ENTRY_POINT_RENAME(ucol_setReorderCodes)
 #define ucol_setStrength U_ICU_ENTRY_POINT_RENAME(ucol_setStrength)
 #define ucol_setText U_ICU_ENTRY_POINT_RENAME(ucol_setText)
+#define ucol_setTextUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_setTextUTF8)
 #define ucol_setVariableTop U_ICU_ENTRY_POINT_RENAME(ucol_setVariableTop)
+#define ucol_sortStrings U_ICU_ENTRY_POINT_RENAME(ucol_sortStrings)
 #define ucol_strcoll U_ICU_ENTRY_POINT_RENAME(ucol_strcoll)
 #define ucol_strcollIter U_ICU_ENTRY_POINT_RENAME(ucol_strcollIter)
 #define ucol_strcollUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_strcollUTF8)
@@ -827,6 +843,7 @@
 #define ucsdet_open U_ICU_ENTRY_POINT_RENAME(ucsdet_open)
 #define ucsdet_setDeclaredEncoding U_ICU_ENTRY_POINT_RENAME(ucsdet_setDeclaredEncoding)
 #define ucsdet_setDetectableCharset U_ICU_ENTRY_POINT_RENAME(ucsdet_setDetectableCharset)
+#define ucsdet_setScanLimit U_ICU_ENTRY_POINT_RENAME(ucsdet_setScanLimit)
 #define ucsdet_setText U_ICU_ENTRY_POINT_RENAME(ucsdet_setText)
 #define ucurr_countCurrencies U_ICU_ENTRY_POINT_RENAME(ucurr_countCurrencies)
 #define ucurr_forLocale U_ICU_ENTRY_POINT_RENAME(ucurr_forLocale)
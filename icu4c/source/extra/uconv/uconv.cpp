@@ -35,6 +35,12 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include "cmemory.h"
 #include "cstring.h"
 #include "ustrfmt.h"
@@ -61,6 +67,14 @@ U_NAMESPACE_USE
 #endif
 #endif
 
+#if U_PLATFORM_IMPLEMENTS_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define UCONV_HAVE_MMAP 1
+#endif
+
 #ifdef UCONVMSG_LINK
 /* below from the README */
 #include "unicode/utypes.h"
@@ -69,6 +83,8 @@ U_CFUNC char uconvmsg_dat[];
 #endif
 
 #define DEFAULT_BUFSZ   4096
+#define MAPPED_CHUNK_SIZE (4 * 1024 * 1024)   /* Bytes per parallel work item. */
+#define MAPPED_SPLIT_WINDOW (64 * 1024)        /* How far back to look for an ASCII byte. */
 #define UCONVMSG "uconvmsg"
 
 static UResourceBundle *gBundle = nullptr; /* Bundle containing messages. */
@@ -531,11 +547,249 @@ cnvSigType(UConverter *cnv) {
     return result;
 }
 
+// report a conversion error from the input charset to Unicode
+static void
+printToUError(const char *pname, int64_t offset,
+              const char *errorBytes, int8_t errorLength, UErrorCode err) {
+    char pos[32];
+    int8_t i, length;
+
+    length = static_cast<int8_t>(snprintf(pos, sizeof(pos), "%lld", static_cast<long long>(offset)));
+
+    // output the bytes that caused the error
+    UnicodeString str;
+    for (i = 0; i < errorLength; ++i) {
+        if (i > 0) {
+            str.append(static_cast<char16_t>(uSP));
+        }
+        str.append(nibbleToHex(static_cast<uint8_t>(errorBytes[i]) >> 4));
+        str.append(nibbleToHex(static_cast<uint8_t>(errorBytes[i])));
+    }
+
+    initMsg(pname);
+    u_wmsg(stderr, "problemCvtToU",
+            UnicodeString(pos, length, "").getTerminatedBuffer(),
+            str.getTerminatedBuffer(),
+            u_wmsg_errorName(err));
+}
+
+// report a conversion error from Unicode to the output charset
+static void
+printFromUError(const char *pname, const char *errtag, int64_t offset,
+                const char16_t *errorUChars, int8_t errorLength, UErrorCode err) {
+    char pos[32];
+    UChar32 c;
+    int8_t i, length;
+
+    length = static_cast<int8_t>(snprintf(pos, sizeof(pos), "%lld", static_cast<long long>(offset)));
+
+    // output the code points that caused the error
+    UnicodeString str;
+    for (i = 0; i < errorLength;) {
+        if (i > 0) {
+            str.append(static_cast<char16_t>(uSP));
+        }
+        U16_NEXT(errorUChars, i, errorLength, c);
+        if (c >= 0x100000) {
+            str.append(nibbleToHex(static_cast<uint8_t>(c >> 20)));
+        }
+        if (c >= 0x10000) {
+            str.append(nibbleToHex(static_cast<uint8_t>(c >> 16)));
+        }
+        str.append(nibbleToHex(static_cast<uint8_t>(c >> 12)));
+        str.append(nibbleToHex(static_cast<uint8_t>(c >> 8)));
+        str.append(nibbleToHex(static_cast<uint8_t>(c >> 4)));
+        str.append(nibbleToHex(static_cast<uint8_t>(c)));
+    }
+
+    initMsg(pname);
+    u_wmsg(stderr, errtag,
+            UnicodeString(pos, length, "").getTerminatedBuffer(),
+            str.getTerminatedBuffer(),
+           u_wmsg_errorName(err));
+    u_wmsg(stderr, "errorUnicode", str.getTerminatedBuffer());
+}
+
+#if UCONV_HAVE_MMAP
+
+// Parallel conversion of a memory-mapped input file.
+//
+// The input is split into chunks which are converted independently
+// with cloned converters and written in order.
+// This is only equivalent to a sequential conversion if the input charset
+// can be split between characters without any context,
+// and if the output charset does not carry any state from one character
+// to the next.
+
+// can we find character boundaries in the input charset?
+static UBool
+isSplittableToUnicode(UConverterType type) {
+    switch (type) {
+    case UCNV_SBCS:
+    case UCNV_LATIN_1:
+    case UCNV_US_ASCII:
+    case UCNV_UTF8:
+    case UCNV_UTF16_BigEndian:
+    case UCNV_UTF16_LittleEndian:
+    case UCNV_UTF32_BigEndian:
+    case UCNV_UTF32_LittleEndian:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// is the output charset stateless so that chunk outputs can be concatenated?
+static UBool
+isStatelessFromUnicode(UConverterType type) {
+    switch (type) {
+    case UCNV_SBCS:
+    case UCNV_DBCS:
+    case UCNV_MBCS:
+    case UCNV_LATIN_1:
+    case UCNV_US_ASCII:
+    case UCNV_UTF8:
+    case UCNV_CESU8:
+    case UCNV_UTF16_BigEndian:
+    case UCNV_UTF16_LittleEndian:
+    case UCNV_UTF32_BigEndian:
+    case UCNV_UTF32_LittleEndian:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Returns a split point at or below limit and above start,
+// at a character boundary for the input charset.
+// For UTF-8, prefer to split after an ASCII byte so that truncated
+// sequences are diagnosed the same way as in a sequential conversion.
+static size_t
+findChunkLimit(UConverterType type, const uint8_t *bytes, size_t start, size_t limit) {
+    size_t i;
+    switch (type) {
+    case UCNV_UTF8:
+        for (i = limit; i > start && (limit - i) < MAPPED_SPLIT_WINDOW; --i) {
+            if (bytes[i - 1] < 0x80) {
+                return i;
+            }
+        }
+        // no ASCII nearby: split before a byte that is not a trail byte
+        for (i = limit; i > start && (limit - i) < 4; --i) {
+            if (!U8_IS_TRAIL(bytes[i])) {
+                return i;
+            }
+        }
+        return limit;
+    case UCNV_UTF16_BigEndian:
+    case UCNV_UTF16_LittleEndian:
+        // limit and start are even
+        if (limit - start >= 4) {
+            uint16_t unit = type == UCNV_UTF16_BigEndian ?
+                static_cast<uint16_t>((bytes[limit - 2] << 8) | bytes[limit - 1]) :
+                static_cast<uint16_t>((bytes[limit - 1] << 8) | bytes[limit - 2]);
+            if (U16_IS_LEAD(unit)) {
+                limit -= 2;
+            }
+        }
+        return limit;
+    default:
+        // single bytes and UTF-32: chunk sizes are multiples of the unit size
+        return limit;
+    }
+}
+
+enum {
+    CHUNK_OK,
+    CHUNK_FAILED    // a conversion error, or out of memory
+};
+
+// One piece of the mapped input and its converted output.
+struct MappedChunk {
+    const char *source;
+    size_t length;
+    uint64_t offset;    // of source in the input file
+
+    char *out;
+    size_t outLength, outCapacity;
+
+    int32_t result;
+    bool done;
+};
+
+static UBool
+growChunkOutput(MappedChunk &c) {
+    size_t capacity = c.outCapacity * 2 + 1024;
+    char *out = static_cast<char *>(uprv_realloc(c.out, capacity));
+    if (out == nullptr) {
+        c.result = CHUNK_FAILED;
+        return false;
+    }
+    c.out = out;
+    c.outCapacity = capacity;
+    return true;
+}
+
+// Convert one chunk.
+// Stops at the first error: the main thread then converts the rest of the
+// file sequentially from the start of this chunk, so that the output
+// and the error message are the same as in a sequential conversion.
+static void
+convertChunk(UConverter *convfrom, UConverter *convto, MappedChunk &c,
+             char16_t *unibuf, int32_t unibufsz) {
+    const char *cbufp = c.source;
+    const char *sourceLimit = c.source + c.length;
+    UErrorCode err = U_ZERO_ERROR;
+    UBool fromSawEndOfBytes, toSawEndOfUnicode;
+
+    c.out = nullptr;
+    c.outLength = c.outCapacity = 0;
+    if (!growChunkOutput(c)) {
+        return;
+    }
+
+    do {
+        char16_t *unibufp = unibuf;
+        ucnv_toUnicode(convfrom, &unibufp, unibuf + unibufsz, &cbufp,
+            sourceLimit, nullptr, true, &err);
+        fromSawEndOfBytes = U_SUCCESS(err);
+
+        if (err == U_BUFFER_OVERFLOW_ERROR) {
+            err = U_ZERO_ERROR;
+        } else if (U_FAILURE(err)) {
+            c.result = CHUNK_FAILED;
+            return;
+        }
+
+        const char16_t *unibufbp = unibuf;
+        do {
+            if (c.outCapacity - c.outLength < 1024 && !growChunkOutput(c)) {
+                return;
+            }
+            char *bufp = c.out + c.outLength;
+            ucnv_fromUnicode(convto, &bufp, c.out + c.outCapacity,
+                             &unibufbp, unibufp, nullptr,
+                             fromSawEndOfBytes, &err);
+            c.outLength = static_cast<size_t>(bufp - c.out);
+            toSawEndOfUnicode = U_SUCCESS(err);
+
+            if (err == U_BUFFER_OVERFLOW_ERROR) {
+                err = U_ZERO_ERROR;
+            } else if (U_FAILURE(err)) {
+                c.result = CHUNK_FAILED;
+                return;
+            }
+        } while (!toSawEndOfUnicode);
+    } while (!fromSawEndOfBytes);
+}
+
+#endif  // UCONV_HAVE_MMAP
+
 class ConvertFile {
 public:
     ConvertFile() :
         buf(nullptr), outbuf(nullptr), fromoffsets(nullptr),
-        bufsz(0), signature(0) {}
+        bufsz(0), signature(0), threads(1), stats(false) {}
 
     void
     setBufferSize(size_t bufferSize) {
@@ -567,13 +821,207 @@ class ConvertFile {
 private:
     friend int main(int argc, char **argv);
 
+    enum {
+        MAPPED_NOT_USED,    // the input cannot be converted in parallel
+        MAPPED_OK,
+        MAPPED_RESUME,      // convert sequentially from resumeOffset
+        MAPPED_ERROR
+    };
+
+    int32_t convertMapped(const char *pname, FILE *infile,
+                          UConverter *convfrom, UConverter *convto,
+                          FILE *outfile, int verbose,
+                          uint64_t &inLength, uint64_t &outLength,
+                          uint64_t &resumeOffset, int32_t &usedThreads);
+
     char *buf, *outbuf;
     int32_t *fromoffsets;
 
     size_t bufsz;
     int8_t signature; // add (1) or remove (-1) a U+FEFF Unicode signature character
+    int32_t threads;  // number of threads for converting an input file in parallel
+    UBool stats;      // print the conversion throughput for each input file
 };
 
+// Memory-map the input file and convert it in parallel if possible.
+// If a chunk cannot be converted, the output stops before that chunk,
+// and the caller converts the rest of the file sequentially.
+int32_t
+ConvertFile::convertMapped(const char *pname, FILE *infile,
+                           UConverter *convfrom, UConverter *convto,
+                           FILE *outfile, int verbose,
+                           uint64_t &inLength, uint64_t &outLength,
+                           uint64_t &resumeOffset, int32_t &usedThreads)
+{
+#if UCONV_HAVE_MMAP
+    UConverterType fromType = ucnv_getType(convfrom);
+    UConverterType toType = ucnv_getType(convto);
+    if (!isSplittableToUnicode(fromType) || !isStatelessFromUnicode(toType)) {
+        if (verbose) {
+            UErrorCode err = U_ZERO_ERROR;
+            const char *fromName = ucnv_getName(convfrom, &err);
+            const char *toName = ucnv_getName(convto, &err);
+            fprintf(stderr, "%s: cannot split the conversion from %s to %s, converting sequentially\n",
+                    pname, fromName, toName);
+        }
+        return MAPPED_NOT_USED;
+    }
+
+    int fd = fileno(infile);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+        static_cast<uint64_t>(st.st_size) > SIZE_MAX) {
+        return MAPPED_NOT_USED;
+    }
+    size_t fileLength = static_cast<size_t>(st.st_size);
+    void *mapping = mmap(nullptr, fileLength, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+        if (verbose) {
+            fprintf(stderr, "%s: cannot map the input file (%s), converting sequentially\n",
+                    pname, strerror(errno));
+        }
+        return MAPPED_NOT_USED;
+    }
+    const uint8_t *bytes = static_cast<const uint8_t *>(mapping);
+
+    // Split the input. Chunk sizes are multiples of 4 so that
+    // UTF-16 and UTF-32 chunks start at code unit boundaries.
+    std::vector<MappedChunk> chunks;
+    size_t start = 0;
+    while (start < fileLength) {
+        size_t limit = fileLength;
+        if (fileLength - start > MAPPED_CHUNK_SIZE) {
+            limit = findChunkLimit(fromType, bytes, start, start + MAPPED_CHUNK_SIZE);
+        }
+        MappedChunk c;
+        uprv_memset(&c, 0, sizeof(c));
+        c.source = reinterpret_cast<const char *>(bytes + start);
+        c.length = limit - start;
+        c.offset = start;
+        c.result = CHUNK_OK;
+        chunks.push_back(c);
+        start = limit;
+    }
+
+    int32_t count = static_cast<int32_t>(chunks.size());
+    usedThreads = threads < count ? threads : count;
+
+    // Clone the converters on this thread; a failure to do so is not fatal.
+    std::vector<UConverter *> converters;
+    UErrorCode err = U_ZERO_ERROR;
+    for (int32_t i = 0; i < usedThreads && U_SUCCESS(err); ++i) {
+        converters.push_back(ucnv_clone(convfrom, &err));
+        converters.push_back(ucnv_clone(convto, &err));
+    }
+    if (U_FAILURE(err)) {
+        for (UConverter *cnv : converters) {
+            ucnv_close(cnv);
+        }
+        munmap(mapping, fileLength);
+        return MAPPED_NOT_USED;
+    }
+
+    // Workers take the next chunk unless that would run too far ahead
+    // of the writer, which bounds the memory for buffered output.
+    std::mutex mutex;
+    std::condition_variable cond;
+    int32_t next = 0, written = 0, window = 2 * usedThreads;
+    bool stop = false;
+
+    // the intermediate Unicode buffer need not be as small as the read buffer
+    int32_t unibufsz = bufsz > 0x10000 ? static_cast<int32_t>(bufsz) : 0x10000;
+
+    std::vector<std::thread> workers;
+    for (int32_t w = 0; w < usedThreads; ++w) {
+        UConverter *from = converters[2 * w], *to = converters[2 * w + 1];
+        workers.emplace_back([&, from, to]() {
+            std::vector<char16_t> unibuf(unibufsz);
+            for (;;) {
+                int32_t i;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cond.wait(lock, [&]() { return stop || next >= count || next < written + window; });
+                    if (stop || next >= count) {
+                        return;
+                    }
+                    i = next++;
+                }
+                ucnv_reset(from);
+                ucnv_reset(to);
+                convertChunk(from, to, chunks[i], unibuf.data(), unibufsz);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    chunks[i].done = true;
+                }
+                cond.notify_all();
+            }
+        });
+    }
+
+    int32_t ret = MAPPED_OK;
+    for (int32_t i = 0; i < count; ++i) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock, [&]() { return chunks[i].done; });
+        }
+        MappedChunk &c = chunks[i];
+        if (c.result == CHUNK_OK) {
+            size_t wr = fwrite(c.out, 1, c.outLength, outfile);
+            outLength += wr;
+            inLength += c.length;
+            if (wr != c.outLength) {
+                UnicodeString str(strerror(errno));
+                initMsg(pname);
+                u_wmsg(stderr, "cantWrite", str.getTerminatedBuffer());
+                ret = MAPPED_ERROR;
+            }
+        } else {
+            // The sequential conversion reports errors at offsets that depend
+            // on its block boundaries; redo this chunk the same way.
+            resumeOffset = c.offset;
+            ret = MAPPED_RESUME;
+        }
+        uprv_free(c.out);
+        c.out = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            written = i + 1;
+            stop = ret != MAPPED_OK;
+        }
+        cond.notify_all();
+        if (ret != MAPPED_OK) {
+            break;
+        }
+    }
+
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    for (MappedChunk &c : chunks) {
+        uprv_free(c.out);
+    }
+    for (UConverter *cnv : converters) {
+        ucnv_close(cnv);
+    }
+    munmap(mapping, fileLength);
+    return ret;
+#else
+    (void)pname;
+    (void)infile;
+    (void)convfrom;
+    (void)convto;
+    (void)outfile;
+    (void)inLength;
+    (void)outLength;
+    (void)resumeOffset;
+    (void)usedThreads;
+    if (verbose) {
+        fprintf(stderr, "%s: parallel conversion is not supported on this platform\n", pname);
+    }
+    return MAPPED_NOT_USED;
+#endif
+}
+
 // Convert a file from one encoding to another
 UBool
 ConvertFile::convertFile(const char *pname,
@@ -598,12 +1046,21 @@ ConvertFile::convertFile(const char *pname,
     const char *cbufp, *prevbufp;
     char *bufp;
 
-    uint32_t infoffset = 0, outfoffset = 0;   /* Where we are in the file, for error reporting. */
+    uint64_t infoffset = 0;     /* Where we are in the file, for error reporting. */
+    uint32_t outfoffset = 0;
 
     const char16_t *unibuf, *unibufbp;
     char16_t *unibufp;
 
-    size_t rd, wr;
+    size_t rd, wr, toRead;
+
+    // for --stats
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    uint64_t inLength = 0, outLength = 0;
+    int32_t usedThreads = 1;
+
+    // where the sequential conversion starts
+    uint64_t resumeOffset = 0;
 
 #if !UCONFIG_NO_TRANSLITERATION
     Transliterator *t = nullptr;// Transliterator acting on Unicode data.
@@ -728,17 +1185,51 @@ ConvertFile::convertFile(const char *pname,
     UBool willexit, fromSawEndOfBytes, toSawEndOfUnicode;
     int8_t sig;
 
+    // Convert a regular input file in parallel if requested and possible,
+    // otherwise fall back to reading and converting it sequentially.
+    // A Unicode signature is only added or removed at the start of the text,
+    // which the sequential loop below handles.
+    // If part of the file cannot be converted in parallel, the sequential loop
+    // converts the rest so that it reports the same error.
+    if (threads > 1 && closeFile && useOffsets && signature == 0) {
+        switch (convertMapped(pname, infile, convfrom, convto, outfile, verbose,
+                              inLength, outLength, resumeOffset, usedThreads)) {
+        case MAPPED_OK:
+            goto normal_exit;
+        case MAPPED_ERROR:
+            goto error_exit;
+#if UCONV_HAVE_MMAP
+        case MAPPED_RESUME:
+            if (fseeko(infile, static_cast<off_t>(resumeOffset), SEEK_SET) != 0) {
+                UnicodeString str(strerror(errno));
+                initMsg(pname);
+                u_wmsg(stderr, "cantRead", str.getTerminatedBuffer());
+                goto error_exit;
+            }
+            break;
+#endif
+        default:
+            break;
+        }
+    }
+
     // OK, we can convert now.
     sig = signature;
+    infoffset = resumeOffset;
     rd = 0;
 
     do {
         willexit = false;
 
         // input file offset at the beginning of the next buffer
-        infoffset += static_cast<uint32_t>(rd);
-
-        rd = fread(buf, 1, bufsz, infile);
+        infoffset += rd;
+
+        // Read up to the next multiple of the buffer size.
+        // This is a whole buffer unless resuming after a parallel conversion,
+        // so that the buffer boundaries and error offsets are the same.
+        toRead = bufsz - static_cast<size_t>(infoffset % bufsz);
+        rd = fread(buf, 1, toRead, infile);
+        inLength += rd;
         if (ferror(infile) != 0) {
             UnicodeString str(strerror(errno));
             initMsg(pname);
@@ -758,7 +1249,7 @@ ConvertFile::convertFile(const char *pname,
         // that characters on hold also will be written.
 
         cbufp = buf;
-        flush = static_cast<UBool>(rd != bufsz);
+        flush = static_cast<UBool>(rd != toRead);
 
         // convert until the input is consumed
         do {
@@ -789,8 +1280,8 @@ ConvertFile::convertFile(const char *pname,
             if (err == U_BUFFER_OVERFLOW_ERROR) {
                 err = U_ZERO_ERROR;
             } else if (U_FAILURE(err)) {
-                char pos[32], errorBytes[32];
-                int8_t i, length, errorLength;
+                char errorBytes[32];
+                int8_t errorLength;
 
                 UErrorCode localError = U_ZERO_ERROR;
                 errorLength = static_cast<int8_t>(sizeof(errorBytes));
@@ -803,25 +1294,9 @@ ConvertFile::convertFile(const char *pname,
                 // input file offset of the current byte buffer +
                 // length of the just consumed bytes -
                 // length of the error bytes
-                length =
-                    static_cast<int8_t>(snprintf(pos, sizeof(pos), "%d",
-                        static_cast<int>(infoffset + (cbufp - buf) - errorLength)));
-
-                // output the bytes that caused the error
-                UnicodeString str;
-                for (i = 0; i < errorLength; ++i) {
-                    if (i > 0) {
-                        str.append(static_cast<char16_t>(uSP));
-                    }
-                    str.append(nibbleToHex(static_cast<uint8_t>(errorBytes[i]) >> 4));
-                    str.append(nibbleToHex(static_cast<uint8_t>(errorBytes[i])));
-                }
-
-                initMsg(pname);
-                u_wmsg(stderr, "problemCvtToU",
-                        UnicodeString(pos, length, "").getTerminatedBuffer(),
-                        str.getTerminatedBuffer(),
-                        u_wmsg_errorName(err));
+                printToUError(pname,
+                    static_cast<int64_t>(infoffset + (cbufp - buf)) - errorLength,
+                    errorBytes, errorLength, err);
 
                 willexit = true;
                 err = U_ZERO_ERROR; /* reset the error for the rest of the conversion. */
@@ -831,6 +1306,10 @@ ConvertFile::convertFile(const char *pname,
             // looping until it is; message key "premEndInput" now obsolete.
 
             if (ulen == 0) {
+                // do not convert the bytes after an error at the start of the buffer
+                if (willexit) {
+                    goto error_exit;
+                }
                 continue;
             }
 
@@ -941,9 +1420,7 @@ ConvertFile::convertFile(const char *pname,
                 } else if (U_FAILURE(err)) {
                     char16_t errorUChars[4];
                     const char *errtag;
-                    char pos[32];
-                    UChar32 c;
-                    int8_t i, length, errorLength;
+                    int8_t errorLength;
 
                     UErrorCode localError = U_ZERO_ERROR;
                     errorLength = UPRV_LENGTHOF(errorUChars);
@@ -953,9 +1430,11 @@ ConvertFile::convertFile(const char *pname,
                         errorLength = 1;
                     }
 
-                    int32_t ferroffset;
+                    int64_t erroffset;
 
                     if (useOffsets) {
+                        int32_t ferroffset;
+
                         // Unicode buffer offset of the start of the error UChars
                         ferroffset = static_cast<int32_t>((unibufbp - unibuf) - errorLength);
                         if (ferroffset < 0) {
@@ -974,44 +1453,18 @@ ConvertFile::convertFile(const char *pname,
                         // input file offset of the current byte buffer +
                         // byte buffer offset of where the current Unicode buffer is converted from +
                         // fromoffsets[Unicode offset]
-                        ferroffset = static_cast<int32_t>(infoffset + (prevbufp - buf) + fromoffset);
+                        erroffset = static_cast<int64_t>(infoffset + (prevbufp - buf)) + fromoffset;
                         errtag = "problemCvtFromU";
                     } else {
                         // Do not use fromoffsets if (t != nullptr) because the Unicode text may
                         // be different from what the offsets refer to.
 
                         // output file offset
-                        ferroffset = static_cast<int32_t>(outfoffset + (bufp - outbuf));
+                        erroffset = static_cast<int32_t>(outfoffset + (bufp - outbuf));
                         errtag = "problemCvtFromUOut";
                     }
 
-                    length = static_cast<int8_t>(snprintf(pos, sizeof(pos), "%u", static_cast<int>(ferroffset)));
-
-                    // output the code points that caused the error
-                    UnicodeString str;
-                    for (i = 0; i < errorLength;) {
-                        if (i > 0) {
-                            str.append(static_cast<char16_t>(uSP));
-                        }
-                        U16_NEXT(errorUChars, i, errorLength, c);
-                        if (c >= 0x100000) {
-                            str.append(nibbleToHex(static_cast<uint8_t>(c >> 20)));
-                        }
-                        if (c >= 0x10000) {
-                            str.append(nibbleToHex(static_cast<uint8_t>(c >> 16)));
-                        }
-                        str.append(nibbleToHex(static_cast<uint8_t>(c >> 12)));
-                        str.append(nibbleToHex(static_cast<uint8_t>(c >> 8)));
-                        str.append(nibbleToHex(static_cast<uint8_t>(c >> 4)));
-                        str.append(nibbleToHex(static_cast<uint8_t>(c)));
-                    }
-
-                    initMsg(pname);
-                    u_wmsg(stderr, errtag,
-                            UnicodeString(pos, length, "").getTerminatedBuffer(),
-                            str.getTerminatedBuffer(),
-                           u_wmsg_errorName(err));
-                    u_wmsg(stderr, "errorUnicode", str.getTerminatedBuffer());
+                    printFromUError(pname, errtag, erroffset, errorUChars, errorLength, err);
 
                     willexit = true;
                     err = U_ZERO_ERROR; /* reset the error for the rest of the conversion. */
@@ -1023,6 +1476,7 @@ ConvertFile::convertFile(const char *pname,
                 // Finally, write the converted buffer to the output file
                 size_t outlen = static_cast<size_t>(bufp - outbuf);
                 outfoffset += static_cast<int32_t>(wr = fwrite(outbuf, 1, outlen, outfile));
+                outLength += wr;
                 if (wr != outlen) {
                     UnicodeString str(strerror(errno));
                     initMsg(pname);
@@ -1045,6 +1499,17 @@ ConvertFile::convertFile(const char *pname,
     ret = false;
 
 normal_exit:
+    if (stats) {
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        fprintf(stderr, "%s: %llu bytes in, %llu bytes out, %.3f s, %.2f MB/s, %d thread%s\n",
+                infilestr,
+                static_cast<unsigned long long>(inLength),
+                static_cast<unsigned long long>(outLength),
+                seconds,
+                seconds > 0 ? static_cast<double>(inLength) / 1e6 / seconds : 0.0,
+                static_cast<int>(usedThreads), usedThreads == 1 ? "" : "s");
+    }
+
     // Cleanup.
 
     ucnv_close(convfrom);
@@ -1190,6 +1655,30 @@ main(int argc, char **argv)
             } else {
                 usage(pname, 1);
             }
+        } else if (strcmp("-j", *iter) == 0 || !strcmp("--parallel", *iter)) {
+            iter++;
+            if (iter != end) {
+                char *numEnd;
+                long count = strtol(*iter, &numEnd, 10);
+                if (numEnd == *iter || *numEnd != 0 || count < 0 || count > 1024) {
+                    UnicodeString str(*iter);
+                    initMsg(pname);
+                    u_wmsg(stderr, "badThreadCount", str.getTerminatedBuffer());
+                    return 3;
+                }
+                if (count == 0) {
+                    // as many threads as there are processors
+                    count = static_cast<long>(std::thread::hardware_concurrency());
+                    if (count == 0) {
+                        count = 1;
+                    }
+                }
+                cf.threads = static_cast<int32_t>(count);
+            } else {
+                usage(pname, 1);
+            }
+        } else if (!strcmp("--stats", *iter)) {
+            cf.stats = true;
         } else if (strcmp("-l", *iter) == 0 || !strcmp("--list", *iter)) {
             if (printTranslits) {
                 usage(pname, 1);
@@ -75,6 +75,35 @@ UnicodeString *ownedString(const UnicodeString &s, LocalPointer<UnicodeString> &
     return p;
 }
 
+/**
+ * Direct-mapped cache from a name's first code point to its bucket,
+ * or to -1 if the bucket depends on more of the name.
+ */
+class FirstCharBuckets : public UMemory {
+public:
+    FirstCharBuckets() {
+        for (int32_t i = 0; i < CAPACITY; ++i) {
+            chars_[i] = U_SENTINEL;
+        }
+    }
+
+    int32_t *find(UChar32 c) {
+        int32_t i = (c ^ (c >> 10)) & (CAPACITY - 1);
+        return chars_[i] == c ? bucketIndexes_ + i : nullptr;
+    }
+
+    void put(UChar32 c, int32_t bucketIndex) {
+        int32_t i = (c ^ (c >> 10)) & (CAPACITY - 1);
+        chars_[i] = c;
+        bucketIndexes_[i] = bucketIndex;
+    }
+
+private:
+    static constexpr int32_t CAPACITY = 512;
+    UChar32 chars_[CAPACITY];
+    int32_t bucketIndexes_[CAPACITY];
+};
+
 inline UnicodeString *getString(const UVector &list, int32_t i) {
     return static_cast<UnicodeString *>(list[i]);
 }
@@ -142,8 +171,43 @@ class BucketList : public UObject {
     }
 
     int32_t getBucketIndex(const UnicodeString &name, const Collator &collatorPrimaryOnly,
-                           UErrorCode &errorCode) {
-        // binary search
+                           UErrorCode &errorCode) const {
+        return getDisplayIndex(findBucket(name, collatorPrimaryOnly, errorCode));
+    }
+
+    /**
+     * Returns the bucket index for every name that starts with c,
+     * or -1 if the bucket also depends on the rest of the name.
+     *
+     * The primary weights for c must not depend on the following text.
+     * Then every name starting with c sorts at or after c itself,
+     * and before the next bucket boundary unless that boundary's primary weights
+     * start with those of c. Appending U+FFFF, which has the highest primary weight,
+     * tests for the latter.
+     */
+    int32_t getFirstCharBucketIndex(UChar32 c, const RuleBasedCollator &collatorPrimaryOnly,
+                                    UErrorCode &errorCode) const {
+        if (U_IS_SURROGATE(c) || collatorPrimaryOnly.internalHasContext(c) ||
+                // Canonical reordering could move a following combining mark
+                // before the end of c's decomposition.
+                u_getIntPropertyValue(c, UCHAR_TRAIL_CANONICAL_COMBINING_CLASS) != 0) {
+            return -1;
+        }
+        UnicodeString s(c);
+        int32_t index = findBucket(s, collatorPrimaryOnly, errorCode);
+        if ((index + 1) < bucketList_->size()) {
+            s.append(static_cast<char16_t>(0xffff));
+            const AlphabeticIndex::Bucket *next = getBucket(*bucketList_, index + 1);
+            if (collatorPrimaryOnly.compare(s, next->lowerBoundary_, errorCode) >= 0) {
+                return -1;
+            }
+        }
+        return getDisplayIndex(index);
+    }
+
+    /** Binary search: Returns the index of the last bucket whose boundary is <= name. */
+    int32_t findBucket(const UnicodeString &name, const Collator &collatorPrimaryOnly,
+                       UErrorCode &errorCode) const {
         int32_t start = 0;
         int32_t limit = bucketList_->size();
         while ((start + 1) < limit) {
@@ -157,7 +221,11 @@ class BucketList : public UObject {
                 start = i;
             }
         }
-        const AlphabeticIndex::Bucket *bucket = getBucket(*bucketList_, start);
+        return start;
+    }
+
+    int32_t getDisplayIndex(int32_t index) const {
+        const AlphabeticIndex::Bucket *bucket = getBucket(*bucketList_, index);
         if (bucket->displayBucket_ != nullptr) {
             bucket = bucket->displayBucket_;
         }
@@ -193,6 +261,42 @@ AlphabeticIndex::ImmutableIndex::getBucketIndex(
     return buckets_->getBucketIndex(name, *collatorPrimaryOnly_, errorCode);
 }
 
+void
+AlphabeticIndex::ImmutableIndex::getBucketIndexes(
+        const UnicodeString *names, int32_t count, int32_t *bucketIndexes,
+        UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) { return; }
+    if (count < 0 || (count > 0 && (names == nullptr || bucketIndexes == nullptr))) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (count == 0) { return; }
+    // buildImmutableIndex() clones the primary-only RuleBasedCollator.
+    const RuleBasedCollator &coll = *static_cast<const RuleBasedCollator *>(collatorPrimaryOnly_);
+
+    // Most names are assigned to buckets via their first code points,
+    // without any string comparisons.
+    LocalPointer<FirstCharBuckets> firstCharBuckets(new FirstCharBuckets(), errorCode);
+    for (int32_t i = 0; i < count && U_SUCCESS(errorCode); ++i) {
+        const UnicodeString &name = names[i];
+        int32_t bucketIndex = -1;
+        if (!name.isEmpty()) {
+            UChar32 c = name.char32At(0);
+            int32_t *cached = firstCharBuckets->find(c);
+            if (cached != nullptr) {
+                bucketIndex = *cached;
+            } else {
+                bucketIndex = buckets_->getFirstCharBucketIndex(c, coll, errorCode);
+                firstCharBuckets->put(c, bucketIndex);
+            }
+        }
+        if (bucketIndex < 0) {
+            bucketIndex = buckets_->getBucketIndex(name, coll, errorCode);
+        }
+        bucketIndexes[i] = bucketIndex;
+    }
+}
+
 const AlphabeticIndex::Bucket *
 AlphabeticIndex::ImmutableIndex::getBucket(int32_t index) const {
     if (0 <= index && index < buckets_->getBucketCount()) {
@@ -33,6 +33,7 @@
 #include "unicode/coleitr.h"
 #include "unicode/tblcoll.h"
 #include "unicode/ustring.h"
+#include "unicode/utf8.h"
 #include "cmemory.h"
 #include "collation.h"
 #include "collationdata.h"
@@ -42,6 +43,7 @@
 #include "uassert.h"
 #include "uhash.h"
 #include "utf16collationiterator.h"
+#include "utf8collationiterator.h"
 #include "uvectr32.h"
 
 /* Constants --------------------------------------------------------------- */
@@ -54,7 +56,8 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(CollationElementIterator)
 
 CollationElementIterator::CollationElementIterator(
                                          const CollationElementIterator& other) 
-        : UObject(other), iter_(nullptr), rbc_(nullptr), otherHalf_(0), dir_(0), offsets_(nullptr) {
+        : UObject(other), iter_(nullptr), rbc_(nullptr), otherHalf_(0), dir_(0), offsets_(nullptr),
+          utf8_(nullptr), utf8Length_(0) {
     *this = other;
 }
 
@@ -155,6 +158,10 @@ bool CollationElementIterator::operator==(
         otherHalf_ == that.otherHalf_ &&
         normalizeDir() == that.normalizeDir() &&
         string_ == that.string_ &&
+        (utf8_ == nullptr) == (that.utf8_ == nullptr) &&
+        (utf8_ == nullptr ||
+            (utf8Length_ == that.utf8Length_ &&
+                uprv_memcmp(utf8_, that.utf8_, utf8Length_) == 0)) &&
         *iter_ == *that.iter_;
 }
 
@@ -175,7 +182,7 @@ int32_t CollationElementIterator::previous(UErrorCode& status)
             return oh;
         }
     } else if (dir_ == 0) {
-        iter_->resetToOffset(string_.length());
+        iter_->resetToOffset(getTextLength());
         dir_ = -1;
     } else if (dir_ == 1) {
         // previous() after setOffset()
@@ -231,17 +238,21 @@ void CollationElementIterator::setOffset(int32_t newOffset,
                                          UErrorCode& status)
 {
     if (U_FAILURE(status)) { return; }
-    if (0 < newOffset && newOffset < string_.length()) {
+    if (0 < newOffset && newOffset < getTextLength()) {
         int32_t offset = newOffset;
-        do {
-            char16_t c = string_.charAt(offset);
-            if (!rbc_->isUnsafe(c) ||
-                    (U16_IS_LEAD(c) && !rbc_->isUnsafe(string_.char32At(offset)))) {
-                break;
-            }
-            // Back up to before this unsafe character.
-            --offset;
-        } while (offset > 0);
+        if (utf8_ != nullptr) {
+            offset = backUpUTF8(offset);
+        } else {
+            do {
+                char16_t c = string_.charAt(offset);
+                if (!rbc_->isUnsafe(c) ||
+                        (U16_IS_LEAD(c) && !rbc_->isUnsafe(string_.char32At(offset)))) {
+                    break;
+                }
+                // Back up to before this unsafe character.
+                --offset;
+            } while (offset > 0);
+        }
         if (offset < newOffset) {
             // We might have backed up more than necessary.
             // For example, contractions "ch" and "cu" make both 'h' and 'u' unsafe,
@@ -267,6 +278,24 @@ void CollationElementIterator::setOffset(int32_t newOffset,
     dir_ = 1;
 }
 
+int32_t CollationElementIterator::backUpUTF8(int32_t offset) const
+{
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(utf8_);
+    // Start at the beginning of a character.
+    U8_SET_CP_START(s, 0, offset);
+    while (offset > 0) {
+        int32_t i = offset;
+        UChar32 c;
+        U8_NEXT_OR_FFFD(s, i, utf8Length_, c);
+        if (!rbc_->isUnsafe(c)) {
+            break;
+        }
+        // Back up to before this unsafe character.
+        U8_BACK_1(s, 0, offset);
+    }
+    return offset;
+}
+
 /**
 * Sets the source to the new source string.
 */
@@ -292,6 +321,39 @@ void CollationElementIterator::setText(const UnicodeString& source,
     }
     delete iter_;
     iter_ = newIter;
+    utf8_ = nullptr;
+    utf8Length_ = 0;
+    otherHalf_ = 0;
+    dir_ = 0;
+}
+
+void CollationElementIterator::setTextUTF8(StringPiece source, UErrorCode& status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    // An empty StringPiece may have a nullptr data pointer,
+    // but utf8_ == nullptr indicates UTF-16 text.
+    const char *text = source.empty() ? "" : source.data();
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(text);
+    int32_t length = source.length();
+    CollationIterator *newIter;
+    UBool numeric = rbc_->settings->isNumeric();
+    if (rbc_->settings->dontCheckFCD()) {
+        newIter = new UTF8CollationIterator(rbc_->data, numeric, s, 0, length);
+    } else {
+        newIter = new FCDUTF8CollationIterator(rbc_->data, numeric, s, 0, length);
+    }
+    if (newIter == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    delete iter_;
+    iter_ = newIter;
+    string_.remove();
+    utf8_ = text;
+    utf8Length_ = length;
     otherHalf_ = 0;
     dir_ = 0;
 }
@@ -331,7 +393,8 @@ CollationElementIterator::CollationElementIterator(
                                                const UnicodeString &source,
                                                const RuleBasedCollator *coll,
                                                UErrorCode &status)
-        : iter_(nullptr), rbc_(coll), otherHalf_(0), dir_(0), offsets_(nullptr) {
+        : iter_(nullptr), rbc_(coll), otherHalf_(0), dir_(0), offsets_(nullptr),
+          utf8_(nullptr), utf8Length_(0) {
     setText(source, status);
 }
 
@@ -343,7 +406,8 @@ CollationElementIterator::CollationElementIterator(
                                            const CharacterIterator &source,
                                            const RuleBasedCollator *coll,
                                            UErrorCode &status)
-        : iter_(nullptr), rbc_(coll), otherHalf_(0), dir_(0), offsets_(nullptr) {
+        : iter_(nullptr), rbc_(coll), otherHalf_(0), dir_(0), offsets_(nullptr),
+          utf8_(nullptr), utf8Length_(0) {
     // We only call source.getText() which should be const anyway.
     setText(const_cast<CharacterIterator &>(source), status);
 }
@@ -358,17 +422,35 @@ const CollationElementIterator& CollationElementIterator::operator=(
     }
 
     CollationIterator *newIter;
-    const FCDUTF16CollationIterator *otherFCDIter =
-            dynamic_cast<const FCDUTF16CollationIterator *>(other.iter_);
-    if(otherFCDIter != nullptr) {
-        newIter = new FCDUTF16CollationIterator(*otherFCDIter, string_.getBuffer());
+    if(other.utf8_ != nullptr) {
+        // Both iterators alias the same UTF-8 text.
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(other.utf8_);
+        const FCDUTF8CollationIterator *otherFCDIter =
+                dynamic_cast<const FCDUTF8CollationIterator *>(other.iter_);
+        if(otherFCDIter != nullptr) {
+            newIter = new FCDUTF8CollationIterator(*otherFCDIter, s);
+        } else {
+            const UTF8CollationIterator *otherIter =
+                    dynamic_cast<const UTF8CollationIterator *>(other.iter_);
+            if(otherIter != nullptr) {
+                newIter = new UTF8CollationIterator(*otherIter, s);
+            } else {
+                newIter = nullptr;
+            }
+        }
     } else {
-        const UTF16CollationIterator *otherIter =
-                dynamic_cast<const UTF16CollationIterator *>(other.iter_);
-        if(otherIter != nullptr) {
-            newIter = new UTF16CollationIterator(*otherIter, string_.getBuffer());
+        const FCDUTF16CollationIterator *otherFCDIter =
+                dynamic_cast<const FCDUTF16CollationIterator *>(other.iter_);
+        if(otherFCDIter != nullptr) {
+            newIter = new FCDUTF16CollationIterator(*otherFCDIter, string_.getBuffer());
         } else {
-            newIter = nullptr;
+            const UTF16CollationIterator *otherIter =
+                    dynamic_cast<const UTF16CollationIterator *>(other.iter_);
+            if(otherIter != nullptr) {
+                newIter = new UTF16CollationIterator(*otherIter, string_.getBuffer());
+            } else {
+                newIter = nullptr;
+            }
         }
     }
     if(newIter != nullptr) {
@@ -379,6 +461,8 @@ const CollationElementIterator& CollationElementIterator::operator=(
         dir_ = other.dir_;
 
         string_ = other.string_;
+        utf8_ = other.utf8_;
+        utf8Length_ = other.utf8Length_;
     }
     if(other.dir_ < 0 && other.offsets_ != nullptr && !other.offsets_->isEmpty()) {
         UErrorCode errorCode = U_ZERO_ERROR;
@@ -54,7 +54,9 @@
 #include "ucol_imp.h"
 #include "cstring.h"
 #include "cmemory.h"
+#include "mutex.h"
 #include "umutex.h"
+#include "uhash.h"
 #include "servloc.h"
 #include "uassert.h"
 #include "ustrenum.h"
@@ -68,6 +70,39 @@ static icu::ICULocaleService* gService = nullptr;
 static icu::UInitOnce gServiceInitOnce {};
 #endif
 static icu::UInitOnce gAvailableLocaleListInitOnce {};
+static UHashtable* gPrototypes = nullptr;
+static icu::UMutex gPrototypesMutex;
+
+U_NAMESPACE_BEGIN
+namespace {
+
+/**
+ * A collator with the attributes from its locale ID keywords already applied.
+ * Collator::createInstance() caches these per full locale ID and clones them,
+ * sharing their tailorings and settings (including the fast Latin table)
+ * rather than setting the keyword attributes on each new instance.
+ *
+ * These are not in the UnifiedCache because a collator holds a reference
+ * to a CollationCacheEntry, and the cache must not release one of its values
+ * while it deletes another one.
+ */
+struct CollatorPrototype : public UMemory {
+    CollatorPrototype(Collator *collToAdopt, UErrorCode warning) : coll(collToAdopt), status(warning) {}
+    ~CollatorPrototype() { delete coll; }
+
+    Collator *coll;
+    UErrorCode status;  // warning from creating the prototype
+    const char *key = nullptr;  // alias of the gPrototypes key
+    CollatorPrototype *prev = nullptr;  // more recently used
+    CollatorPrototype *next = nullptr;  // less recently used
+};
+
+}  // namespace
+U_NAMESPACE_END
+
+// Doubly-linked list of the prototypes, from most to least recently used.
+static icu::CollatorPrototype* gPrototypesFirst = nullptr;
+static icu::CollatorPrototype* gPrototypesLast = nullptr;
 
 /**
  * Release all static memory held by collator.
@@ -87,6 +122,11 @@ static UBool U_CALLCONV collator_cleanup() {
     }
     availableLocaleListCount = 0;
     gAvailableLocaleListInitOnce.reset();
+    if (gPrototypes) {
+        uhash_close(gPrototypes);
+        gPrototypes = nullptr;
+    }
+    gPrototypesFirst = gPrototypesLast = nullptr;
     return true;
 }
 
@@ -420,8 +460,120 @@ void setAttributesFromKeywords(const Locale &loc, Collator &coll, UErrorCode &er
     }
 }
 
+/**
+ * Keep at most this many prototypes.
+ * When the table is full, a new one replaces the least recently used one.
+ */
+constexpr int32_t MAX_PROTOTYPES = UCOL_MAX_KEYWORD_PROTOTYPES;
+
+void U_CALLCONV deletePrototype(void *obj) {
+    delete static_cast<CollatorPrototype *>(obj);
+}
+
+void unlinkPrototype(CollatorPrototype *prototype) {
+    if (prototype->prev != nullptr) {
+        prototype->prev->next = prototype->next;
+    } else {
+        gPrototypesFirst = prototype->next;
+    }
+    if (prototype->next != nullptr) {
+        prototype->next->prev = prototype->prev;
+    } else {
+        gPrototypesLast = prototype->prev;
+    }
+    prototype->prev = prototype->next = nullptr;
+}
+
+void linkPrototypeFirst(CollatorPrototype *prototype) {
+    prototype->prev = nullptr;
+    prototype->next = gPrototypesFirst;
+    if (gPrototypesFirst != nullptr) {
+        gPrototypesFirst->prev = prototype;
+    } else {
+        gPrototypesLast = prototype;
+    }
+    gPrototypesFirst = prototype;
+}
+
+/**
+ * Returns a clone of the prototype for the locale ID and sets its warning,
+ * or returns nullptr if there is no such prototype.
+ */
+Collator *clonePrototype(const char *localeID, UErrorCode &status) {
+    Mutex lock(&gPrototypesMutex);
+    if (gPrototypes == nullptr) {
+        return nullptr;
+    }
+    CollatorPrototype *prototype = static_cast<CollatorPrototype *>(uhash_get(gPrototypes, localeID));
+    if (prototype == nullptr) {
+        return nullptr;
+    }
+    if (prototype != gPrototypesFirst) {
+        unlinkPrototype(prototype);
+        linkPrototypeFirst(prototype);
+    }
+    Collator *coll = prototype->coll->clone();
+    if (coll == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    } else {
+        status = prototype->status;
+    }
+    return coll;
+}
+
+/**
+ * Caches a clone of the collator as the prototype for the locale ID.
+ * Replaces the least recently used prototype if there are MAX_PROTOTYPES already.
+ */
+void addPrototype(const char *localeID, const Collator &coll, UErrorCode warning) {
+    Mutex lock(&gPrototypesMutex);
+    UErrorCode errorCode = U_ZERO_ERROR;
+    if (gPrototypes == nullptr) {
+        gPrototypes = uhash_open(uhash_hashChars, uhash_compareChars, nullptr, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        uhash_setKeyDeleter(gPrototypes, uprv_free);
+        uhash_setValueDeleter(gPrototypes, deletePrototype);
+        ucln_i18n_registerCleanup(UCLN_I18N_COLLATOR, collator_cleanup);
+    }
+    if (uhash_get(gPrototypes, localeID) != nullptr) {
+        return;
+    }
+    char *key = uprv_strdup(localeID);
+    Collator *clone = coll.clone();
+    CollatorPrototype *prototype =
+        clone != nullptr ? new CollatorPrototype(clone, warning) : nullptr;
+    if (key == nullptr || prototype == nullptr) {
+        uprv_free(key);
+        if (prototype != nullptr) {
+            delete prototype;
+        } else {
+            delete clone;
+        }
+        return;
+    }
+    if (uhash_count(gPrototypes) >= MAX_PROTOTYPES) {
+        CollatorPrototype *lru = gPrototypesLast;
+        unlinkPrototype(lru);
+        // Deletes the key and the prototype.
+        uhash_remove(gPrototypes, lru->key);
+    }
+    prototype->key = key;
+    // uhash_put() deletes the key and value if it fails.
+    uhash_put(gPrototypes, key, prototype, &errorCode);
+    if (U_SUCCESS(errorCode)) {
+        linkPrototypeFirst(prototype);
+    }
+}
+
 }  // namespace
 
+UBool U_EXPORT2 hasCollatorKeywordPrototype(const char *localeID) {
+    Mutex lock(&gPrototypesMutex);
+    return gPrototypes != nullptr && uhash_get(gPrototypes, localeID) != nullptr;
+}
+
 Collator* U_EXPORT2 Collator::createInstance(UErrorCode& success) 
 {
     return createInstance(Locale::getDefault(), success);
@@ -439,6 +591,7 @@ Collator* U_EXPORT2 Collator::createInstance(const Locale& desiredLocale,
     }
 
     Collator* coll;
+    UBool hasKeywords = false;
 #if !UCONFIG_NO_SERVICE
     if (hasService()) {
         Locale actualLoc;
@@ -446,6 +599,13 @@ Collator* U_EXPORT2 Collator::createInstance(const Locale& desiredLocale,
     } else
 #endif
     {
+        hasKeywords = uprv_strcmp(desiredLocale.getName(), desiredLocale.getBaseName()) != 0;
+        if (hasKeywords) {
+            coll = clonePrototype(desiredLocale.getName(), status);
+            if (coll != nullptr || U_FAILURE(status)) {
+                return coll;
+            }
+        }
         coll = makeInstance(desiredLocale, status);
         // Either returns nullptr with U_FAILURE(status), or non-nullptr with U_SUCCESS(status)
     }
@@ -460,6 +620,9 @@ Collator* U_EXPORT2 Collator::createInstance(const Locale& desiredLocale,
         delete coll;
         return nullptr;
     }
+    if (hasKeywords) {
+        addPrototype(desiredLocale.getName(), *coll, status);
+    }
     return coll;
 }
 
@@ -13,11 +13,27 @@
 * created by: Markus W. Scherer
 */
 
-#ifdef DEBUG_COLLATION_BUILDER
+#include "unicode/utypes.h"
+
+#if defined(DEBUG_COLLATION_BUILDER) || !UCONFIG_NO_FILE_IO
 #include <stdio.h>
 #endif
 
-#include "unicode/utypes.h"
+#if !UCONFIG_NO_COLLATION && !UCONFIG_NO_FILE_IO
+#if U_PLATFORM_USES_ONLY_WIN32_API
+#ifndef WIN32_LEAN_AND_MEAN
+#   define WIN32_LEAN_AND_MEAN
+#endif
+#   define VC_EXTRALEAN
+#   define NOUSER
+#   define NOSERVICE
+#   define NOIME
+#   define NOMCX
+#include <windows.h>  // GetCurrentProcessId(), MoveFileExA()
+#elif U_PLATFORM_IMPLEMENTS_POSIX
+#include <unistd.h>  // getpid()
+#endif
+#endif
 
 #if !UCONFIG_NO_COLLATION
 
@@ -27,15 +43,18 @@
 #include "unicode/parseerr.h"
 #include "unicode/uchar.h"
 #include "unicode/ucol.h"
+#include "unicode/udata.h"
 #include "unicode/unistr.h"
 #include "unicode/usetiter.h"
 #include "unicode/utf16.h"
 #include "unicode/uversion.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "collation.h"
 #include "collationbuilder.h"
 #include "collationdata.h"
 #include "collationdatabuilder.h"
+#include "collationdatareader.h"
 #include "collationfastlatin.h"
 #include "collationroot.h"
 #include "collationrootelements.h"
@@ -44,8 +63,12 @@
 #include "collationtailoring.h"
 #include "collationweights.h"
 #include "normalizer2impl.h"
+#include "putilimp.h"
 #include "uassert.h"
+#include "ucmndata.h"
 #include "ucol_imp.h"
+#include "udatamem.h"
+#include "umutex.h"
 #include "utf16collationiterator.h"
 
 U_NAMESPACE_BEGIN
@@ -189,6 +212,297 @@ RuleBasedCollator::internalBuildTailoring(const UnicodeString &rules,
     }
 }
 
+namespace {
+
+#if !UCONFIG_NO_FILE_IO
+
+/*
+ * Format of a cached tailoring file, written by ucol_openRulesCached():
+ *
+ * DataHeader, with dataFormat "UCTC", formatVersion 2,
+ * and the ICU version (u_getVersion()) as the dataVersion.
+ *
+ * int32_t indexes[indexesLength]; -- indexesLength=indexes[IX_INDEXES_LENGTH]
+ * char16_t rules[indexes[IX_RULES_LENGTH]];
+ * Padding to a multiple of 16 bytes from the start of the file.
+ * uint8_t tailoring[indexes[IX_TAILORING_LENGTH]];
+ *      -- at byte offset indexes[IX_TAILORING_OFFSET] from the start of the indexes,
+ *      in the format written by ucol_cloneBinary()
+ *
+ * indexes[IX_TAILORING_CHECKSUM] is the 32-bit FNV-1a hash of the tailoring bytes.
+ * It detects files that were damaged after they were written;
+ * it does not protect against files that were deliberately modified.
+ *
+ * Changes in formatVersion 2: Added IX_TAILORING_CHECKSUM.
+ */
+constexpr int32_t CACHE_IX_INDEXES_LENGTH = 0;
+constexpr int32_t CACHE_IX_RULES_LENGTH = 1;
+constexpr int32_t CACHE_IX_TAILORING_OFFSET = 2;
+constexpr int32_t CACHE_IX_TAILORING_LENGTH = 3;
+constexpr int32_t CACHE_IX_TAILORING_CHECKSUM = 4;
+constexpr int32_t CACHE_IX_COUNT = 5;
+
+/** The DataHeader is padded to this size so that the tailoring data is 16-aligned. */
+constexpr int32_t CACHE_HEADER_SIZE = 32;
+
+const char CACHE_FILE_TYPE[] = "col";
+
+/** Number of temporary file names tried by one cache file writer. */
+constexpr int32_t MAX_CACHE_TEMP_FILE_ATTEMPTS = 8;
+
+/** Distinguishes the temporary files of concurrent writers in this process. */
+u_atomic_int32_t gCacheTempFileCounter(0);
+
+UBool U_CALLCONV
+isAcceptableCachedTailoring(void * /*context*/, const char * /*type*/, const char * /*name*/,
+                            const UDataInfo *pInfo) {
+    if(pInfo->size >= 20 &&
+            pInfo->isBigEndian == U_IS_BIG_ENDIAN &&
+            pInfo->charsetFamily == U_CHARSET_FAMILY &&
+            pInfo->sizeofUChar == U_SIZEOF_UCHAR &&
+            pInfo->dataFormat[0] == 0x55 &&  // dataFormat="UCTC"
+            pInfo->dataFormat[1] == 0x43 &&
+            pInfo->dataFormat[2] == 0x54 &&
+            pInfo->dataFormat[3] == 0x43 &&
+            pInfo->formatVersion[0] == 2) {
+        UVersionInfo icuVersion;
+        u_getVersion(icuVersion);
+        return uprv_memcmp(pInfo->dataVersion, icuVersion, sizeof(UVersionInfo)) == 0;
+    }
+    return false;
+}
+
+/**
+ * Returns the cache file name (without the type) for the rule string:
+ * The ICU major version and a 64-bit FNV-1a hash of the rules.
+ */
+void getCacheFileName(const UnicodeString &rules, CharString &name, UErrorCode &errorCode) {
+    uint64_t hash = 0xcbf29ce484222325;
+    const char16_t *p = rules.getBuffer();
+    for(int32_t i = 0; i < rules.length(); ++i) {
+        hash = (hash ^ p[i]) * 0x100000001b3;
+    }
+    name.append("coll" U_ICU_VERSION_SHORT "_", errorCode);
+    static const char hexDigits[] = "0123456789abcdef";
+    for(int32_t shift = 60; shift >= 0; shift -= 4) {
+        name.append(hexDigits[(hash >> shift) & 0xf], errorCode);
+    }
+}
+
+/** Returns the 32-bit FNV-1a hash of the bytes, for indexes[CACHE_IX_TAILORING_CHECKSUM]. */
+uint32_t getTailoringChecksum(const uint8_t *p, int32_t length) {
+    uint32_t hash = 0x811c9dc5;
+    for(int32_t i = 0; i < length; ++i) {
+        hash = (hash ^ p[i]) * 0x01000193;
+    }
+    return hash;
+}
+
+/**
+ * Returns a number that distinguishes this process from others
+ * that write into the same cache directory at the same time.
+ */
+int32_t getCacheWriterID() {
+#if U_PLATFORM_USES_ONLY_WIN32_API
+    return static_cast<int32_t>(GetCurrentProcessId() & 0x7fffffff);
+#elif U_PLATFORM_IMPLEMENTS_POSIX
+    return static_cast<int32_t>(getpid() & 0x7fffffff);
+#else
+    return static_cast<int32_t>(static_cast<int64_t>(uprv_getUTCtime()) & 0x7fffffff);
+#endif
+}
+
+/**
+ * Replaces the file at path with the one at tempPath.
+ * Returns true if successful.
+ */
+UBool replaceCacheFile(const char *tempPath, const char *path) {
+#if U_PLATFORM_USES_ONLY_WIN32_API
+    // rename() fails on Windows if the target file exists.
+    return MoveFileExA(tempPath, path, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return rename(tempPath, path) == 0;
+#endif
+}
+
+/**
+ * Opens the cache file for the rules.
+ * Returns nullptr if there is no usable file for exactly these rules.
+ */
+UDataMemory *openCachedTailoring(const char *cacheDir, const char *name,
+                                 const UnicodeString &rules,
+                                 const uint8_t *&tailoring, int32_t &tailoringLength) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UDataMemory *memory = udata_openChoice(cacheDir, CACHE_FILE_TYPE, name,
+                                           isAcceptableCachedTailoring, nullptr, &errorCode);
+    if(U_FAILURE(errorCode)) { return nullptr; }
+    // The file may be truncated or otherwise corrupt:
+    // Check every length and offset against the mapped size before using it.
+    // Any mismatch is a cache miss, and the caller rebuilds and rewrites the file.
+    const int32_t *indexes = static_cast<const int32_t *>(udata_getMemory(memory));
+    int32_t length = udata_getLength(memory);  // -1 if unknown
+    if(length >= CACHE_IX_COUNT * 4) {
+        int32_t indexesLength = indexes[CACHE_IX_INDEXES_LENGTH];
+        int32_t rulesLength = rules.length();
+        int32_t tailoringOffset = indexes[CACHE_IX_TAILORING_OFFSET];
+        int32_t cachedTailoringLength = indexes[CACHE_IX_TAILORING_LENGTH];
+        if(CACHE_IX_COUNT <= indexesLength && indexesLength <= length / 4 &&
+                indexes[CACHE_IX_RULES_LENGTH] == rulesLength &&
+                rulesLength <= (length - indexesLength * 4) / U_SIZEOF_UCHAR &&
+                (indexesLength * 4 + rulesLength * U_SIZEOF_UCHAR) <= tailoringOffset &&
+                tailoringOffset <= length && (tailoringOffset & 15) == 0 &&
+                0 <= cachedTailoringLength && cachedTailoringLength <= length - tailoringOffset &&
+                uprv_memcmp(indexes + indexesLength, rules.getBuffer(),
+                            rulesLength * U_SIZEOF_UCHAR) == 0) {
+            const uint8_t *bin = reinterpret_cast<const uint8_t *>(indexes) + tailoringOffset;
+            if(getTailoringChecksum(bin, cachedTailoringLength) ==
+                    static_cast<uint32_t>(indexes[CACHE_IX_TAILORING_CHECKSUM])) {
+                tailoring = bin;
+                tailoringLength = cachedTailoringLength;
+                return memory;
+            }
+        }
+    }
+    udata_close(memory);
+    return nullptr;
+}
+
+/**
+ * Writes the collator's tailoring and the rules into a new cache file.
+ * The file is written under a temporary name and then renamed,
+ * so that other processes never see a partial file.
+ * Errors are ignored: The collator works without the cache.
+ */
+void writeCachedTailoring(const char *cacheDir, const char *name,
+                          const UnicodeString &rules, const RuleBasedCollator &coll) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t tailoringLength = coll.cloneBinary(nullptr, 0, errorCode);
+    if(errorCode != U_BUFFER_OVERFLOW_ERROR) { return; }
+    errorCode = U_ZERO_ERROR;
+    int32_t rulesLimit = CACHE_HEADER_SIZE + CACHE_IX_COUNT * 4 + rules.length() * U_SIZEOF_UCHAR;
+    int32_t tailoringStart = (rulesLimit + 15) & ~15;
+    int32_t totalLength = tailoringStart + tailoringLength;
+    LocalMemory<uint8_t> bytes(static_cast<uint8_t *>(uprv_malloc(totalLength)));
+    if(bytes.isNull()) { return; }
+    uint8_t *dest = bytes.getAlias();
+    uprv_memset(dest, 0, tailoringStart);
+
+    DataHeader *header = reinterpret_cast<DataHeader *>(dest);
+    header->dataHeader.headerSize = CACHE_HEADER_SIZE;
+    header->dataHeader.magic1 = 0xda;
+    header->dataHeader.magic2 = 0x27;
+    UDataInfo &info = header->info;
+    info.size = sizeof(UDataInfo);
+    info.isBigEndian = U_IS_BIG_ENDIAN;
+    info.charsetFamily = U_CHARSET_FAMILY;
+    info.sizeofUChar = U_SIZEOF_UCHAR;
+    static const uint8_t dataFormat[4] = { 0x55, 0x43, 0x54, 0x43 };  // "UCTC"
+    uprv_memcpy(info.dataFormat, dataFormat, 4);
+    info.formatVersion[0] = 2;
+    u_getVersion(info.dataVersion);
+
+    int32_t *indexes = reinterpret_cast<int32_t *>(dest + CACHE_HEADER_SIZE);
+    indexes[CACHE_IX_INDEXES_LENGTH] = CACHE_IX_COUNT;
+    indexes[CACHE_IX_RULES_LENGTH] = rules.length();
+    indexes[CACHE_IX_TAILORING_OFFSET] = tailoringStart - CACHE_HEADER_SIZE;
+    indexes[CACHE_IX_TAILORING_LENGTH] = tailoringLength;
+    uprv_memcpy(indexes + CACHE_IX_COUNT, rules.getBuffer(), rules.length() * U_SIZEOF_UCHAR);
+    coll.cloneBinary(dest + tailoringStart, tailoringLength, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    indexes[CACHE_IX_TAILORING_CHECKSUM] =
+        static_cast<int32_t>(getTailoringChecksum(dest + tailoringStart, tailoringLength));
+
+    CharString path(cacheDir, errorCode);
+    path.appendPathPart(name, errorCode).append('.', errorCode).append(CACHE_FILE_TYPE, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    // Each writer creates its own temporary file:
+    // fopen() mode "x" fails if the file exists, and then we try another name.
+    // The process ID and the per-process counter make collisions among concurrent writers unlikely.
+    CharString tempPath;
+    FILE *f = nullptr;
+    for(int32_t attempt = 0; f == nullptr && attempt < MAX_CACHE_TEMP_FILE_ATTEMPTS; ++attempt) {
+        tempPath.clear().append(path, errorCode).append(".tmp", errorCode);
+        tempPath.appendNumber(getCacheWriterID(), errorCode);
+        tempPath.append('_', errorCode);
+        tempPath.appendNumber(umtx_atomic_inc(&gCacheTempFileCounter) & 0x7fffffff, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        f = fopen(tempPath.data(), "wbx");
+    }
+    if(f == nullptr) { return; }
+    UBool ok = fwrite(dest, 1, totalLength, f) == static_cast<size_t>(totalLength);
+    ok &= fclose(f) == 0;
+    if(!ok || !replaceCacheFile(tempPath.data(), path.data())) {
+        remove(tempPath.data());
+    }
+}
+
+#endif  // !UCONFIG_NO_FILE_IO
+
+}  // namespace
+
+void
+RuleBasedCollator::internalBuildTailoringCached(const UnicodeString &rules,
+                                                int32_t strength,
+                                                UColAttributeValue decompositionMode,
+                                                const char *cacheDir,
+                                                UParseError *outParseError,
+                                                UErrorCode &errorCode) {
+#if !UCONFIG_NO_FILE_IO
+    if(U_FAILURE(errorCode)) { return; }
+    if(cacheDir == nullptr || *cacheDir == 0) {
+        internalBuildTailoring(rules, strength, decompositionMode, outParseError, nullptr, errorCode);
+        return;
+    }
+    const CollationTailoring *base = CollationRoot::getRoot(errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    CharString name;
+    getCacheFileName(rules, name, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    const uint8_t *bin = nullptr;
+    int32_t length = 0;
+    UDataMemory *memory = openCachedTailoring(cacheDir, name.data(), rules, bin, length);
+    if(memory != nullptr) {
+        LocalPointer<CollationTailoring> t(new CollationTailoring(base->settings));
+        if(t.isNull() || t->isBogus()) {
+            udata_close(memory);
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        t->memory = memory;
+        // For example, U_COLLATOR_VERSION_MISMATCH if the root collation data changed.
+        UErrorCode readErrorCode = U_ZERO_ERROR;
+        CollationDataReader::read(base, bin, length, *t, readErrorCode);
+        if(U_SUCCESS(readErrorCode)) {
+            t->rules = rules;
+            t->actualLocale.setToBogus();
+            adoptTailoring(t.orphan(), errorCode);
+            if(outParseError != nullptr) {
+                outParseError->line = 0;
+                outParseError->offset = 0;
+                outParseError->preContext[0] = 0;
+                outParseError->postContext[0] = 0;
+            }
+        }
+    }
+    if(tailoring == nullptr) {
+        internalBuildTailoring(rules, UCOL_DEFAULT, UCOL_DEFAULT, outParseError, nullptr, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        writeCachedTailoring(cacheDir, name.data(), rules, *this);
+    }
+    // Set attributes after loading or building the collator, like internalBuildTailoring(),
+    // so that the cached data has the default settings from the rule string.
+    if(strength != UCOL_DEFAULT) {
+        setAttribute(UCOL_STRENGTH, static_cast<UColAttributeValue>(strength), errorCode);
+    }
+    if(decompositionMode != UCOL_DEFAULT) {
+        setAttribute(UCOL_NORMALIZATION_MODE, decompositionMode, errorCode);
+    }
+#else
+    (void)cacheDir;
+    internalBuildTailoring(rules, strength, decompositionMode, outParseError, nullptr, errorCode);
+#endif  // !UCONFIG_NO_FILE_IO
+}
+
 // CollationBuilder implementation ----------------------------------------- ***
 
 CollationBuilder::CollationBuilder(const CollationTailoring *b, UBool icu4xMode, UErrorCode &errorCode)
@@ -1684,6 +1998,31 @@ ucol_openRules(const char16_t *rules, int32_t rulesLength,
     return coll->toUCollator();
 }
 
+U_CAPI UCollator * U_EXPORT2
+ucol_openRulesCached(const char16_t *rules, int32_t rulesLength,
+                     UColAttributeValue normalizationMode, UCollationStrength strength,
+                     const char *cacheDir,
+                     UParseError *parseError, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) { return nullptr; }
+    if(rules == nullptr && rulesLength != 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return nullptr;
+    }
+    RuleBasedCollator *coll = new RuleBasedCollator();
+    if(coll == nullptr) {
+        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    UnicodeString r((UBool)(rulesLength < 0), rules, rulesLength);
+    coll->internalBuildTailoringCached(r, strength, normalizationMode, cacheDir,
+                                       parseError, *pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        delete coll;
+        return nullptr;
+    }
+    return coll->toUCollator();
+}
+
 static const int32_t internalBufferSize = 512;
 
 // The @internal ucol_getUnsafeSet() was moved here from ucol_sit.cpp
@@ -48,6 +48,9 @@ struct U_I18N_API CollationData : public UMemory {
     /** C++ only, data reader check scriptStartsLength. */
     static constexpr int32_t MAX_NUM_SCRIPT_RANGES = 256;
 
+    /** Code points below this limit are looked up in the unsafeBackwardBits. */
+    static constexpr UChar32 UNSAFE_BACKWARD_BITS_LIMIT = 0x800;
+
     CollationData(const Normalizer2Impl &nfc)
             : trie(nullptr),
               ce32s(nullptr), ces(nullptr), contexts(nullptr), base(nullptr),
@@ -56,7 +59,7 @@ struct U_I18N_API CollationData : public UMemory {
               numericPrimary(0x12000000),
               ce32sLength(0), cesLength(0), contextsLength(0),
               compressibleBytes(nullptr),
-              unsafeBackwardSet(nullptr),
+              unsafeBackwardSet(nullptr), unsafeBackwardBits(),
               fastLatinTable(nullptr), fastLatinTableLength(0),
               numScripts(0), scriptsIndex(nullptr), scriptStarts(nullptr), scriptStartsLength(0),
               rootElements(nullptr), rootElementsLength(0) {}
@@ -75,9 +78,18 @@ struct U_I18N_API CollationData : public UMemory {
     }
 
     UBool isUnsafeBackward(UChar32 c, UBool numeric) const {
-        return unsafeBackwardSet->contains(c) || (numeric && isDigit(c));
+        UBool unsafe = c < UNSAFE_BACKWARD_BITS_LIMIT ?
+                ((unsafeBackwardBits[c >> 5] >> (c & 0x1f)) & 1) != 0 :
+                unsafeBackwardSet->contains(c);
+        return unsafe || (numeric && isDigit(c));
     }
 
+    /**
+     * Sets the unsafeBackwardSet (frozen, not adopted)
+     * and caches its low code points in the unsafeBackwardBits.
+     */
+    void setUnsafeBackwardSet(const UnicodeSet *set);
+
     UBool isCompressibleLeadByte(uint32_t b) const {
         return compressibleBytes[b];
     }
@@ -202,6 +214,12 @@ struct U_I18N_API CollationData : public UMemory {
      * or in backwards CE iteration.
      */
     const UnicodeSet *unsafeBackwardSet;
+    /**
+     * Bit set for unsafeBackwardSet.contains(c) for c < UNSAFE_BACKWARD_BITS_LIMIT,
+     * so that the identical-prefix boundary check in string comparison
+     * does not call into the UnicodeSet.
+     */
+    uint32_t unsafeBackwardBits[UNSAFE_BACKWARD_BITS_LIMIT >> 5];
 
     /**
      * Fast Latin table for common-Latin-text string comparisons.
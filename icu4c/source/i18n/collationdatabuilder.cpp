@@ -1425,7 +1425,7 @@ CollationDataBuilder::buildMappings(CollationData &data, UErrorCode &errorCode)
     } else {
         data.jamoCE32s = base->jamoCE32s;
     }
-    data.unsafeBackwardSet = &unsafeBackwardSet;
+    data.setUnsafeBackwardSet(&unsafeBackwardSet);
 }
 
 void
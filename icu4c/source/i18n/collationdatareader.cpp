@@ -323,12 +323,12 @@ CollationDataReader::read(const CollationTailoring *base, const uint8_t *inBytes
             }
         }
         tailoring.unsafeBackwardSet->freeze();
-        data->unsafeBackwardSet = tailoring.unsafeBackwardSet;
+        data->setUnsafeBackwardSet(tailoring.unsafeBackwardSet);
     } else if(data == nullptr) {
         // Nothing to do.
     } else if(baseData != nullptr) {
         // No tailoring-specific data: Alias the root collator's set.
-        data->unsafeBackwardSet = baseData->unsafeBackwardSet;
+        data->setUnsafeBackwardSet(baseData->unsafeBackwardSet);
     } else {
         errorCode = U_INVALID_FORMAT_ERROR;  // No unsafeBackwardSet.
         return;
@@ -414,7 +414,7 @@ CollationDataReader::read(const CollationTailoring *base, const uint8_t *inBytes
 
     const CollationSettings &ts = *tailoring.settings;
     int32_t options = inIndexes[IX_OPTIONS] & 0xffff;
-    uint16_t fastLatinPrimaries[CollationFastLatin::LATIN_LIMIT];
+    uint16_t fastLatinPrimaries[CollationFastLatin::PRIMARIES_CAPACITY];
     int32_t fastLatinOptions = CollationFastLatin::getOptions(
             tailoring.data, ts, fastLatinPrimaries, UPRV_LENGTHOF(fastLatinPrimaries));
     if(options == ts.options && ts.variableTop != 0 &&
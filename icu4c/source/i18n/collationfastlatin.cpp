@@ -28,16 +28,16 @@ CollationFastLatin::getOptions(const CollationData *data, const CollationSetting
                                uint16_t *primaries, int32_t capacity) {
     const uint16_t *table = data->fastLatinTable;
     if(table == nullptr) { return -1; }
-    U_ASSERT(capacity == LATIN_LIMIT);
-    if(capacity != LATIN_LIMIT) { return -1; }
+    U_ASSERT(capacity == PRIMARIES_CAPACITY);
+    if(capacity != PRIMARIES_CAPACITY) { return -1; }
 
+    int32_t headerLength = *table & 0xff;
     uint32_t miniVarTop;
     if((settings.options & CollationSettings::ALTERNATE_MASK) == 0) {
         // No mini primaries are variable, set a variableTop just below the
         // lowest long mini primary.
         miniVarTop = MIN_LONG - 1;
     } else {
-        int32_t headerLength = *table & 0xff;
         int32_t i = 1 + settings.getMaxVariable();
         if(i >= headerLength) {
             return -1;  // variableTop >= digits, should not occur
@@ -45,46 +45,60 @@ CollationFastLatin::getOptions(const CollationData *data, const CollationSetting
         miniVarTop = table[i];
     }
 
-    UBool digitsAreReordered = false;
+    // Short mini primaries map to themselves unless their scripts are reordered.
+    uint16_t *shortPrimaries = primaries + LATIN_LIMIT;
+    for(int32_t i = 0; i < capacity - LATIN_LIMIT; ++i) {
+        shortPrimaries[i] = static_cast<uint16_t>(i << SHORT_PRIMARY_SHIFT);
+    }
     if(settings.hasReordering()) {
+        const uint16_t *segments = table + 1 + NUM_SPECIAL_GROUPS;
+        int32_t numSegments = (headerLength - NUM_SPECIAL_GROUPS - 2) / 2;
+        if(numSegments <= 0 || numSegments > MAX_SCRIPT_SEGMENTS) { return -1; }
+        uint32_t firstShortPrimary = static_cast<uint32_t>(segments[1]) << 16;
+        // The groups with long mini primaries (space, punct, ..., maybe digit)
+        // must stay in order, before all of the short-primary segments.
         uint32_t prevStart = 0;
-        uint32_t beforeDigitStart = 0;
-        uint32_t digitStart = 0;
-        uint32_t afterDigitStart = 0;
         for(int32_t group = UCOL_REORDER_CODE_FIRST;
                 group < UCOL_REORDER_CODE_FIRST + CollationData::MAX_NUM_SPECIAL_REORDER_CODES;
                 ++group) {
             uint32_t start = data->getFirstPrimaryForGroup(group);
+            if(start == 0 || data->getLastPrimaryForGroup(group) >= firstShortPrimary) {
+                continue;
+            }
             start = settings.reorder(start);
-            if(group == UCOL_REORDER_CODE_DIGIT) {
-                beforeDigitStart = prevStart;
-                digitStart = start;
-            } else if(start != 0) {
-                if(start < prevStart) {
-                    // The permutation affects the groups up to Latin.
-                    return -1;
-                }
-                // In the future, there might be a special group between digits & Latin.
-                if(digitStart != 0 && afterDigitStart == 0 && prevStart == beforeDigitStart) {
-                    afterDigitStart = start;
-                }
-                prevStart = start;
+            if(start < prevStart) {
+                // The permutation affects the groups with long mini primaries.
+                return -1;
             }
+            prevStart = start;
         }
-        uint32_t latinStart = data->getFirstPrimaryForGroup(USCRIPT_LATIN);
-        latinStart = settings.reorder(latinStart);
-        if(latinStart < prevStart) {
-            return -1;
-        }
-        if(afterDigitStart == 0) {
-            afterDigitStart = latinStart;
+        // Sort the segments by their reordered primaries,
+        // and move their short mini primaries accordingly.
+        uint32_t reorderedStarts[MAX_SCRIPT_SEGMENTS];
+        int32_t order[MAX_SCRIPT_SEGMENTS];
+        for(int32_t i = 0; i < numSegments; ++i) {
+            uint32_t start = settings.reorder(static_cast<uint32_t>(segments[2 * i + 1]) << 16);
+            if(start < prevStart) { return -1; }
+            int32_t j = i;
+            for(; j > 0 && start < reorderedStarts[j - 1]; --j) {
+                reorderedStarts[j] = reorderedStarts[j - 1];
+                order[j] = order[j - 1];
+            }
+            reorderedStarts[j] = start;
+            order[j] = i;
         }
-        if(!(beforeDigitStart < digitStart && digitStart < afterDigitStart)) {
-            digitsAreReordered = true;
+        uint32_t newPrimary = segments[0];
+        for(int32_t j = 0; j < numSegments; ++j) {
+            int32_t i = order[j];
+            uint32_t p = segments[2 * i];
+            uint32_t limit = segments[2 * i + 2];  // next segment or shortPrimaryLimit
+            for(; p < limit; p += SHORT_INC, newPrimary += SHORT_INC) {
+                shortPrimaries[p >> SHORT_PRIMARY_SHIFT] = static_cast<uint16_t>(newPrimary);
+            }
         }
     }
 
-    table += (table[0] & 0xff);  // skip the header
+    table += headerLength;  // skip the header
     for(UChar32 c = 0; c < LATIN_LIMIT; ++c) {
         uint32_t p = table[c];
         if(p >= MIN_SHORT) {
@@ -96,7 +110,7 @@ CollationFastLatin::getOptions(const CollationData *data, const CollationSetting
         }
         primaries[c] = static_cast<uint16_t>(p);
     }
-    if(digitsAreReordered || (settings.options & CollationSettings::NUMERIC) != 0) {
+    if((settings.options & CollationSettings::NUMERIC) != 0) {
         // Bail out for digits.
         for(UChar32 c = 0x30; c <= 0x39; ++c) { primaries[c] = 0; }
     }
@@ -199,7 +213,9 @@ CollationFastLatin::compareUTF16(const uint16_t *table, const uint16_t *primarie
         uint32_t leftPrimary = leftPair & 0xffff;
         uint32_t rightPrimary = rightPair & 0xffff;
         if(leftPrimary != rightPrimary) {
-            // Return the primary difference.
+            // Return the primary difference, with script reordering.
+            leftPrimary = reorderPrimary(primaries, leftPrimary);
+            rightPrimary = reorderPrimary(primaries, rightPrimary);
             return (leftPrimary < rightPrimary) ? UCOL_LESS : UCOL_GREATER;
         }
         if(leftPair == EOS) { break; }
@@ -550,7 +566,9 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
         uint32_t leftPrimary = leftPair & 0xffff;
         uint32_t rightPrimary = rightPair & 0xffff;
         if(leftPrimary != rightPrimary) {
-            // Return the primary difference.
+            // Return the primary difference, with script reordering.
+            leftPrimary = reorderPrimary(primaries, leftPrimary);
+            rightPrimary = reorderPrimary(primaries, rightPrimary);
             return (leftPrimary < rightPrimary) ? UCOL_LESS : UCOL_GREATER;
         }
         if(leftPair == EOS) { break; }
@@ -798,7 +816,15 @@ CollationFastLatin::compareUTF8(const uint16_t *table, const uint16_t *primaries
 uint32_t
 CollationFastLatin::lookup(const uint16_t *table, UChar32 c) {
     U_ASSERT(c > LATIN_MAX);
-    if(PUNCT_START <= c && c < PUNCT_LIMIT) {
+    if(c < CYRILLIC_LIMIT) {
+        if(CYRILLIC_START <= c) {
+            return table[c - (CYRILLIC_START - CYRILLIC_INDEX)];
+        } else if(GREEK_START <= c && c < GREEK_LIMIT) {
+            return table[c - (GREEK_START - GREEK_INDEX)];
+        } else {
+            return BAIL_OUT;
+        }
+    } else if(PUNCT_START <= c && c < PUNCT_LIMIT) {
         return table[c - PUNCT_START + LATIN_LIMIT];
     } else if(c == 0xfffe) {
         return MERGE_WEIGHT;
@@ -814,6 +840,16 @@ CollationFastLatin::lookupUTF8(const uint16_t *table, UChar32 c,
                                const uint8_t *s8, int32_t &sIndex, int32_t sLength) {
     // The caller handled ASCII and valid/supported Latin.
     U_ASSERT(c > 0x7f);
+    if(0xce <= c && c <= 0xd1) {
+        // Greek & Cyrillic lead bytes
+        uint8_t t1;
+        if(sIndex != sLength && 0x80 <= (t1 = s8[sIndex]) && t1 <= 0xbf) {
+            ++sIndex;
+            int32_t x = getCharIndex(static_cast<char16_t>(((c & 0x1f) << 6) | (t1 & 0x3f)));
+            return x >= 0 ? table[x] : BAIL_OUT;
+        }
+        return BAIL_OUT;
+    }
     int32_t i2 = sIndex + 1;
     if(i2 < sLength || sLength < 0) {
         uint8_t t1 = s8[sIndex];
@@ -840,6 +876,13 @@ CollationFastLatin::lookupUTF8Unsafe(const uint16_t *table, UChar32 c,
     U_ASSERT(c > 0x7f);
     if(c <= LATIN_MAX_UTF8_LEAD) {
         return table[((c - 0xc2) << 6) + s8[sIndex++]];  // 0080..017F
+    } else if(c < 0xe0) {
+        c = ((c & 0x1f) << 6) | (s8[sIndex++] & 0x3f);
+        if(c < GREEK_LIMIT) {
+            return table[c - (GREEK_START - GREEK_INDEX)];  // 0380..03CF
+        } else {
+            return table[c - (CYRILLIC_START - CYRILLIC_INDEX)];  // 0400..045F
+        }
     }
     uint8_t t2 = s8[sIndex + 1];
     sIndex += 2;
@@ -875,12 +918,12 @@ CollationFastLatin::nextPair(const uint16_t *table, UChar32 c, uint32_t ce,
             if(s16 != nullptr) {
                 c2 = s16[nextIndex++];
                 if(c2 > LATIN_MAX) {
-                    if(PUNCT_START <= c2 && c2 < PUNCT_LIMIT) {
-                        c2 = c2 - PUNCT_START + LATIN_LIMIT;  // 2000..203F -> 0180..01BF
-                    } else if(c2 == 0xfffe || c2 == 0xffff) {
+                    if(c2 == 0xfffe || c2 == 0xffff) {
                         c2 = -1;  // U+FFFE & U+FFFF cannot occur in contractions.
                     } else {
-                        return BAIL_OUT;
+                        // 2000..203F -> 0180..01BF, Greek & Cyrillic -> 01C0..026F
+                        c2 = getCharIndex(static_cast<char16_t>(c2));
+                        if(c2 < 0) { return BAIL_OUT; }
                     }
                 }
             } else {
@@ -891,6 +934,12 @@ CollationFastLatin::nextPair(const uint16_t *table, UChar32 c, uint32_t ce,
                             0x80 <= (t = s8[nextIndex]) && t <= 0xbf) {
                         c2 = ((c2 - 0xc2) << 6) + t;  // 0080..017F
                         ++nextIndex;
+                    } else if(0xce <= c2 && c2 <= 0xd1 && nextIndex != sLength &&
+                            0x80 <= (t = s8[nextIndex]) && t <= 0xbf) {
+                        // Greek & Cyrillic -> 01C0..026F
+                        c2 = getCharIndex(static_cast<char16_t>(((c2 & 0x1f) << 6) | (t & 0x3f)));
+                        if(c2 < 0) { return BAIL_OUT; }
+                        ++nextIndex;
                     } else {
                         int32_t i2 = nextIndex + 1;
                         if(i2 < sLength || sLength < 0) {
@@ -33,7 +33,7 @@ class U_I18N_API CollationFastLatin /* all static */ {
      * When the major version number of the main data format changes,
      * we can reset this fast Latin version to 1.
      */
-    static const uint16_t VERSION = 2;
+    static const uint16_t VERSION = 3;
 
     static const int32_t LATIN_MAX = 0x17f;
     static const int32_t LATIN_LIMIT = LATIN_MAX + 1;
@@ -43,8 +43,24 @@ class U_I18N_API CollationFastLatin /* all static */ {
     static const int32_t PUNCT_START = 0x2000;
     static const int32_t PUNCT_LIMIT = 0x2040;
 
+    // Basic Greek letters (UTF-8 lead bytes CE & CF)
+    // and Cyrillic letters used by Russian and other major languages (lead bytes D0 & D1).
+    static const int32_t GREEK_START = 0x380;
+    static const int32_t GREEK_LIMIT = 0x3d0;
+    static const int32_t CYRILLIC_START = 0x400;
+    static const int32_t CYRILLIC_LIMIT = 0x460;
+
+    // Character indexes of the ranges after Latin.
+    static const int32_t GREEK_INDEX = LATIN_LIMIT + (PUNCT_LIMIT - PUNCT_START);
+    static const int32_t CYRILLIC_INDEX = GREEK_INDEX + (GREEK_LIMIT - GREEK_START);
+
     // excludes U+FFFE & U+FFFF
-    static const int32_t NUM_FAST_CHARS = LATIN_LIMIT + (PUNCT_LIMIT - PUNCT_START);
+    static const int32_t NUM_FAST_CHARS = CYRILLIC_INDEX + (CYRILLIC_LIMIT - CYRILLIC_START);
+
+    // The fastpath is tried when the first differing characters are at most this one.
+    // Characters in between that are not fast characters bail out via lookup().
+    static const int32_t FAST_START_MAX = CYRILLIC_LIMIT - 1;
+    static const int32_t FAST_START_MAX_UTF8_LEAD = 0xd1;  // UTF-8 lead byte of FAST_START_MAX
 
     // Note on the supported weight ranges:
     // Analysis of UCA 6.3 and CLDR 23 non-search tailorings shows that
@@ -59,30 +75,36 @@ class U_I18N_API CollationFastLatin /* all static */ {
     // at most 4 tertiary after-common weights.
     // The following ranges are designed to support slightly more weights than that.
     // (en_US_POSIX is unusual: It creates about 64 variable + 116 Latin primaries.)
+    // The basic Greek and Cyrillic letters add about 25 and 41 primary weights.
+    // Their tertiary differences are almost only case differences,
+    // which have their own mini CE bits.
+    // If a tailoring has more short primaries than fit,
+    // then the characters with the highest primaries bail out.
 
     // Digits may use long primaries (preserving more short ones)
     // or short primaries (faster) without changing this data structure.
     // (If we supported numeric collation, then digits would have to have long primaries
     // so that special handling does not affect the fast path.)
 
-    static const uint32_t SHORT_PRIMARY_MASK = 0xfc00;  // bits 15..10
+    static const uint32_t SHORT_PRIMARY_MASK = 0xfe00;  // bits 15..9
+    static const int32_t SHORT_PRIMARY_SHIFT = 9;
     static const uint32_t INDEX_MASK = 0x3ff;  // bits 9..0 for expansions & contractions
-    static const uint32_t SECONDARY_MASK = 0x3e0;  // bits 9..5
-    static const uint32_t CASE_MASK = 0x18;  // bits 4..3
-    static const uint32_t LONG_PRIMARY_MASK = 0xfff8;  // bits 15..3
-    static const uint32_t TERTIARY_MASK = 7;  // bits 2..0
+    static const uint32_t SECONDARY_MASK = 0x1f0;  // bits 8..4
+    static const uint32_t CASE_MASK = 0xc;  // bits 3..2
+    static const uint32_t LONG_PRIMARY_MASK = 0xfffc;  // bits 15..2
+    static const uint32_t TERTIARY_MASK = 3;  // bits 1..0
     static const uint32_t CASE_AND_TERTIARY_MASK = CASE_MASK | TERTIARY_MASK;
 
     static const uint32_t TWO_SHORT_PRIMARIES_MASK =
-            (SHORT_PRIMARY_MASK << 16) | SHORT_PRIMARY_MASK;  // 0xfc00fc00
+            (SHORT_PRIMARY_MASK << 16) | SHORT_PRIMARY_MASK;  // 0xfe00fe00
     static const uint32_t TWO_LONG_PRIMARIES_MASK =
-            (LONG_PRIMARY_MASK << 16) | LONG_PRIMARY_MASK;  // 0xfff8fff8
+            (LONG_PRIMARY_MASK << 16) | LONG_PRIMARY_MASK;  // 0xfffcfffc
     static const uint32_t TWO_SECONDARIES_MASK =
-            (SECONDARY_MASK << 16) | SECONDARY_MASK;  // 0x3e003e0
+            (SECONDARY_MASK << 16) | SECONDARY_MASK;  // 0x1f001f0
     static const uint32_t TWO_CASES_MASK =
-            (CASE_MASK << 16) | CASE_MASK;  // 0x180018
+            (CASE_MASK << 16) | CASE_MASK;  // 0xc000c
     static const uint32_t TWO_TERTIARIES_MASK =
-            (TERTIARY_MASK << 16) | TERTIARY_MASK;  // 0x70007
+            (TERTIARY_MASK << 16) | TERTIARY_MASK;  // 0x30003
 
     /**
      * Contraction with one fast Latin character.
@@ -107,25 +129,25 @@ class U_I18N_API CollationFastLatin /* all static */ {
      */
     static const uint32_t EXPANSION = 0x800;
     /**
-     * Encodes one CE with a long/low mini primary (there are 128).
+     * Encodes one CE with a long/low mini primary (there are 256).
      * All potentially-variable primaries must be in this range,
      * to make the short-primary path as fast as possible.
      */
     static const uint32_t MIN_LONG = 0xc00;
-    static const uint32_t LONG_INC = 8;
-    static const uint32_t MAX_LONG = 0xff8;
+    static const uint32_t LONG_INC = 4;
+    static const uint32_t MAX_LONG = 0xffc;
     /**
-     * Encodes one CE with a short/high primary (there are 60),
+     * Encodes one CE with a short/high primary (there are 120),
      * plus a secondary CE if the secondary weight is high.
      * Fast handling: At least all letter primaries should be in this range.
      */
     static const uint32_t MIN_SHORT = 0x1000;
-    static const uint32_t SHORT_INC = 0x400;
+    static const uint32_t SHORT_INC = 0x200;
     /** The highest primary weight is reserved for U+FFFF. */
     static const uint32_t MAX_SHORT = SHORT_PRIMARY_MASK;
 
     static const uint32_t MIN_SEC_BEFORE = 0;  // must add SEC_OFFSET
-    static const uint32_t SEC_INC = 0x20;
+    static const uint32_t SEC_INC = 0x10;
     static const uint32_t MAX_SEC_BEFORE = MIN_SEC_BEFORE + 4 * SEC_INC;  // 5 before common
     static const uint32_t COMMON_SEC = MAX_SEC_BEFORE + SEC_INC;
     static const uint32_t MIN_SEC_AFTER = COMMON_SEC + SEC_INC;
@@ -142,15 +164,21 @@ class U_I18N_API CollationFastLatin /* all static */ {
     static const uint32_t COMMON_SEC_PLUS_OFFSET = COMMON_SEC + SEC_OFFSET;
 
     static const uint32_t TWO_SEC_OFFSETS =
-            (SEC_OFFSET << 16) | SEC_OFFSET;  // 0x200020
+            (SEC_OFFSET << 16) | SEC_OFFSET;  // 0x100010
     static const uint32_t TWO_COMMON_SEC_PLUS_OFFSET =
             (COMMON_SEC_PLUS_OFFSET << 16) | COMMON_SEC_PLUS_OFFSET;
 
-    static const uint32_t LOWER_CASE = 8;  // case bits include this offset
-    static const uint32_t TWO_LOWER_CASES = (LOWER_CASE << 16) | LOWER_CASE;  // 0x80008
+    static const uint32_t LOWER_CASE = 4;  // case bits include this offset
+    static const uint32_t TWO_LOWER_CASES = (LOWER_CASE << 16) | LOWER_CASE;  // 0x40004
 
     static const uint32_t COMMON_TER = 0;  // must add TER_OFFSET
-    static const uint32_t MAX_TER_AFTER = 7;  // 7 after common
+    // Version 2 had 3 tertiary bits for up to 7 after-common weights.
+    // Version 3 needs one more short-primary bit, which leaves 2 tertiary bits.
+    // Of the 619 CLDR 46 tailorings, only da, fo (each standard & search) and to
+    // use a 4th after-common tertiary weight in the fast ranges,
+    // for the contraction "AA" and for U+014A respectively, and none uses more.
+    // Only those mini CEs bail out.
+    static const uint32_t MAX_TER_AFTER = 3;  // 3 after common
 
     /**
      * Lookup: Add this offset to tertiary weights, except for completely ignorable CEs.
@@ -171,16 +199,16 @@ class U_I18N_API CollationFastLatin /* all static */ {
     static const uint32_t BAIL_OUT = 1;
 
     /**
-     * Contraction result first word bits 8..0 contain the
+     * Contraction result first word bits 9..0 contain the
      * second contraction character, as a char index 0..NUM_FAST_CHARS-1.
      * Each contraction list is terminated with a word containing CONTR_CHAR_MASK.
      */
-    static const uint32_t CONTR_CHAR_MASK = 0x1ff;
+    static const uint32_t CONTR_CHAR_MASK = 0x3ff;
     /**
-     * Contraction result first word bits 10..9 contain the result length:
+     * Contraction result first word bits 11..10 contain the result length:
      * 1=bail out, 2=one mini CE, 3=two mini CEs
      */
-    static const uint32_t CONTR_LENGTH_SHIFT = 9;
+    static const uint32_t CONTR_LENGTH_SHIFT = 10;
 
     /**
      * Comparison return value when the regular comparison must be used.
@@ -188,11 +216,32 @@ class U_I18N_API CollationFastLatin /* all static */ {
      */
     static const int32_t BAIL_OUT_RESULT = -2;
 
+    /**
+     * Number of header varTops, for the maxVariable groups space, punct, symbol, currency.
+     * The header continues with the short-primary script segments.
+     */
+    static const int32_t NUM_SPECIAL_GROUPS = 4;
+    /** Maximum number of short-primary script segments in the header. */
+    static const int32_t MAX_SCRIPT_SEGMENTS = 8;
+
+    /**
+     * Capacity of the getOptions() primaries array:
+     * Precomputed primaries for U+0000..U+017F,
+     * followed by the short mini primaries mapped for script reordering,
+     * indexed by (short primary >> SHORT_PRIMARY_SHIFT).
+     */
+    static const int32_t PRIMARIES_CAPACITY =
+            LATIN_LIMIT + (SHORT_PRIMARY_MASK >> SHORT_PRIMARY_SHIFT) + 1;
+
     static inline int32_t getCharIndex(char16_t c) {
         if(c <= LATIN_MAX) {
             return c;
         } else if(PUNCT_START <= c && c < PUNCT_LIMIT) {
             return c - (PUNCT_START - LATIN_LIMIT);
+        } else if(GREEK_START <= c && c < GREEK_LIMIT) {
+            return c - (GREEK_START - GREEK_INDEX);
+        } else if(CYRILLIC_START <= c && c < CYRILLIC_LIMIT) {
+            return c - (CYRILLIC_START - CYRILLIC_INDEX);
         } else {
             // Not a fast Latin character.
             // Note: U+FFFE & U+FFFF are forbidden in tailorings
@@ -205,7 +254,7 @@ class U_I18N_API CollationFastLatin /* all static */ {
      * Computes the options value for the compare functions
      * and writes the precomputed primary weights.
      * Returns -1 if the Latin fastpath is not supported for the data and settings.
-     * The capacity must be LATIN_LIMIT.
+     * The capacity must be PRIMARIES_CAPACITY.
      */
     static int32_t getOptions(const CollationData *data, const CollationSettings &settings,
                               uint16_t *primaries, int32_t capacity);
@@ -243,6 +292,17 @@ class U_I18N_API CollationFastLatin /* all static */ {
             return ((ce + SEC_OFFSET) << 16) | COMMON_SEC_PLUS_OFFSET;
         }
     }
+    /**
+     * Returns the short mini primary p as permuted by the script reordering,
+     * or p itself if it is not a short primary.
+     * Only the final primary difference needs to be reordered.
+     */
+    static inline uint32_t reorderPrimary(const uint16_t *primaries, uint32_t p) {
+        if(p >= MIN_SHORT) {
+            p = primaries[LATIN_LIMIT + (p >> SHORT_PRIMARY_SHIFT)];
+        }
+        return p;
+    }
     static uint32_t getSecondaries(uint32_t variableTop, uint32_t pair);
     static uint32_t getCases(uint32_t variableTop, UBool strengthIsPrimary, uint32_t pair);
     static uint32_t getTertiaries(uint32_t variableTop, UBool withCaseBits, uint32_t pair);
@@ -254,7 +314,7 @@ class U_I18N_API CollationFastLatin /* all static */ {
 
 /*
  * Format of the CollationFastLatin data table.
- * CollationFastLatin::VERSION = 2.
+ * CollationFastLatin::VERSION = 3.
  *
  * This table contains data for a Latin-text collation fastpath.
  * The data is stored as an array of uint16_t which contains the following parts.
@@ -263,8 +323,8 @@ class U_I18N_API CollationFastLatin /* all static */ {
  *   Bits 15..8: version, must match the VERSION
  *         7..0: length of the header
  *
- * uint16_t varTops[header length - 1]
- *   Version 2:
+ * uint16_t varTops[NUM_SPECIAL_GROUPS]
+ *   Version 2 & 3:
  *   varTops[m] is the highest CollationFastLatin long-primary weight
  *   of supported maxVariable group m
  *   (special reorder group space, punct, symbol, currency).
@@ -276,8 +336,19 @@ class U_I18N_API CollationFastLatin /* all static */ {
  *   Bits 15..7: max fast-Latin long-primary weight (bits 11..3 shifted left by 4 bits)
  *         6..0: regular primary lead byte
  *
- * uint16_t miniCEs[0x1c0]
- *   A mini collation element for each character U+0000..U+017F and U+2000..U+203F.
+ * struct { uint16_t miniPrimary, primary; } scriptSegments[n]
+ * uint16_t shortPrimaryLimit
+ *   Version 3: n = (header length - NUM_SPECIAL_GROUPS - 2) / 2
+ *   The short mini primaries are split into segments of consecutive weights,
+ *   one per reordering group (digits if they use short primaries, Latn, Grek, Cyrl, ...).
+ *   Each segment has its first short mini primary and
+ *   bits 31..16 of the lowest regular primary weight in the segment.
+ *   The last segment ends before the shortPrimaryLimit.
+ *   getOptions() uses this to permute the segments for script reordering.
+ *
+ * uint16_t miniCEs[0x270]
+ *   A mini collation element for each character U+0000..U+017F, U+2000..U+203F,
+ *   U+0380..U+03CF and U+0400..U+045F.
  *   Each value encodes one or two mini CEs (two are possible if the first one
  *   has a short mini primary and the second one is a secondary CE, i.e., primary == 0),
  *   or points to an expansion or to a contraction table.
@@ -295,8 +366,8 @@ class U_I18N_API CollationFastLatin /* all static */ {
  *   Contraction mini CEs contain an offset relative to just after the miniCEs table.
  *   It points to a list of tuples which map from a contraction suffix character to a result.
  *   First uint16_t of each tuple:
- *     Bits 10..9: Length of the result (1..3), see comments on CONTR_LENGTH_SHIFT.
- *     Bits  8..0: Contraction character, see comments on CONTR_CHAR_MASK.
+ *     Bits 11..10: Length of the result (1..3), see comments on CONTR_LENGTH_SHIFT.
+ *     Bits  9..0: Contraction character, see comments on CONTR_CHAR_MASK.
  *   This is followed by 0, 1, or 2 uint16_t according to the length.
  *   Each list is terminated by an entry with CONTR_CHAR_MASK.
  *   Each list starts with such an entry which also contains the default result
@@ -311,6 +382,19 @@ class U_I18N_API CollationFastLatin /* all static */ {
  * the maxVariable-supported special reorder groups.
  * Now the top 16 bits would need to be stored,
  * and it is simpler to store only the fast-Latin weights.
+ *
+ * -----------------
+ * Changes for version 3 (ICU 76)
+ *
+ * The basic Greek letters U+0380..U+03CF and Cyrillic letters U+0400..U+045F
+ * are fast characters, with short primaries for their letters.
+ * To make room, short primaries have 7 bits (bits 15..9) instead of 6,
+ * secondaries move to bits 8..4, case bits to 3..2, and tertiaries to 1..0
+ * (3 instead of 7 after-common tertiary weights).
+ * Long primaries have bits 15..2 (256 instead of 128 weights).
+ * Contraction characters have 10 bits.
+ * The header has the short-primary script segments so that the fastpath
+ * also works with script reordering (e.g., Cyrillic or Greek first).
  */
 
 U_NAMESPACE_END
@@ -90,8 +90,9 @@ CollationFastLatinBuilder::CollationFastLatinBuilder(UErrorCode &errorCode)
         : ce0(0), ce1(0),
           contractionCEs(errorCode), uniqueCEs(errorCode),
           miniCEs(nullptr),
-          firstDigitPrimary(0), firstLatinPrimary(0), lastLatinPrimary(0),
+          firstDigitPrimary(0), firstLatinPrimary(0), lastFastPrimary(0),
           firstShortPrimary(0), shortPrimaryOverflow(false),
+          numScriptSegments(0), lastScriptGroup(-1), shortPrimaryLimit(0),
           headerLength(0) {
 }
 
@@ -111,25 +112,23 @@ CollationFastLatinBuilder::forData(const CollationData &data, UErrorCode &errorC
     // Fast handling of digits.
     firstShortPrimary = firstDigitPrimary;
     getCEs(data, errorCode);
-    if(!encodeUniqueCEs(errorCode)) { return false; }
+    if(!encodeUniqueCEs(data, errorCode)) { return false; }
     if(shortPrimaryOverflow) {
         // Give digits long mini primaries,
         // so that there are more short primaries for letters.
         firstShortPrimary = firstLatinPrimary;
         resetCEs();
         getCEs(data, errorCode);
-        if(!encodeUniqueCEs(errorCode)) { return false; }
-    }
-    // Note: If we still have a short-primary overflow but not a long-primary overflow,
-    // then we could calculate how many more long primaries would fit,
-    // and set the firstShortPrimary to that many after the current firstShortPrimary,
-    // and try again.
-    // However, this might only benefit the en_US_POSIX tailoring,
-    // and it is simpler to suppress building fast Latin data for it in genrb,
-    // or by returning false here if shortPrimaryOverflow.
-
-    UBool ok = !shortPrimaryOverflow &&
-            encodeCharCEs(errorCode) && encodeContractions(errorCode);
+        if(!encodeUniqueCEs(data, errorCode)) { return false; }
+    }
+    // Note: If we still have a short-primary overflow,
+    // then the CEs with the highest primaries map to BAIL_OUT,
+    // and only the characters using them take the slow path.
+    // Typically, those are some of the Cyrillic letters
+    // in tailorings with many additional primaries.
+
+    UBool ok = encodeCharCEs(errorCode) && encodeContractions(errorCode) &&
+            encodeScriptSegments(errorCode);
     contractionCEs.removeAllElements();  // might reduce heap memory usage
     uniqueCEs.removeAllElements();
     return ok;
@@ -142,7 +141,7 @@ CollationFastLatinBuilder::loadGroups(const CollationData &data, UErrorCode &err
     uint32_t r0 = (CollationFastLatin::VERSION << 8) | headerLength;
     result.append(static_cast<char16_t>(r0));
     // The first few reordering groups should be special groups
-    // (space, punct, ..., digit) followed by Latn, then Grek and other scripts.
+    // (space, punct, ..., digit) followed by Latn, then Grek, Copt, Cyrl and other scripts.
     for(int32_t i = 0; i < NUM_SPECIAL_GROUPS; ++i) {
         lastSpecialPrimaries[i] = data.getLastPrimaryForGroup(UCOL_REORDER_CODE_FIRST + i);
         if(lastSpecialPrimaries[i] == 0) {
@@ -154,11 +153,16 @@ CollationFastLatinBuilder::loadGroups(const CollationData &data, UErrorCode &err
 
     firstDigitPrimary = data.getFirstPrimaryForGroup(UCOL_REORDER_CODE_DIGIT);
     firstLatinPrimary = data.getFirstPrimaryForGroup(USCRIPT_LATIN);
-    lastLatinPrimary = data.getLastPrimaryForGroup(USCRIPT_LATIN);
+    lastFastPrimary = data.getLastPrimaryForGroup(USCRIPT_LATIN);
     if(firstDigitPrimary == 0 || firstLatinPrimary == 0) {
         // missing data
         return false;
     }
+    // The Greek and Cyrillic letters normally sort after Latin.
+    uint32_t lastCyrillicPrimary = data.getLastPrimaryForGroup(USCRIPT_CYRILLIC);
+    if(lastCyrillicPrimary > lastFastPrimary) {
+        lastFastPrimary = lastCyrillicPrimary;
+    }
     return true;
 }
 
@@ -198,6 +202,9 @@ CollationFastLatinBuilder::resetCEs() {
     contractionCEs.removeAllElements();
     uniqueCEs.removeAllElements();
     shortPrimaryOverflow = false;
+    numScriptSegments = 0;
+    lastScriptGroup = -1;
+    shortPrimaryLimit = 0;
     result.truncate(headerLength);
 }
 
@@ -209,6 +216,10 @@ CollationFastLatinBuilder::getCEs(const CollationData &data, UErrorCode &errorCo
         if(c == CollationFastLatin::LATIN_LIMIT) {
             c = CollationFastLatin::PUNCT_START;
         } else if(c == CollationFastLatin::PUNCT_LIMIT) {
+            c = CollationFastLatin::GREEK_START;
+        } else if(c == CollationFastLatin::GREEK_LIMIT) {
+            c = CollationFastLatin::CYRILLIC_START;
+        } else if(c == CollationFastLatin::CYRILLIC_LIMIT) {
             break;
         }
         const CollationData *d;
@@ -303,8 +314,8 @@ CollationFastLatinBuilder::getCEsFromCE32(const CollationData &data, UChar32 c,
     // We do not support an ignorable ce0 unless it is completely ignorable.
     uint32_t p0 = static_cast<uint32_t>(ce0 >> 32);
     if(p0 == 0) { return false; }
-    // We only support primaries up to the Latin script.
-    if(p0 > lastLatinPrimary) { return false; }
+    // We only support primaries up to the Cyrillic script.
+    if(p0 > lastFastPrimary) { return false; }
     // We support non-common secondary and case weights only together with short primaries.
     uint32_t lower32_0 = static_cast<uint32_t>(ce0);
     if(p0 < firstShortPrimary) {
@@ -427,7 +438,7 @@ CollationFastLatinBuilder::getMiniCE(int64_t ce) const {
 }
 
 UBool
-CollationFastLatinBuilder::encodeUniqueCEs(UErrorCode &errorCode) {
+CollationFastLatinBuilder::encodeUniqueCEs(const CollationData &data, UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return false; }
     uprv_free(miniCEs);
     miniCEs = static_cast<uint16_t*>(uprv_malloc(uniqueCEs.size() * 2));
@@ -475,12 +486,13 @@ CollationFastLatinBuilder::encodeUniqueCEs(UErrorCode &errorCode) {
                     continue;
                 }
             } else {
-                if(pri < CollationFastLatin::MIN_SHORT) {
-                    pri = CollationFastLatin::MIN_SHORT;
-                } else if(pri < (CollationFastLatin::MAX_SHORT - CollationFastLatin::SHORT_INC)) {
-                    // Reserve the highest primary weight for U+FFFF.
-                    pri += CollationFastLatin::SHORT_INC;
-                } else {
+                // Each reordering group gets its own segment of short primaries.
+                int32_t scriptGroup = data.getGroupForPrimary(p);
+                UBool isNewSegment = numScriptSegments == 0 || scriptGroup != lastScriptGroup;
+                // Reserve the highest primary weight for U+FFFF.
+                if(pri >= (CollationFastLatin::MAX_SHORT - CollationFastLatin::SHORT_INC) ||
+                        (isNewSegment &&
+                            numScriptSegments == CollationFastLatin::MAX_SCRIPT_SEGMENTS)) {
 #if DEBUG_COLLATION_FAST_LATIN_BUILDER
                     printf("short-primary overflow for %08x\n", p);
 #endif
@@ -488,6 +500,18 @@ CollationFastLatinBuilder::encodeUniqueCEs(UErrorCode &errorCode) {
                     miniCEs[i] = CollationFastLatin::BAIL_OUT;
                     continue;
                 }
+                if(pri < CollationFastLatin::MIN_SHORT) {
+                    pri = CollationFastLatin::MIN_SHORT;
+                } else {
+                    pri += CollationFastLatin::SHORT_INC;
+                }
+                if(isNewSegment) {
+                    scriptSegments[2 * numScriptSegments] = static_cast<char16_t>(pri);
+                    scriptSegments[2 * numScriptSegments + 1] = static_cast<char16_t>(p >> 16);
+                    ++numScriptSegments;
+                    lastScriptGroup = scriptGroup;
+                }
+                shortPrimaryLimit = pri + CollationFastLatin::SHORT_INC;
             }
             prevPrimary = p;
             prevSecondary = Collation::COMMON_WEIGHT16;
@@ -648,7 +672,11 @@ CollationFastLatinBuilder::encodeContractions(UErrorCode &errorCode) {
     U_ASSERT(CollationFastLatin::NUM_FAST_CHARS % 16 == 0);
     for(; i < indexBase; i += 16) {
         UChar32 c = i - headerLength;
-        if(c >= CollationFastLatin::LATIN_LIMIT) {
+        if(c >= CollationFastLatin::CYRILLIC_INDEX) {
+            c = CollationFastLatin::CYRILLIC_START + c - CollationFastLatin::CYRILLIC_INDEX;
+        } else if(c >= CollationFastLatin::GREEK_INDEX) {
+            c = CollationFastLatin::GREEK_START + c - CollationFastLatin::GREEK_INDEX;
+        } else if(c >= CollationFastLatin::LATIN_LIMIT) {
             c = CollationFastLatin::PUNCT_START + c - CollationFastLatin::LATIN_LIMIT;
         }
         printf("\n %04x:", c);
@@ -666,6 +694,24 @@ CollationFastLatinBuilder::encodeContractions(UErrorCode &errorCode) {
     return true;
 }
 
+UBool
+CollationFastLatinBuilder::encodeScriptSegments(UErrorCode &errorCode) {
+    // Insert the short-primary script segments and their limit after the varTops.
+    // The expansion and contraction indexes are relative to after the miniCEs,
+    // so they are not affected.
+    if(U_FAILURE(errorCode)) { return false; }
+    scriptSegments[2 * numScriptSegments] = static_cast<char16_t>(shortPrimaryLimit);
+    int32_t length = 2 * numScriptSegments + 1;
+    result.insert(1 + NUM_SPECIAL_GROUPS, scriptSegments, 0, length);
+    headerLength += length;
+    result.setCharAt(0, static_cast<char16_t>((CollationFastLatin::VERSION << 8) | headerLength));
+    if(result.isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return false;
+    }
+    return true;
+}
+
 uint32_t
 CollationFastLatinBuilder::encodeTwoCEs(int64_t first, int64_t second) const {
     if(first == 0) {
@@ -680,8 +726,8 @@ CollationFastLatinBuilder::encodeTwoCEs(int64_t first, int64_t second) const {
     if(miniCE == CollationFastLatin::BAIL_OUT) { return miniCE; }
     if(miniCE >= CollationFastLatin::MIN_SHORT) {
         // Extract & copy the case bits.
-        // Shift them from normal CE bits 15..14 to mini CE bits 4..3.
-        uint32_t c = ((static_cast<uint32_t>(first) & Collation::CASE_MASK) >> (14 - 3));
+        // Shift them from normal CE bits 15..14 to mini CE bits 3..2.
+        uint32_t c = ((static_cast<uint32_t>(first) & Collation::CASE_MASK) >> (14 - 2));
         // Only in mini CEs: Ignorable case bits = 0, lowercase = 1.
         c += CollationFastLatin::LOWER_CASE;
         miniCE |= c;
@@ -706,7 +752,7 @@ CollationFastLatinBuilder::encodeTwoCEs(int64_t first, int64_t second) const {
 
     if(miniCE1 <= CollationFastLatin::SECONDARY_MASK || CollationFastLatin::MIN_SHORT <= miniCE1) {
         // Secondary CE, or a CE with a short primary, copy the case bits.
-        case1 = (case1 >> (14 - 3)) + CollationFastLatin::LOWER_CASE;
+        case1 = (case1 >> (14 - 2)) + CollationFastLatin::LOWER_CASE;
         miniCE1 |= case1;
     }
     return (miniCE << 16) | miniCE1;
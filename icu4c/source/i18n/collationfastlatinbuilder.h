@@ -44,6 +44,8 @@ class U_I18N_API CollationFastLatinBuilder : public UObject {
 private:
     // space, punct, symbol, currency (not digit)
     enum { NUM_SPECIAL_GROUPS = UCOL_REORDER_CODE_CURRENCY - UCOL_REORDER_CODE_FIRST + 1 };
+    static_assert(NUM_SPECIAL_GROUPS == CollationFastLatin::NUM_SPECIAL_GROUPS,
+                  "fast Latin header varTops");
 
     UBool loadGroups(const CollationData &data, UErrorCode &errorCode);
     UBool inSameGroup(uint32_t p, uint32_t q) const;
@@ -57,9 +59,10 @@ class U_I18N_API CollationFastLatinBuilder : public UObject {
     void addContractionEntry(int32_t x, int64_t cce0, int64_t cce1, UErrorCode &errorCode);
     void addUniqueCE(int64_t ce, UErrorCode &errorCode);
     uint32_t getMiniCE(int64_t ce) const;
-    UBool encodeUniqueCEs(UErrorCode &errorCode);
+    UBool encodeUniqueCEs(const CollationData &data, UErrorCode &errorCode);
     UBool encodeCharCEs(UErrorCode &errorCode);
     UBool encodeContractions(UErrorCode &errorCode);
+    UBool encodeScriptSegments(UErrorCode &errorCode);
     uint32_t encodeTwoCEs(int64_t first, int64_t second) const;
 
     static UBool isContractionCharCE(int64_t ce) {
@@ -83,13 +86,21 @@ class U_I18N_API CollationFastLatinBuilder : public UObject {
     uint32_t lastSpecialPrimaries[NUM_SPECIAL_GROUPS];
     uint32_t firstDigitPrimary;
     uint32_t firstLatinPrimary;
-    uint32_t lastLatinPrimary;
+    // The last primary weight of Latin or Cyrillic, whichever is higher.
+    uint32_t lastFastPrimary;
     // This determines the first normal primary weight which is mapped to
     // a short mini primary. It must be >=firstDigitPrimary.
     uint32_t firstShortPrimary;
 
     UBool shortPrimaryOverflow;
 
+    // Short-primary script segments for the header: pairs of
+    // (first short mini primary, primary bits 31..16), plus the shortPrimaryLimit.
+    char16_t scriptSegments[2 * CollationFastLatin::MAX_SCRIPT_SEGMENTS + 1];
+    int32_t numScriptSegments;
+    int32_t lastScriptGroup;
+    uint32_t shortPrimaryLimit;
+
     UnicodeString result;
     int32_t headerLength;
 };
@@ -83,47 +83,6 @@ SortKeyByteSink::GetAppendBuffer(int32_t min_capacity,
     }
 }
 
-namespace {
-
-/**
- * uint8_t byte buffer, similar to CharString but simpler.
- */
-class SortKeyLevel : public UMemory {
-public:
-    SortKeyLevel() : len(0), ok(true) {}
-    ~SortKeyLevel() {}
-
-    /** @return false if memory allocation failed */
-    UBool isOk() const { return ok; }
-    UBool isEmpty() const { return len == 0; }
-    int32_t length() const { return len; }
-    const uint8_t *data() const { return buffer.getAlias(); }
-    uint8_t operator[](int32_t index) const { return buffer[index]; }
-
-    uint8_t *data() { return buffer.getAlias(); }
-
-    void appendByte(uint32_t b);
-    void appendWeight16(uint32_t w);
-    void appendWeight32(uint32_t w);
-    void appendReverseWeight16(uint32_t w);
-
-    /** Appends all but the last byte to the sink. The last byte should be the 01 terminator. */
-    void appendTo(ByteSink &sink) const {
-        U_ASSERT(len > 0 && buffer[len - 1] == 1);
-        sink.Append(reinterpret_cast<const char *>(buffer.getAlias()), len - 1);
-    }
-
-private:
-    MaybeStackArray<uint8_t, 40> buffer;
-    int32_t len;
-    UBool ok;
-
-    UBool ensureCapacity(int32_t appendCapacity);
-
-    SortKeyLevel(const SortKeyLevel &other); // forbid copying of this class
-    SortKeyLevel &operator=(const SortKeyLevel &other); // forbid copying of this class
-};
-
 void SortKeyLevel::appendByte(uint32_t b) {
     if(len < buffer.getCapacity() || ensureCapacity(1)) {
         buffer[len++] = static_cast<uint8_t>(b);
@@ -203,8 +162,6 @@ UBool SortKeyLevel::ensureCapacity(int32_t appendCapacity) {
     return true;
 }
 
-}  // namespace
-
 CollationKeys::LevelCallback::~LevelCallback() {}
 
 UBool
@@ -234,6 +191,19 @@ CollationKeys::writeSortKeyUpToQuaternary(CollationIterator &iter,
                                           SortKeyByteSink &sink,
                                           Collation::Level minLevel, LevelCallback &callback,
                                           UBool preflight, UErrorCode &errorCode) {
+    LevelBuffers buffers;
+    writeSortKeyUpToQuaternary(iter, compressibleBytes, settings, sink, minLevel, callback,
+                               preflight, buffers, errorCode);
+}
+
+void
+CollationKeys::writeSortKeyUpToQuaternary(CollationIterator &iter,
+                                          const UBool *compressibleBytes,
+                                          const CollationSettings &settings,
+                                          SortKeyByteSink &sink,
+                                          Collation::Level minLevel, LevelCallback &callback,
+                                          UBool preflight, LevelBuffers &buffers,
+                                          UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return; }
 
     int32_t options = settings.options;
@@ -256,10 +226,14 @@ CollationKeys::writeSortKeyUpToQuaternary(CollationIterator &iter,
 
     uint32_t tertiaryMask = CollationSettings::getTertiaryMask(options);
 
-    SortKeyLevel cases;
-    SortKeyLevel secondaries;
-    SortKeyLevel tertiaries;
-    SortKeyLevel quaternaries;
+    SortKeyLevel &cases = buffers.cases;
+    SortKeyLevel &secondaries = buffers.secondaries;
+    SortKeyLevel &tertiaries = buffers.tertiaries;
+    SortKeyLevel &quaternaries = buffers.quaternaries;
+    cases.clear();
+    secondaries.clear();
+    tertiaries.clear();
+    quaternaries.clear();
 
     uint32_t prevReorderedPrimary = 0;  // 0==no compression
     int32_t commonCases = 0;
@@ -21,7 +21,9 @@
 #include "unicode/bytestream.h"
 #include "unicode/ucol.h"
 #include "charstr.h"
+#include "cmemory.h"
 #include "collation.h"
+#include "uassert.h"
 
 U_NAMESPACE_BEGIN
 
@@ -87,6 +89,50 @@ class SortKeyByteSink : public ByteSink {
     SortKeyByteSink &operator=(const SortKeyByteSink &); // assignment operator not implemented
 };
 
+/**
+ * uint8_t byte buffer, similar to CharString but simpler.
+ */
+class SortKeyLevel : public UMemory {
+public:
+    SortKeyLevel() : len(0), ok(true) {}
+    ~SortKeyLevel() {}
+
+    /** @return false if memory allocation failed */
+    UBool isOk() const { return ok; }
+    UBool isEmpty() const { return len == 0; }
+    /** Empties the buffer but keeps its capacity. */
+    void clear() {
+        len = 0;
+        ok = true;
+    }
+    int32_t length() const { return len; }
+    const uint8_t *data() const { return buffer.getAlias(); }
+    uint8_t operator[](int32_t index) const { return buffer[index]; }
+
+    uint8_t *data() { return buffer.getAlias(); }
+
+    void appendByte(uint32_t b);
+    void appendWeight16(uint32_t w);
+    void appendWeight32(uint32_t w);
+    void appendReverseWeight16(uint32_t w);
+
+    /** Appends all but the last byte to the sink. The last byte should be the 01 terminator. */
+    void appendTo(ByteSink &sink) const {
+        U_ASSERT(len > 0 && buffer[len - 1] == 1);
+        sink.Append(reinterpret_cast<const char *>(buffer.getAlias()), len - 1);
+    }
+
+private:
+    MaybeStackArray<uint8_t, 40> buffer;
+    int32_t len;
+    UBool ok;
+
+    UBool ensureCapacity(int32_t appendCapacity);
+
+    SortKeyLevel(const SortKeyLevel &other); // forbid copying of this class
+    SortKeyLevel &operator=(const SortKeyLevel &other); // forbid copying of this class
+};
+
 class U_I18N_API CollationKeys /* not : public UObject because all methods are static */ {
 public:
     class LevelCallback : public UMemory {
@@ -100,6 +146,26 @@ class U_I18N_API CollationKeys /* not : public UObject because all methods are s
         virtual UBool needToWrite(Collation::Level level);
     };
 
+    /**
+     * Per-level buffers for writeSortKeyUpToQuaternary().
+     * The function clears them before use, so that one instance can be reused
+     * for many sort keys without reallocating the buffers for long strings.
+     */
+    class LevelBuffers : public UMemory {
+    public:
+        LevelBuffers() {}
+    private:
+        friend class CollationKeys;
+
+        LevelBuffers(const LevelBuffers &other) = delete;
+        LevelBuffers &operator=(const LevelBuffers &other) = delete;
+
+        SortKeyLevel cases;
+        SortKeyLevel secondaries;
+        SortKeyLevel tertiaries;
+        SortKeyLevel quaternaries;
+    };
+
     /**
      * Writes the sort key bytes for minLevel up to the iterator data's strength.
      * Optionally writes the case level.
@@ -113,6 +179,17 @@ class U_I18N_API CollationKeys /* not : public UObject because all methods are s
                                            SortKeyByteSink &sink,
                                            Collation::Level minLevel, LevelCallback &callback,
                                            UBool preflight, UErrorCode &errorCode);
+
+    /**
+     * Same as the other overload, but uses the caller's level buffers.
+     */
+    static void writeSortKeyUpToQuaternary(CollationIterator &iter,
+                                           const UBool *compressibleBytes,
+                                           const CollationSettings &settings,
+                                           SortKeyByteSink &sink,
+                                           Collation::Level minLevel, LevelCallback &callback,
+                                           UBool preflight, LevelBuffers &buffers,
+                                           UErrorCode &errorCode);
 private:
     friend struct CollationDataReader;
 
@@ -20,6 +20,7 @@
 
 #include "unicode/ucol.h"
 #include "collation.h"
+#include "collationfastlatin.h"
 #include "sharedobject.h"
 #include "umutex.h"
 
@@ -259,7 +260,7 @@ struct U_I18N_API CollationSettings : public SharedObject {
 
     /** Options for CollationFastLatin. Negative if disabled. */
     int32_t fastLatinOptions;
-    uint16_t fastLatinPrimaries[0x180];
+    uint16_t fastLatinPrimaries[CollationFastLatin::PRIMARIES_CAPACITY];
 
 private:
     void setReorderArrays(const int32_t *codes, int32_t codesLength,
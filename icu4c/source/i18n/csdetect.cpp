@@ -213,6 +213,12 @@ UBool CharsetDetector::getStripTagsFlag() const
     return fStripTags;
 }
 
+void CharsetDetector::setScanLimit(int32_t limit)
+{
+    textIn->setScanLimit(limit);
+    fFreshTextSet = true;
+}
+
 void CharsetDetector::setDeclaredEncoding(const char *encoding, int32_t len) const
 {
     textIn->setDeclaredEncoding(encoding,len);
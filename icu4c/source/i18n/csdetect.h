@@ -53,6 +53,8 @@ class CharsetDetector : public UMemory
 
     UBool getStripTagsFlag() const;
 
+    void setScanLimit(int32_t limit);
+
 //    const char *getCharsetName(int32_t index, UErrorCode& status) const;
 
     static int32_t getDetectableCount();
@@ -40,6 +40,11 @@ int32_t CharsetRecog_2022::match_2022(const uint8_t *text, int32_t textLen, cons
     int32_t shifts = 0;
     int32_t quality;
 
+    // Without any escape there can be no hits.
+    if (textLen <= 0 || uprv_memchr(text, 0x1B, textLen) == nullptr) {
+        return 0;
+    }
+
     i = 0;
     while(i < textLen) {
         if(text[i] == 0x1B) {
@@ -131,7 +131,7 @@ charValue(0), index(-1), nextIndex(0), error(false), done(false)
 
 int32_t IteratedChar::nextByte(InputText *det)
 {
-    if (nextIndex >= det->fRawLength) {
+    if (nextIndex >= det->fScanLength) {
         done = true;
 
         return -1;
@@ -153,6 +153,13 @@ int32_t CharsetRecog_mbcs::match_mbcs(InputText *det, const uint16_t commonChars
     int32_t confidence          = 0;
     IteratedChar iter;
 
+    if (!det->fHighBytes) {
+        // All of the multi-byte charsets read bytes below 0x80 as single byte
+        //   characters, so this is the "not many multi-byte chars" case below
+        //   with every byte counted as one character.
+        return det->fScanLength < 10 ? 0 : 10;
+    }
+
     while (nextChar(&iter, det)) {
         totalCharCount++;
 
@@ -21,7 +21,7 @@
 U_NAMESPACE_BEGIN
 
 NGramParser::NGramParser(const int32_t *theNgramList, const uint8_t *theCharMap)
- : ngram(0), byteIndex(0)
+ : ngram(0), ngrams(nullptr), byteIndex(0)
 {
     ngramList = theNgramList;
     charMap   = theCharMap;
@@ -86,10 +86,53 @@ void NGramParser::lookup(int32_t thisNgram)
 
 }
 
+/*
+ * Hash of an n-gram into the 1024-bit filter used by countHits().
+ */
+static inline uint32_t hashNGram(int32_t value)
+{
+    return (static_cast<uint32_t>(value) * 0x9E3779B1u) >> 22;
+}
+
+/*
+ * Counts the hits of a whole n-gram stream against the table.
+ * Most n-grams are not in the 64-entry table; a bit filter built from
+ * the table rejects nearly all of those without the binary search.
+ */
+void NGramParser::countHits(const int32_t *ngramStream, int32_t streamLength)
+{
+    uint32_t filter[32] = { 0 };
+    int32_t i;
+
+    for (i = 0; i < 64; i += 1) {
+        uint32_t h = hashNGram(ngramList[i]);
+        filter[h >> 5] |= static_cast<uint32_t>(1) << (h & 31);
+    }
+
+    ngramCount = streamLength;
+    hitCount = 0;
+
+    for (i = 0; i < streamLength; i += 1) {
+        int32_t value = ngramStream[i];
+        uint32_t h = hashNGram(value);
+
+        if ((filter[h >> 5] >> (h & 31)) & 1) {
+            if (search(ngramList, value) >= 0) {
+                hitCount += 1;
+            }
+        }
+    }
+}
+
 void NGramParser::addByte(int32_t b)
 {
     ngram = ((ngram << 8) + b) & N_GRAM_MASK;
-    lookup(ngram);
+
+    if (ngrams != nullptr) {
+        ngrams[ngramCount++] = ngram;
+    } else {
+        lookup(ngram);
+    }
 }
 
 int32_t NGramParser::nextByte(InputText *det)
@@ -122,10 +165,28 @@ void NGramParser::parseCharacters(InputText *det)
 
 int32_t NGramParser::parse(InputText *det)
 {
-    parseCharacters(det);
+    // The n-gram stream depends only on the input and the byte map, so it
+    //   is built once and shared by all of the tables for the same charset.
+    //   Each charMap is used by only one kind of parser: the IBM420 parser,
+    //   which reads the input differently, has a charMap of its own.
+    if (det->fNGramCharMap != charMap) {
+        ngrams = det->getNGramBuffer();
 
-    // TODO: Is this OK? The buffer could have ended in the middle of a word...
-    addByte(0x20);
+        parseCharacters(det);
+
+        // TODO: Is this OK? The buffer could have ended in the middle of a word...
+        addByte(0x20);
+
+        if (ngrams != nullptr) {
+            det->fNGramCharMap = charMap;
+            det->fNGramCount = ngramCount;
+            ngrams = nullptr;
+        }
+    }
+
+    if (det->fNGramCharMap == charMap) {
+        countHits(det->fNGrams, det->fNGramCount);
+    }
 
     double rawPercent = static_cast<double>(hitCount) / static_cast<double>(ngramCount);
 
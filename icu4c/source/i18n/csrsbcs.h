@@ -26,6 +26,7 @@ class NGramParser : public UMemory
 
     int32_t ngramCount;
     int32_t hitCount;
+    int32_t *ngrams;    // If not nullptr, addByte() records the n-grams here.
 
 protected:
 	int32_t byteIndex;
@@ -44,6 +45,8 @@ class NGramParser : public UMemory
     int32_t search(const int32_t *table, int32_t value);
 
     void lookup(int32_t thisNgram);
+
+    void countHits(const int32_t *ngramStream, int32_t streamLength);
     
     virtual int32_t nextByte(InputText *det);
 	virtual void parseCharacters(InputText *det);
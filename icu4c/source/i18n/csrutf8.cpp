@@ -35,13 +35,14 @@ UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
     int32_t trailBytes = 0;
     int32_t confidence;
 
-    if (input->fRawLength >= 3 && 
+    if (input->fScanLength >= 3 && 
         inputBytes[0] == 0xEF && inputBytes[1] == 0xBB && inputBytes[2] == 0xBF) {
             hasBOM = true;
     }
 
-    // Scan for multi-byte sequences
-    for (i=0; i < input->fRawLength; i += 1) {
+    // Scan for multi-byte sequences; plain ASCII input has none.
+    int32_t scanLength = input->fHighBytes ? input->fScanLength : 0;
+    for (i=0; i < scanLength; i += 1) {
         int32_t b = inputBytes[i];
 
         if ((b & 0x80) == 0) {
@@ -64,7 +65,7 @@ UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
         for (;;) {
             i += 1;
 
-            if (i >= input->fRawLength) {
+            if (i >= input->fScanLength) {
                 break;
             }
 
@@ -22,6 +22,10 @@ U_NAMESPACE_BEGIN
 
 #define BUFFER_SIZE 8192
 
+// The n-gram stream has at most one entry per input byte plus the final space;
+//   the IBM420 parser expands lam-alef ligatures into two bytes.
+#define NGRAM_BUFFER_SIZE (2 * BUFFER_SIZE + 1)
+
 #define NEW_ARRAY(type,count) (type *) uprv_malloc((count) * sizeof(type))
 #define DELETE_ARRAY(array) uprv_free((void *) (array))
 
@@ -32,7 +36,13 @@ InputText::InputText(UErrorCode &status)
                                                  //   Value is percent, not absolute.
       fDeclaredEncoding(nullptr),
       fRawInput(nullptr),
-      fRawLength(0)
+      fRawLength(0),
+      fScanLimit(0),
+      fScanLength(0),
+      fHighBytes(false),
+      fNGramCharMap(nullptr),
+      fNGrams(nullptr),
+      fNGramCount(0)
 {
     if (fInputBytes == nullptr || fByteStats == nullptr) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -41,6 +51,7 @@ InputText::InputText(UErrorCode &status)
 
 InputText::~InputText()
 {
+    DELETE_ARRAY(fNGrams);
     DELETE_ARRAY(fDeclaredEncoding);
     DELETE_ARRAY(fByteStats);
     DELETE_ARRAY(fInputBytes);
@@ -68,14 +79,54 @@ void InputText::setDeclaredEncoding(const char* encoding, int32_t len)
     }
 }
 
+void InputText::setScanLimit(int32_t limit)
+{
+    fScanLimit = limit;
+}
+
+int32_t *InputText::getNGramBuffer()
+{
+    if (fNGrams == nullptr) {
+        fNGrams = NEW_ARRAY(int32_t, NGRAM_BUFFER_SIZE);
+    }
+
+    return fNGrams;
+}
+
 UBool InputText::isSet() const 
 {
     return fRawInput != nullptr;
 }
 
+/*
+ * Returns true if any of the bytes is >= 0x80, checking 8 bytes at a time.
+ */
+static UBool hasHighBytes(const uint8_t *bytes, int32_t length)
+{
+    int32_t i = 0;
+
+    while (length - i >= 8) {
+        uint64_t word;
+        uprv_memcpy(&word, bytes + i, 8);
+        if ((word & 0x8080808080808080ULL) != 0) {
+            return true;
+        }
+        i += 8;
+    }
+
+    while (i < length) {
+        if (bytes[i++] >= 0x80) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /**
 *  MungeInput - after getting a set of raw input data to be analyzed, preprocess
 *               it by removing what appears to be html markup.
+*               Also collects the byte statistics shared by the recognizers.
 * 
 * @internal
 */
@@ -87,6 +138,11 @@ void InputText::MungeInput(UBool fStripTags) {
     int32_t openTags = 0;
     int32_t badTags  = 0;
 
+    fScanLength = fRawLength;
+    if (fScanLimit > 0 && fScanLength > fScanLimit) {
+        fScanLength = fScanLimit;
+    }
+
     //
     //  html / xml markup stripping.
     //     quick and dirty, not 100% accurate, but hopefully good enough, statistically.
@@ -95,7 +151,7 @@ void InputText::MungeInput(UBool fStripTags) {
     //     guess as to whether the input was actually marked up at all.
     // TODO: Think about how this interacts with EBCDIC charsets that are detected.
     if (fStripTags) {
-        for (srci = 0; srci < fRawLength && dsti < BUFFER_SIZE; srci += 1) {
+        for (srci = 0; srci < fScanLength && dsti < BUFFER_SIZE; srci += 1) {
             b = fRawInput[srci];
 
             if (b == static_cast<uint8_t>(0x3C)) { /* Check for the ASCII '<' */
@@ -125,9 +181,9 @@ void InputText::MungeInput(UBool fStripTags) {
     //    Detection will have to work on the unstripped input.
     //
     if (openTags<5 || openTags/5 < badTags || 
-        (fInputLen < 100 && fRawLength>600))
+        (fInputLen < 100 && fScanLength>600))
     {
-        int32_t limit = fRawLength;
+        int32_t limit = fScanLength;
 
         if (limit > BUFFER_SIZE) {
             limit = BUFFER_SIZE;
@@ -151,12 +207,19 @@ void InputText::MungeInput(UBool fStripTags) {
         fByteStats[fInputBytes[srci]] += 1;
     }
 
+    fC1Bytes = false;
     for (int32_t i = 0x80; i <= 0x9F; i += 1) {
         if (fByteStats[i] != 0) {
             fC1Bytes = true;
             break;
         }
     }
+
+    // Most of the multi-byte recognizers look at the raw input, which may
+    //   extend beyond the munged buffer.
+    fHighBytes = hasHighBytes(fRawInput, fScanLength);
+
+    fNGramCharMap = nullptr;
 }
 
 U_NAMESPACE_END
@@ -35,8 +35,10 @@ class InputText : public UMemory
 
     void setText(const char *in, int32_t len);
     void setDeclaredEncoding(const char *encoding, int32_t len);
+    void setScanLimit(int32_t limit);
     UBool isSet() const; 
     void MungeInput(UBool fStripTags);
+    int32_t *getNGramBuffer();
 
     // The text to be checked.  Markup will have been
     //   removed if appropriate.
@@ -54,6 +56,18 @@ class InputText : public UMemory
     //  If user gave us a stream, it's read to a 
     //   buffer here.
     int32_t                  fRawLength;    // Length of data in fRawInput array.
+    int32_t                  fScanLimit;    // Maximum number of raw bytes to examine, 0 for no limit.
+    int32_t                  fScanLength;   // Number of raw bytes the recognizers examine:
+                                            //   fRawLength capped at fScanLimit.
+    UBool                    fHighBytes;    // True if any of the fScanLength raw bytes is >= 0x80.
+
+    // N-gram stream shared by the single byte recognizers.  All of the
+    //   languages for one charset map the input through the same table,
+    //   so the stream is built once per charMap and then reused.
+    //   Reset by MungeInput().
+    const uint8_t           *fNGramCharMap; // Byte map the stream was built with, or nullptr.
+    int32_t                 *fNGrams;       // Allocated on first use, see getNGramBuffer().
+    int32_t                  fNGramCount;
 
 };
 
@@ -29,6 +29,7 @@
 #include "unicode/uniset.h"
 #include "unicode/unistr.h"
 #include "unicode/usetiter.h"
+#include "unicode/ustring.h"
 #include "unicode/utf8.h"
 #include "unicode/uversion.h"
 #include "bocsu.h"
@@ -964,6 +965,31 @@ UCollationResult compareNFDIter(const Normalizer2Impl &nfcImpl,
     return UCOL_EQUAL;
 }
 
+/**
+ * Returns the length of the identical prefix of left[0..length[ and right[0..length[.
+ * Compares 16 bytes per iteration while possible; compilers turn the pairs of
+ * 64-bit loads into vector compares where available.
+ * Strings with shared prefixes like URLs, file paths or product codes
+ * spend most of their comparison time here.
+ */
+template<typename Unit>
+inline int32_t getIdenticalPrefixLength(const Unit *left, const Unit *right, int32_t length) {
+    constexpr int32_t UNITS_PER_WORD = static_cast<int32_t>(sizeof(uint64_t) / sizeof(Unit));
+    int32_t i = 0;
+    while((length - i) >= 2 * UNITS_PER_WORD) {
+        uint64_t l0, l1, r0, r1;
+        uprv_memcpy(&l0, left + i, sizeof(uint64_t));
+        uprv_memcpy(&l1, left + i + UNITS_PER_WORD, sizeof(uint64_t));
+        uprv_memcpy(&r0, right + i, sizeof(uint64_t));
+        uprv_memcpy(&r1, right + i + UNITS_PER_WORD, sizeof(uint64_t));
+        if(((l0 ^ r0) | (l1 ^ r1)) != 0) { break; }
+        i += 2 * UNITS_PER_WORD;
+    }
+    // Find the first difference within the last block, or compare the tail.
+    while(i < length && left[i] == right[i]) { ++i; }
+    return i;
+}
+
 }  // namespace
 
 UCollationResult
@@ -990,15 +1016,10 @@ RuleBasedCollator::doCompare(const char16_t *left, int32_t leftLength,
     } else {
         leftLimit = left + leftLength;
         rightLimit = right + rightLength;
-        for(;;) {
-            if(equalPrefixLength == leftLength) {
-                if(equalPrefixLength == rightLength) { return UCOL_EQUAL; }
-                break;
-            } else if(equalPrefixLength == rightLength ||
-                      left[equalPrefixLength] != right[equalPrefixLength]) {
-                break;
-            }
-            ++equalPrefixLength;
+        equalPrefixLength = getIdenticalPrefixLength(
+            left, right, leftLength <= rightLength ? leftLength : rightLength);
+        if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+            return UCOL_EQUAL;
         }
     }
 
@@ -1025,9 +1046,9 @@ RuleBasedCollator::doCompare(const char16_t *left, int32_t leftLength,
     int32_t fastLatinOptions = settings->fastLatinOptions;
     if(fastLatinOptions >= 0 &&
             (equalPrefixLength == leftLength ||
-                left[equalPrefixLength] <= CollationFastLatin::LATIN_MAX) &&
+                left[equalPrefixLength] <= CollationFastLatin::FAST_START_MAX) &&
             (equalPrefixLength == rightLength ||
-                right[equalPrefixLength] <= CollationFastLatin::LATIN_MAX)) {
+                right[equalPrefixLength] <= CollationFastLatin::FAST_START_MAX)) {
         if(leftLength >= 0) {
             result = CollationFastLatin::compareUTF16(data->fastLatinTable,
                                                       settings->fastLatinPrimaries,
@@ -1103,15 +1124,10 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
             ++equalPrefixLength;
         }
     } else {
-        for(;;) {
-            if(equalPrefixLength == leftLength) {
-                if(equalPrefixLength == rightLength) { return UCOL_EQUAL; }
-                break;
-            } else if(equalPrefixLength == rightLength ||
-                      left[equalPrefixLength] != right[equalPrefixLength]) {
-                break;
-            }
-            ++equalPrefixLength;
+        equalPrefixLength = getIdenticalPrefixLength(
+            left, right, leftLength <= rightLength ? leftLength : rightLength);
+        if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+            return UCOL_EQUAL;
         }
     }
     // Back up to the start of a partially-equal code point.
@@ -1154,9 +1170,9 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
     int32_t fastLatinOptions = settings->fastLatinOptions;
     if(fastLatinOptions >= 0 &&
             (equalPrefixLength == leftLength ||
-                left[equalPrefixLength] <= CollationFastLatin::LATIN_MAX_UTF8_LEAD) &&
+                left[equalPrefixLength] <= CollationFastLatin::FAST_START_MAX_UTF8_LEAD) &&
             (equalPrefixLength == rightLength ||
-                right[equalPrefixLength] <= CollationFastLatin::LATIN_MAX_UTF8_LEAD)) {
+                right[equalPrefixLength] <= CollationFastLatin::FAST_START_MAX_UTF8_LEAD)) {
         if(leftLength >= 0) {
             result = CollationFastLatin::compareUTF8(data->fastLatinTable,
                                                      settings->fastLatinPrimaries,
@@ -1330,6 +1346,149 @@ RuleBasedCollator::getSortKey(const char16_t *s, int32_t length,
     return U_SUCCESS(errorCode) ? sink.NumberOfBytesAppended() : 0;
 }
 
+int32_t
+RuleBasedCollator::getSortKeyUTF8(const char *s, int32_t length,
+                                  uint8_t *dest, int32_t capacity) const {
+    if((s == nullptr && length != 0) || capacity < 0 || (dest == nullptr && capacity > 0)) {
+        return 0;
+    }
+    if(s == nullptr) {
+        s = "";
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == nullptr) {
+        // Distinguish pure preflighting from an allocation error.
+        dest = noDest;
+        capacity = 0;
+    }
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), capacity);
+    UErrorCode errorCode = U_ZERO_ERROR;
+    writeSortKeyUTF8(s, length, sink, errorCode);
+    return U_SUCCESS(errorCode) ? sink.NumberOfBytesAppended() : 0;
+}
+
+int32_t
+RuleBasedCollator::getSortKeys(const char16_t *const *sources, const int32_t *sourceLengths,
+                               int32_t count, uint8_t *dest, int32_t destCapacity,
+                               int32_t *offsets, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(count < 0 || (sources == nullptr && count > 0) ||
+            destCapacity < 0 || (dest == nullptr && destCapacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == nullptr) {
+        // Distinguish pure preflighting from an allocation error.
+        dest = noDest;
+    }
+    // One iterator and one set of level buffers for all of the strings.
+    UBool numeric = settings->isNumeric();
+    UBool checkFCD = !settings->dontCheckFCD();
+    UBool identical = settings->getStrength() == UCOL_IDENTICAL;
+    UTF16CollationIterator iter(data, numeric, nullptr, nullptr, nullptr);
+    FCDUTF16CollationIterator fcdIter(data, numeric, nullptr, nullptr, nullptr);
+    CollationKeys::LevelCallback callback;
+    CollationKeys::LevelBuffers buffers;
+    int32_t length = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        const char16_t *s = sources[i];
+        int32_t sLength = (sourceLengths != nullptr) ? sourceLengths[i] : -1;
+        if(s == nullptr && sLength != 0) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        const char16_t *limit = (sLength >= 0) ? s + sLength : nullptr;
+        if(offsets != nullptr) { offsets[i] = length; }
+        // Once the buffer is full, continue with a zero-capacity sink for preflighting.
+        int32_t start = (length < destCapacity) ? length : destCapacity;
+        FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest) + start, destCapacity - start);
+        CollationIterator *ci;
+        if(checkFCD) {
+            fcdIter.setText(s, limit);
+            ci = &fcdIter;
+        } else {
+            iter.setText(s, limit);
+            ci = &iter;
+        }
+        CollationKeys::writeSortKeyUpToQuaternary(*ci, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, true, buffers, errorCode);
+        if(identical) {
+            writeIdenticalLevel(s, limit, sink, errorCode);
+        }
+        static const char terminator = 0;  // TERMINATOR_BYTE
+        sink.Append(&terminator, 1);
+        if(U_FAILURE(errorCode)) { return 0; }
+        length += sink.NumberOfBytesAppended();
+    }
+    if(offsets != nullptr) { offsets[count] = length; }
+    if(length > destCapacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return length;
+}
+
+int32_t
+RuleBasedCollator::getSortKeysUTF8(const char *const *sources, const int32_t *sourceLengths,
+                                   int32_t count, uint8_t *dest, int32_t destCapacity,
+                                   int32_t *offsets, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(count < 0 || (sources == nullptr && count > 0) ||
+            destCapacity < 0 || (dest == nullptr && destCapacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == nullptr) {
+        // Distinguish pure preflighting from an allocation error.
+        dest = noDest;
+    }
+    UBool numeric = settings->isNumeric();
+    UBool checkFCD = !settings->dontCheckFCD();
+    UBool identical = settings->getStrength() == UCOL_IDENTICAL;
+    UTF8CollationIterator iter(data, numeric, nullptr, 0, 0);
+    FCDUTF8CollationIterator fcdIter(data, numeric, nullptr, 0, 0);
+    CollationKeys::LevelCallback callback;
+    CollationKeys::LevelBuffers buffers;
+    UnicodeString utf16;  // Reused for the identical level.
+    int32_t length = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        const uint8_t *s = reinterpret_cast<const uint8_t *>(sources[i]);
+        int32_t sLength = (sourceLengths != nullptr) ? sourceLengths[i] : -1;
+        if(s == nullptr && sLength != 0) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        if(offsets != nullptr) { offsets[i] = length; }
+        int32_t start = (length < destCapacity) ? length : destCapacity;
+        FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest) + start, destCapacity - start);
+        CollationIterator *ci;
+        if(checkFCD) {
+            fcdIter.setText(s, sLength);
+            ci = &fcdIter;
+        } else {
+            iter.setText(s, sLength);
+            ci = &iter;
+        }
+        CollationKeys::writeSortKeyUpToQuaternary(*ci, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, true, buffers, errorCode);
+        if(identical) {
+            writeIdenticalLevelUTF8(sources[i], sLength, utf16, sink, errorCode);
+        }
+        static const char terminator = 0;  // TERMINATOR_BYTE
+        sink.Append(&terminator, 1);
+        if(U_FAILURE(errorCode)) { return 0; }
+        length += sink.NumberOfBytesAppended();
+    }
+    if(offsets != nullptr) { offsets[count] = length; }
+    if(length > destCapacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return length;
+}
+
 void
 RuleBasedCollator::writeSortKey(const char16_t *s, int32_t length,
                                 SortKeyByteSink &sink, UErrorCode &errorCode) const {
@@ -1355,6 +1514,32 @@ RuleBasedCollator::writeSortKey(const char16_t *s, int32_t length,
     sink.Append(&terminator, 1);
 }
 
+void
+RuleBasedCollator::writeSortKeyUTF8(const char *s, int32_t length,
+                                    SortKeyByteSink &sink, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(s);
+    UBool numeric = settings->isNumeric();
+    CollationKeys::LevelCallback callback;
+    if(settings->dontCheckFCD()) {
+        UTF8CollationIterator iter(data, numeric, bytes, 0, length);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, true, errorCode);
+    } else {
+        FCDUTF8CollationIterator iter(data, numeric, bytes, 0, length);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, true, errorCode);
+    }
+    if(settings->getStrength() == UCOL_IDENTICAL) {
+        UnicodeString utf16;
+        writeIdenticalLevelUTF8(s, length, utf16, sink, errorCode);
+    }
+    static const char terminator = 0;  // TERMINATOR_BYTE
+    sink.Append(&terminator, 1);
+}
+
 void
 RuleBasedCollator::writeIdenticalLevel(const char16_t *s, const char16_t *limit,
                                        SortKeyByteSink &sink, UErrorCode &errorCode) const {
@@ -1381,6 +1566,26 @@ RuleBasedCollator::writeIdenticalLevel(const char16_t *s, const char16_t *limit,
     u_writeIdenticalLevelRun(prev, nfd.getBuffer(), nfd.length(), sink);
 }
 
+void
+RuleBasedCollator::writeIdenticalLevelUTF8(const char *s, int32_t length, UnicodeString &utf16,
+                                           SortKeyByteSink &sink, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    if(length < 0) {
+        length = static_cast<int32_t>(uprv_strlen(s));
+    }
+    // The UTF-16 string is never longer than the UTF-8 string.
+    char16_t *buffer = utf16.getBuffer(length);
+    if(buffer == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t utf16Length = 0;
+    u_strFromUTF8WithSub(buffer, utf16.getCapacity(), &utf16Length,
+                         s, length, 0xfffd, nullptr, &errorCode);
+    utf16.releaseBuffer(U_SUCCESS(errorCode) ? utf16Length : 0);
+    writeIdenticalLevel(utf16.getBuffer(), utf16.getBuffer() + utf16.length(), sink, errorCode);
+}
+
 namespace {
 
 /**
@@ -1489,6 +1694,101 @@ RuleBasedCollator::internalNextSortKeyPart(UCharIterator *iter, uint32_t state[2
     return length;
 }
 
+namespace {
+
+/**
+ * Appends the sort key terminator if it still fits,
+ * and pads dest with zero bytes.
+ * Returns the number of sort key bytes in dest.
+ */
+int32_t finishSortKeyPrefix(FixedSortKeyByteSink &sink, uint8_t *dest, int32_t capacity,
+                            UBool &isComplete, UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(!sink.Overflowed()) {
+        static const char terminator = 0;  // TERMINATOR_BYTE
+        sink.Append(&terminator, 1);
+    }
+    int32_t length = sink.NumberOfBytesAppended();
+    isComplete = length <= capacity;
+    if(!isComplete) {
+        length = capacity;
+    }
+    uprv_memset(dest + length, 0, capacity - length);
+    return length;
+}
+
+}  // namespace
+
+int32_t
+RuleBasedCollator::getSortKeyPrefix(const char16_t *s, int32_t length,
+                                    uint8_t *dest, int32_t destCapacity,
+                                    UBool &isComplete, UErrorCode &errorCode) const {
+    isComplete = false;
+    if(U_FAILURE(errorCode)) { return 0; }
+    if((s == nullptr && length != 0) || dest == nullptr || destCapacity <= 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(s == nullptr) {
+        s = u"";
+    }
+    const char16_t *limit = (length >= 0) ? s + length : nullptr;
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), destCapacity);
+    // Skips the remaining levels once the prefix is full.
+    PartLevelCallback callback(sink);
+    UBool numeric = settings->isNumeric();
+    if(settings->dontCheckFCD()) {
+        UTF16CollationIterator iter(data, numeric, s, s, limit);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, false, errorCode);
+    } else {
+        FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, false, errorCode);
+    }
+    if(settings->getStrength() == UCOL_IDENTICAL && !sink.Overflowed()) {
+        writeIdenticalLevel(s, limit, sink, errorCode);
+    }
+    return finishSortKeyPrefix(sink, dest, destCapacity, isComplete, errorCode);
+}
+
+int32_t
+RuleBasedCollator::getSortKeyPrefixUTF8(const char *s, int32_t length,
+                                        uint8_t *dest, int32_t destCapacity,
+                                        UBool &isComplete, UErrorCode &errorCode) const {
+    isComplete = false;
+    if(U_FAILURE(errorCode)) { return 0; }
+    if((s == nullptr && length != 0) || dest == nullptr || destCapacity <= 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if(s == nullptr) {
+        s = "";
+    }
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(s);
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), destCapacity);
+    PartLevelCallback callback(sink);
+    UBool numeric = settings->isNumeric();
+    if(settings->dontCheckFCD()) {
+        UTF8CollationIterator iter(data, numeric, bytes, 0, length);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, false, errorCode);
+    } else {
+        FCDUTF8CollationIterator iter(data, numeric, bytes, 0, length);
+        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                                  sink, Collation::PRIMARY_LEVEL,
+                                                  callback, false, errorCode);
+    }
+    if(settings->getStrength() == UCOL_IDENTICAL && !sink.Overflowed()) {
+        UnicodeString utf16;
+        writeIdenticalLevelUTF8(s, length, utf16, sink, errorCode);
+    }
+    return finishSortKeyPrefix(sink, dest, destCapacity, isComplete, errorCode);
+}
+
 void
 RuleBasedCollator::internalGetCEs(const UnicodeString &str, UVector64 &ces,
                                   UErrorCode &errorCode) const {
@@ -1511,6 +1811,19 @@ RuleBasedCollator::internalGetCEs(const UnicodeString &str, UVector64 &ces,
     }
 }
 
+UBool
+RuleBasedCollator::internalHasContext(UChar32 c) const {
+    uint32_t ce32 = data->getCE32(c);
+    if(ce32 == Collation::FALLBACK_CE32) {
+        ce32 = data->base->getCE32(c);
+    }
+    if(!Collation::isSpecialCE32(ce32)) { return false; }
+    int32_t tag = Collation::tagFromCE32(ce32);
+    return tag == Collation::CONTRACTION_TAG || tag == Collation::PREFIX_TAG ||
+        (tag == Collation::DIGIT_TAG && settings->isNumeric()) ||
+        (tag == Collation::HANGUL_TAG && (ce32 & Collation::HANGUL_NO_SPECIAL_JAMO) == 0);
+}
+
 namespace {
 
 void appendSubtag(CharString &s, char letter, const char *subtag, int32_t length,
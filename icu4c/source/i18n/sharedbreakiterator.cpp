@@ -12,6 +12,9 @@
 */
 #include "sharedbreakiterator.h"
 #include "unicode/brkiter.h"
+#include "unicode/utext.h"
+#include "cmemory.h"
+#include "uvector.h"
 
 #if !UCONFIG_NO_BREAK_ITERATION
 
@@ -24,6 +27,239 @@ SharedBreakIterator::~SharedBreakIterator() {
   delete ptr;
 }
 
+// The prototype and the idle iterators for one locale/type pair.
+// Referenced by the pool's entries table while it is in the pool,
+// and by the pool's leases table once for each leased iterator,
+// so that flush() can remove it while some of its iterators are leased.
+struct BreakIteratorPoolEntry : public SharedObject {
+    BreakIteratorPoolEntry(const SharedBreakIterator *proto, UErrorCode &status)
+            : prototype(proto), idle(uprv_deleteUObject, nullptr, status) {
+        prototype->addRef();
+    }
+    ~BreakIteratorPoolEntry() {
+        prototype->removeRef();
+    }
+
+    const SharedBreakIterator *prototype;
+    UVector idle;
+    // false once flush() removed the entry from the pool
+    UBool inPool = true;
+};
+
+namespace {
+
+const char16_t gEmptyText[] = { 0 };
+
+inline BreakIteratorPoolEntry *getEntry(const Hashtable &entries, const UnicodeString &key) {
+    return static_cast<BreakIteratorPoolEntry *>(entries.get(key));
+}
+
+}  // namespace
+
+U_CDECL_BEGIN
+static void U_CALLCONV
+removeBreakIteratorPoolEntry(void *obj) {
+    BreakIteratorPoolEntry *entry = static_cast<BreakIteratorPoolEntry *>(obj);
+    entry->inPool = false;
+    entry->idle.removeAllElements();
+    entry->removeRef();
+}
+
+static void U_CALLCONV
+releaseBreakIteratorPoolEntry(void *obj) {
+    static_cast<BreakIteratorPoolEntry *>(obj)->removeRef();
+}
+
+static int32_t U_CALLCONV
+hashBreakIteratorPointer(const UHashTok key) {
+    uint64_t p = reinterpret_cast<uintptr_t>(key.pointer);
+    return static_cast<int32_t>((p >> 3) ^ (p >> 35));
+}
+
+static UBool U_CALLCONV
+compareBreakIteratorPointers(const UHashTok key1, const UHashTok key2) {
+    return key1.pointer == key2.pointer;
+}
+U_CDECL_END
+
+BreakIteratorPool::BreakIteratorPool(int32_t maxIdlePerKey, UErrorCode &status)
+        : entries(status),
+          leases(uhash_open(hashBreakIteratorPointer, compareBreakIteratorPointers, nullptr, &status)),
+          maxIdle(maxIdlePerKey < 0 ? 0 : maxIdlePerKey) {
+    if (U_SUCCESS(status)) {
+        entries.setValueDeleter(removeBreakIteratorPoolEntry);
+        uhash_setValueDeleter(leases.getAlias(), releaseBreakIteratorPoolEntry);
+    }
+}
+
+BreakIteratorPool::~BreakIteratorPool() {}
+
+void BreakIteratorPool::makeKey(const Locale &locale, UBreakIteratorType type, UnicodeString &key) {
+    key.append(static_cast<char16_t>(u'0' + type)).append(u'/');
+    key.append(UnicodeString(locale.getName(), -1, US_INV));
+}
+
+// Creates the prototype for the locale/type pair and adds its entry to the pool,
+// unless another thread added one in the meantime.
+// Returns the pool's entry for the key with a reference for the caller.
+BreakIteratorPoolEntry *
+BreakIteratorPool::createEntry(const Locale &locale, UBreakIteratorType type,
+                               const UnicodeString &key, UErrorCode &status) {
+    LocalPointer<BreakIterator> bi;
+    switch (type) {
+    case UBRK_CHARACTER:
+        bi.adoptInstead(BreakIterator::createCharacterInstance(locale, status));
+        break;
+    case UBRK_WORD:
+        bi.adoptInstead(BreakIterator::createWordInstance(locale, status));
+        break;
+    case UBRK_LINE:
+        bi.adoptInstead(BreakIterator::createLineInstance(locale, status));
+        break;
+    case UBRK_SENTENCE:
+        bi.adoptInstead(BreakIterator::createSentenceInstance(locale, status));
+        break;
+    default:
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        break;
+    }
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    SharedBreakIterator *shared = new SharedBreakIterator(bi.getAlias());
+    if (shared == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    bi.orphan();
+    shared->addRef();
+    BreakIteratorPoolEntry *entry = new BreakIteratorPoolEntry(shared, status);
+    shared->removeRef();
+    if (entry == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    entry->addRef();
+    if (U_FAILURE(status)) {
+        entry->removeRef();
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    // Another thread may have created the same entry in the meantime;
+    // keep the first one.
+    BreakIteratorPoolEntry *existing = getEntry(entries, key);
+    if (existing != nullptr) {
+        entry->removeRef();
+        existing->addRef();
+        return existing;
+    }
+    // The entries table holds its own reference,
+    // which put() releases if it fails.
+    entry->addRef();
+    entries.put(key, entry, status);
+    if (U_FAILURE(status)) {
+        entry->removeRef();
+        return nullptr;
+    }
+    return entry;
+}
+
+// Records that bi was handed out for the entry.
+// Must be called with the mutex held. Deletes bi on failure.
+BreakIterator *
+BreakIteratorPool::addLease(BreakIterator *bi, BreakIteratorPoolEntry *entry, UErrorCode &status) {
+    // The leases table holds a reference to the entry,
+    // which uhash_put() releases if it fails.
+    entry->addRef();
+    uhash_put(leases.getAlias(), bi, entry, &status);
+    if (U_FAILURE(status)) {
+        delete bi;
+        return nullptr;
+    }
+    return bi;
+}
+
+BreakIterator *
+BreakIteratorPool::acquire(const Locale &locale, UBreakIteratorType type, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    UnicodeString key;
+    makeKey(locale, type, key);
+    BreakIteratorPoolEntry *entry = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entry = getEntry(entries, key);
+        if (entry != nullptr) {
+            if (!entry->idle.isEmpty()) {
+                BreakIterator *bi =
+                    static_cast<BreakIterator *>(entry->idle.orphanElementAt(entry->idle.size() - 1));
+                return addLease(bi, entry, status);
+            }
+            entry->addRef();
+        }
+    }
+    if (entry == nullptr) {
+        entry = createEntry(locale, type, key, status);
+        if (entry == nullptr) {
+            return nullptr;
+        }
+    }
+    // Cloning is thread-safe and shares the compiled rule data.
+    BreakIterator *result = (*entry->prototype)->clone();
+    if (result == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    } else {
+        std::lock_guard<std::mutex> lock(mutex);
+        result = addLease(result, entry, status);
+    }
+    entry->removeRef();
+    return result;
+}
+
+void BreakIteratorPool::release(BreakIterator *bi) {
+    if (bi == nullptr) {
+        return;
+    }
+    // Drop the reference to the caller's text before the iterator is shared again.
+    UErrorCode status = U_ZERO_ERROR;
+    UText empty = UTEXT_INITIALIZER;
+    utext_openUChars(&empty, gEmptyText, 0, &status);
+    bi->setText(&empty, status);
+    utext_close(&empty);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        BreakIteratorPoolEntry *entry =
+            static_cast<BreakIteratorPoolEntry *>(uhash_get(leases.getAlias(), bi));
+        if (entry != nullptr) {
+            UBool keep = U_SUCCESS(status) && entry->inPool && entry->idle.size() < maxIdle;
+            if (keep) {
+                // adoptElement() deletes bi on failure.
+                entry->idle.adoptElement(bi, status);
+            }
+            // Releases the lease's reference to the entry.
+            uhash_remove(leases.getAlias(), bi);
+            if (keep) {
+                return;
+            }
+        }
+    }
+    delete bi;
+}
+
+void BreakIteratorPool::flush() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.removeAll();
+}
+
+BreakIteratorLease::BreakIteratorLease(BreakIteratorPool &pool, const Locale &locale,
+                                       UBreakIteratorType type, UErrorCode &status)
+        : pool(pool), ptr(pool.acquire(locale, type, status)) {}
+
+BreakIteratorLease::~BreakIteratorLease() {
+    pool.release(ptr);
+}
+
 U_NAMESPACE_END
 
 #endif /* #if !UCONFIG_NO_BREAK_ITERATION */
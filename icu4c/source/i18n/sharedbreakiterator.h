@@ -12,13 +12,21 @@
 #define __SHARED_BREAKITERATOR_H__
 
 #include "unicode/utypes.h"
+#include "unicode/ubrk.h"
+#include "unicode/locid.h"
+#include "unicode/uobject.h"
+#include "hash.h"
 #include "sharedobject.h"
+#include "uhash.h"
+
+#include <mutex>
 
 #if !UCONFIG_NO_BREAK_ITERATION
 
 U_NAMESPACE_BEGIN
 
 class BreakIterator;
+struct BreakIteratorPoolEntry;
 
 // SharedBreakIterator encapsulates a shared BreakIterator. Because
 // BreakIterator has mutable semantics, clients must ensure that all uses
@@ -42,6 +50,76 @@ class U_I18N_API SharedBreakIterator : public SharedObject {
     SharedBreakIterator &operator=(const SharedBreakIterator &) = delete;
 };
 
+// BreakIteratorPool hands out break iterators for a locale and break type
+// without paying the full construction cost on every request.
+// The first request for a locale/type pair creates a prototype through the
+// regular BreakIterator factories and stores it as a SharedBreakIterator;
+// later requests reuse an idle iterator that was released back to the pool,
+// or clone the prototype, which shares its RBBIDataWrapper by reference.
+//
+// Iterators are released with no text set (an empty string), so the pool
+// never keeps a reference to caller text. The pool remembers the locale/type
+// pair of each iterator that it hands out, and release() returns the iterator
+// to that pair. A pool is safe for concurrent use by multiple threads;
+// a leased iterator belongs to a single thread until it is released.
+// All leased iterators must be released before the pool is destroyed.
+class U_I18N_API BreakIteratorPool : public UMemory {
+public:
+    // maxIdlePerKey bounds the number of idle iterators that are kept for
+    // each locale/type pair; excess iterators are deleted on release.
+    BreakIteratorPool(int32_t maxIdlePerKey, UErrorCode &status);
+    ~BreakIteratorPool();
+
+    // Returns an iterator with no text set. The caller owns it until it is
+    // passed back to release().
+    BreakIterator *acquire(const Locale &locale, UBreakIteratorType type, UErrorCode &status);
+
+    // Resets an iterator that acquire() returned and keeps it for a later
+    // acquire() with the same locale and type.
+    // Adopts bi; nullptr is ignored, and an iterator that this pool did not
+    // hand out, or that was acquired before flush(), is deleted.
+    void release(BreakIterator *bi);
+
+    // Deletes all idle iterators and prototypes.
+    void flush();
+
+private:
+    static void makeKey(const Locale &locale, UBreakIteratorType type, UnicodeString &key);
+    BreakIteratorPoolEntry *createEntry(const Locale &locale, UBreakIteratorType type,
+                                        const UnicodeString &key, UErrorCode &status);
+    BreakIterator *addLease(BreakIterator *bi, BreakIteratorPoolEntry *entry, UErrorCode &status);
+
+    // Guards entries and leases; it is only held for table and idle list updates,
+    // never while an iterator is created or cloned.
+    std::mutex mutex;
+    // Key: locale/type pair. Value: BreakIteratorPoolEntry.
+    Hashtable entries;
+    // Key: leased BreakIterator. Value: its BreakIteratorPoolEntry.
+    LocalUHashtablePointer leases;
+    int32_t maxIdle;
+
+    BreakIteratorPool(const BreakIteratorPool &) = delete;
+    BreakIteratorPool &operator=(const BreakIteratorPool &) = delete;
+};
+
+// BreakIteratorLease acquires an iterator from a pool and returns it
+// when it goes out of scope.
+class U_I18N_API BreakIteratorLease : public UMemory {
+public:
+    BreakIteratorLease(BreakIteratorPool &pool, const Locale &locale, UBreakIteratorType type,
+                       UErrorCode &status);
+    ~BreakIteratorLease();
+
+    BreakIterator *get() const { return ptr; }
+    BreakIterator *operator->() const { return ptr; }
+    BreakIterator &operator*() const { return *ptr; }
+private:
+    BreakIteratorPool &pool;
+    BreakIterator *ptr;
+    BreakIteratorLease(const BreakIteratorLease &) = delete;
+    BreakIteratorLease &operator=(const BreakIteratorLease &) = delete;
+};
+
 U_NAMESPACE_END
 
 #endif
@@ -23,11 +23,15 @@
 
 #if !UCONFIG_NO_COLLATION
 
+#include <algorithm>
+
 #include "unicode/coll.h"
 #include "unicode/tblcoll.h"
 #include "unicode/bytestream.h"
 #include "unicode/coleitr.h"
+#include "unicode/sortkey.h"
 #include "unicode/ucoleitr.h"
+#include "unicode/uiter.h"
 #include "unicode/ustring.h"
 #include "cmemory.h"
 #include "collation.h"
@@ -215,6 +219,423 @@ ucol_getSortKey(const    UCollator    *coll,
     return keySize;
 }
 
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeyUTF8(const UCollator *coll,
+                    const char *source, int32_t sourceLength,
+                    uint8_t *result, int32_t resultLength)
+{
+    UTRACE_ENTRY(UTRACE_UCOL_GET_SORTKEY);
+    if (UTRACE_LEVEL(UTRACE_VERBOSE)) {
+        UTRACE_DATA3(UTRACE_VERBOSE, "coll=%p, source string = %vb ", coll, source,
+            ((sourceLength==-1 && source!=nullptr) ? static_cast<int32_t>(uprv_strlen(source)) : sourceLength));
+    }
+
+    int32_t keySize;
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if (rbc != nullptr) {
+        keySize = rbc->getSortKeyUTF8(source, sourceLength, result, resultLength);
+    } else if (source == nullptr && sourceLength != 0) {
+        keySize = 0;
+    } else {
+        if (source == nullptr) { source = ""; }
+        StringPiece s = (sourceLength < 0) ? StringPiece(source) : StringPiece(source, sourceLength);
+        keySize = Collator::fromUCollator(coll)->
+                getSortKey(UnicodeString::fromUTF8(s), result, resultLength);
+    }
+
+    UTRACE_DATA2(UTRACE_VERBOSE, "Sort Key = %vb", result, keySize);
+    UTRACE_EXIT_VALUE(keySize);
+    return keySize;
+}
+
+namespace {
+
+/**
+ * Concatenates sort keys from Collator::getSortKey(),
+ * for collators other than RuleBasedCollator.
+ */
+class SortKeyConcatenator {
+public:
+    SortKeyConcatenator(uint8_t *dest, int32_t capacity, int32_t *offsets)
+            : dest_(dest), capacity_(capacity), offsets_(offsets), length_(0) {}
+
+    void append(const Collator &coll, int32_t i, const UnicodeString &s, UErrorCode &errorCode) {
+        if(U_FAILURE(errorCode)) { return; }
+        if(offsets_ != nullptr) { offsets_[i] = length_; }
+        int32_t start = (length_ < capacity_) ? length_ : capacity_;
+        int32_t keyLength = coll.getSortKey(s, dest_ != nullptr ? dest_ + start : nullptr,
+                                            capacity_ - start);
+        if(keyLength == 0) {
+            errorCode = U_INTERNAL_PROGRAM_ERROR;
+        }
+        length_ += keyLength;
+    }
+
+    int32_t finish(int32_t count, UErrorCode &errorCode) {
+        if(U_FAILURE(errorCode)) { return 0; }
+        if(offsets_ != nullptr) { offsets_[count] = length_; }
+        if(length_ > capacity_) {
+            errorCode = U_BUFFER_OVERFLOW_ERROR;
+        }
+        return length_;
+    }
+
+private:
+    uint8_t *dest_;
+    int32_t capacity_;
+    int32_t *offsets_;
+    int32_t length_;
+};
+
+UBool
+checkSortKeysArgs(const void *sources, int32_t count,
+                  const uint8_t *dest, int32_t destCapacity, UErrorCode *status) {
+    if(status == nullptr || U_FAILURE(*status)) {
+        return false;
+    }
+    if(count < 0 || (sources == nullptr && count > 0) ||
+            destCapacity < 0 || (dest == nullptr && destCapacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const char16_t *const *sources, const int32_t *sourceLengths, int32_t count,
+                 uint8_t *dest, int32_t destCapacity,
+                 int32_t *offsets, UErrorCode *status) {
+    if(!checkSortKeysArgs(sources, count, dest, destCapacity, status)) {
+        return 0;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != nullptr) {
+        return rbc->getSortKeys(sources, sourceLengths, count,
+                                dest, destCapacity, offsets, *status);
+    }
+    const Collator &c = *Collator::fromUCollator(coll);
+    SortKeyConcatenator keys(dest, destCapacity, offsets);
+    for(int32_t i = 0; i < count && U_SUCCESS(*status); ++i) {
+        int32_t length = (sourceLengths != nullptr) ? sourceLengths[i] : -1;
+        if(sources[i] == nullptr && length != 0) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        keys.append(c, i, UnicodeString(length < 0, ConstChar16Ptr(sources[i]), length), *status);
+    }
+    return keys.finish(count, *status);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeysUTF8(const UCollator *coll,
+                     const char *const *sources, const int32_t *sourceLengths, int32_t count,
+                     uint8_t *dest, int32_t destCapacity,
+                     int32_t *offsets, UErrorCode *status) {
+    if(!checkSortKeysArgs(sources, count, dest, destCapacity, status)) {
+        return 0;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != nullptr) {
+        return rbc->getSortKeysUTF8(sources, sourceLengths, count,
+                                    dest, destCapacity, offsets, *status);
+    }
+    const Collator &c = *Collator::fromUCollator(coll);
+    SortKeyConcatenator keys(dest, destCapacity, offsets);
+    for(int32_t i = 0; i < count && U_SUCCESS(*status); ++i) {
+        int32_t length = (sourceLengths != nullptr) ? sourceLengths[i] : -1;
+        if(sources[i] == nullptr && length != 0) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        StringPiece s = (length < 0) ? StringPiece(sources[i]) : StringPiece(sources[i], length);
+        keys.append(c, i, UnicodeString::fromUTF8(s), *status);
+    }
+    return keys.finish(count, *status);
+}
+
+namespace {
+
+UBool
+checkSortKeyPrefixArgs(const UCollator *coll, const void *source, int32_t sourceLength,
+                       const uint8_t *dest, int32_t destCapacity, UErrorCode *status) {
+    if(status == nullptr || U_FAILURE(*status)) {
+        return false;
+    }
+    if(coll == nullptr || (source == nullptr && sourceLength != 0) ||
+            dest == nullptr || destCapacity <= 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Truncates or pads a full sort key from Collator::getCollationKey(),
+ * for collators other than RuleBasedCollator.
+ */
+int32_t
+copySortKeyPrefix(const Collator &coll, const UnicodeString &s,
+                  uint8_t *dest, int32_t destCapacity, UBool *isComplete, UErrorCode &errorCode) {
+    CollationKey key;
+    coll.getCollationKey(s, key, errorCode);
+    if(U_FAILURE(errorCode)) { return 0; }
+    int32_t keyLength;
+    const uint8_t *bytes = key.getByteArray(keyLength);
+    UBool complete = keyLength <= destCapacity;
+    int32_t length = complete ? keyLength : destCapacity;
+    uprv_memcpy(dest, bytes, length);
+    uprv_memset(dest + length, 0, destCapacity - length);
+    if(isComplete != nullptr) { *isComplete = complete; }
+    return length;
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeyPrefix(const UCollator *coll,
+                      const char16_t *source, int32_t sourceLength,
+                      uint8_t *dest, int32_t destCapacity,
+                      UBool *isComplete, UErrorCode *status) {
+    if(!checkSortKeyPrefixArgs(coll, source, sourceLength, dest, destCapacity, status)) {
+        return 0;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != nullptr) {
+        UBool complete;
+        int32_t length = rbc->getSortKeyPrefix(source, sourceLength, dest, destCapacity,
+                                               complete, *status);
+        if(isComplete != nullptr) { *isComplete = complete; }
+        return length;
+    }
+    if(source == nullptr) { source = u""; }
+    return copySortKeyPrefix(*Collator::fromUCollator(coll),
+                             UnicodeString(sourceLength < 0, ConstChar16Ptr(source), sourceLength),
+                             dest, destCapacity, isComplete, *status);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeyPrefixUTF8(const UCollator *coll,
+                          const char *source, int32_t sourceLength,
+                          uint8_t *dest, int32_t destCapacity,
+                          UBool *isComplete, UErrorCode *status) {
+    if(!checkSortKeyPrefixArgs(coll, source, sourceLength, dest, destCapacity, status)) {
+        return 0;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != nullptr) {
+        UBool complete;
+        int32_t length = rbc->getSortKeyPrefixUTF8(source, sourceLength, dest, destCapacity,
+                                                   complete, *status);
+        if(isComplete != nullptr) { *isComplete = complete; }
+        return length;
+    }
+    if(source == nullptr) { source = ""; }
+    StringPiece s = (sourceLength < 0) ? StringPiece(source) : StringPiece(source, sourceLength);
+    return copySortKeyPrefix(*Collator::fromUCollator(coll), UnicodeString::fromUTF8(s),
+                             dest, destCapacity, isComplete, *status);
+}
+
+namespace {
+
+/**
+ * The number of leading sort key bytes that ucol_sortStrings()
+ * keeps for each string.
+ */
+constexpr int32_t SORT_PREFIX_LENGTH = 16;
+
+/**
+ * Minimum number of strings per task in ucol_sortStrings(),
+ * so that small arrays are not split into too many tasks.
+ */
+constexpr int32_t MIN_STRINGS_PER_TASK = 4096;
+
+/** Maximum number of parallel tasks for ucol_sortStrings(). */
+constexpr int32_t MAX_SORT_TASKS = 64;
+
+struct SortItem {
+    /** The first SORT_PREFIX_LENGTH sort key bytes, big-endian, padded with 00 bytes. */
+    uint64_t prefix[2];
+    int32_t index;
+    /** true if the prefix contains the whole sort key */
+    UBool complete;
+};
+
+/**
+ * Orders SortItems by their sort key prefixes,
+ * and by a full collation comparison if the prefixes are equal.
+ * This is consistent with the collation order
+ * because sort key order is the same as comparison order.
+ */
+class SortItemLess {
+public:
+    SortItemLess(const UCollator *coll, const char16_t *const *strings, const int32_t *lengths,
+                 UBool stable)
+            : coll_(*Collator::fromUCollator(coll)), rbc_(RuleBasedCollator::rbcFromUCollator(coll)),
+              strings_(strings), lengths_(lengths), stable_(stable) {}
+
+    void setItem(SortItem &item, int32_t index) const {
+        item.index = index;
+        uint8_t bytes[SORT_PREFIX_LENGTH];
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UBool complete;
+        if(rbc_ != nullptr) {
+            rbc_->getSortKeyPrefix(strings_[index], getLength(index), bytes, SORT_PREFIX_LENGTH,
+                                   complete, errorCode);
+        } else {
+            UCharIterator iter;
+            uiter_setString(&iter, strings_[index], getLength(index));
+            uint32_t state[2] = { 0, 0 };
+            int32_t length = coll_.internalNextSortKeyPart(&iter, state, bytes,
+                                                           SORT_PREFIX_LENGTH, errorCode);
+            complete = length < SORT_PREFIX_LENGTH;
+        }
+        if(U_FAILURE(errorCode)) {
+            // For example, unsupported by this Collator subclass:
+            // Compare all strings fully.
+            item.prefix[0] = item.prefix[1] = 0;
+            item.complete = false;
+            return;
+        }
+        for(int32_t i = 0; i < 2; ++i) {
+            uint64_t p = 0;
+            for(int32_t j = 0; j < 8; ++j) {
+                p = (p << 8) | bytes[i * 8 + j];
+            }
+            item.prefix[i] = p;
+        }
+        item.complete = complete;
+    }
+
+    bool operator()(const SortItem &a, const SortItem &b) const {
+        if(a.prefix[0] != b.prefix[0]) { return a.prefix[0] < b.prefix[0]; }
+        if(a.prefix[1] != b.prefix[1]) { return a.prefix[1] < b.prefix[1]; }
+        if(!a.complete || !b.complete) {
+            UErrorCode errorCode = U_ZERO_ERROR;
+            UCollationResult result = coll_.compare(
+                strings_[a.index], getLength(a.index),
+                strings_[b.index], getLength(b.index), errorCode);
+            if(result != UCOL_EQUAL) { return result == UCOL_LESS; }
+        }
+        return stable_ && a.index < b.index;
+    }
+
+private:
+    int32_t getLength(int32_t index) const {
+        return lengths_ != nullptr ? lengths_[index] : -1;
+    }
+
+    const Collator &coll_;
+    const RuleBasedCollator *rbc_;
+    const char16_t *const *strings_;
+    const int32_t *lengths_;
+    UBool stable_;
+};
+
+template<typename Fn>
+void U_CALLCONV callSortTask(void *taskContext, int32_t taskIndex) {
+    (*static_cast<const Fn *>(taskContext))(taskIndex);
+}
+
+/**
+ * Calls fn(i) for 0<=i<n<=MAX_SORT_TASKS, via the caller's task runner if there is one,
+ * else on the calling thread.
+ */
+template<typename Fn>
+void runSortTasks(UCollTaskRunner *runTasks, const void *runnerContext, int32_t n, const Fn &fn) {
+    U_ASSERT(0 < n && n <= MAX_SORT_TASKS);
+    if(runTasks == nullptr || n == 1) {
+        for(int32_t i = 0; i < n; ++i) {
+            fn(i);
+        }
+    } else {
+        runTasks(runnerContext, n, callSortTask<Fn>, const_cast<Fn *>(&fn));
+    }
+}
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const char16_t *const *strings, const int32_t *lengths, int32_t count,
+                 UBool stable, int32_t numThreads,
+                 UCollTaskRunner *runTasks, const void *runnerContext,
+                 int32_t *order, UErrorCode *status) {
+    if(status == nullptr || U_FAILURE(*status)) { return; }
+    if(coll == nullptr || count < 0 || (count > 0 && (strings == nullptr || order == nullptr))) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if(count == 0) { return; }
+    // Two buffers: The sorted chunks are merged from one into the other.
+    if(static_cast<size_t>(count) > SIZE_MAX / (2 * sizeof(SortItem))) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    LocalMemory<SortItem> buffer(static_cast<SortItem *>(
+        uprv_malloc(2 * static_cast<size_t>(count) * sizeof(SortItem))));
+    if(buffer.isNull()) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    SortItem *items = buffer.getAlias();
+    SortItem *temp = items + count;
+    SortItemLess less(coll, strings, lengths, stable);
+
+    int32_t numChunks = 1;
+    if(runTasks != nullptr) {
+        numChunks = count / MIN_STRINGS_PER_TASK;
+        if(numChunks > numThreads) { numChunks = numThreads; }
+        if(numChunks > MAX_SORT_TASKS) { numChunks = MAX_SORT_TASKS; }
+        if(numChunks < 1) { numChunks = 1; }
+    }
+    int32_t bounds[MAX_SORT_TASKS + 1];
+    for(int32_t i = 0; i <= numChunks; ++i) {
+        bounds[i] = static_cast<int32_t>(static_cast<int64_t>(count) * i / numChunks);
+    }
+
+    // Compute the prefixes and sort each chunk.
+    runSortTasks(runTasks, runnerContext, numChunks, [&](int32_t chunk) {
+        int32_t start = bounds[chunk];
+        int32_t limit = bounds[chunk + 1];
+        for(int32_t i = start; i < limit; ++i) {
+            less.setItem(items[i], i);
+        }
+        // With stable=true, the comparison falls back to the input order,
+        // so std::sort() yields a stable order.
+        std::sort(items + start, items + limit, less);
+    });
+
+    // Merge pairs of adjacent chunks until one is left.
+    SortItem *src = items;
+    SortItem *dest = temp;
+    while(numChunks > 1) {
+        int32_t numPairs = numChunks / 2;
+        runSortTasks(runTasks, runnerContext, numPairs, [&](int32_t pair) {
+            int32_t start = bounds[2 * pair];
+            int32_t middle = bounds[2 * pair + 1];
+            int32_t limit = bounds[2 * pair + 2];
+            std::merge(src + start, src + middle, src + middle, src + limit, dest + start, less);
+        });
+        if((numChunks & 1) != 0) {
+            int32_t start = bounds[numChunks - 1];
+            uprv_memcpy(dest + start, src + start, static_cast<size_t>(count - start) * sizeof(SortItem));
+        }
+        numChunks = (numChunks + 1) / 2;
+        for(int32_t i = 1; i < numChunks; ++i) {
+            bounds[i] = bounds[2 * i];
+        }
+        bounds[numChunks] = count;
+        std::swap(src, dest);
+    }
+
+    for(int32_t i = 0; i < count; ++i) {
+        order[i] = src[i].index;
+    }
+}
+
 U_CAPI int32_t U_EXPORT2
 ucol_nextSortKeyPart(const UCollator *coll,
                      UCharIterator *iter,
@@ -47,6 +47,14 @@
 U_CAPI UBool U_EXPORT2
 ucol_equals(const UCollator *source, const UCollator *target);
 
+/**
+ * Maximum number of collators for locale IDs with keywords that
+ * Collator::createInstance() keeps as prototypes for cloning.
+ * When all are in use, the least recently used prototype is replaced.
+ * @internal
+ */
+#define UCOL_MAX_KEYWORD_PROTOTYPES 64
+
 /**
  * Convenience string denoting the Collation data tree
  */
@@ -65,6 +73,14 @@ class Locale;
 class UnicodeString;
 class UnifiedCache;
 
+/**
+ * Returns true if Collator::createInstance() has a prototype for the full locale ID.
+ * For testing. Implemented in coll.cpp.
+ * @param localeID full locale ID, with keywords
+ * @internal
+ */
+U_I18N_API UBool U_EXPORT2 hasCollatorKeywordPrototype(const char *localeID);
+
 /** Implemented in ucol_res.cpp. */
 class CollationLoader {
 public:
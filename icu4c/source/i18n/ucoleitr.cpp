@@ -299,6 +299,38 @@ ucol_openElements(const UCollator  *coll,
     return cei->toUCollationElements();
 }
 
+U_CAPI UCollationElements* U_EXPORT2
+ucol_openElementsUTF8(const UCollator *coll,
+                      const char *text, int32_t textLength,
+                      UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return nullptr;
+    }
+    if (coll == nullptr || (text == nullptr && textLength != 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return nullptr;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if (rbc == nullptr) {
+        *status = U_UNSUPPORTED_ERROR;  // coll is a Collator but not a RuleBasedCollator
+        return nullptr;
+    }
+
+    CollationElementIterator *cei = rbc->createCollationElementIterator(UnicodeString());
+    if (cei == nullptr) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    ucol_setTextUTF8(cei->toUCollationElements(), text, textLength, status);
+    if (U_FAILURE(*status)) {
+        delete cei;
+        return nullptr;
+    }
+
+    return cei->toUCollationElements();
+}
+
 
 U_CAPI void U_EXPORT2
 ucol_closeElements(UCollationElements *elems)
@@ -492,6 +524,23 @@ ucol_setText(      UCollationElements *elems,
     return CollationElementIterator::fromUCollationElements(elems)->setText(s, *status);
 }
 
+U_CAPI void U_EXPORT2
+ucol_setTextUTF8(UCollationElements *elems,
+                 const char *text, int32_t textLength,
+                 UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return;
+    }
+
+    if ((text == nullptr && textLength != 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    StringPiece s = (textLength < 0) ? StringPiece(text) : StringPiece(text, textLength);
+    CollationElementIterator::fromUCollationElements(elems)->setTextUTF8(s, *status);
+}
+
 U_CAPI int32_t U_EXPORT2
 ucol_getOffset(const UCollationElements *elems)
 {
@@ -170,6 +170,21 @@ ucsdet_enableInputFilter(UCharsetDetector *ucsd, UBool filter)
     return prev;
 }
 
+U_CAPI void U_EXPORT2
+ucsdet_setScanLimit(UCharsetDetector *ucsd, int32_t limit, UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return;
+    }
+
+    if (limit < 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    ((CharsetDetector *) ucsd)->setScanLimit(limit);
+}
+
 U_CAPI  int32_t U_EXPORT2
 ucsdet_getUChars(const UCharsetMatch *ucsm,
                  char16_t *buf, int32_t cap, UErrorCode *status)
@@ -276,6 +276,29 @@ class U_I18N_API AlphabeticIndex: public UObject {
          */
         int32_t getBucketIndex(const UnicodeString &name, UErrorCode &errorCode) const;
 
+#ifndef U_HIDE_DRAFT_API
+        /**
+         * Finds the index buckets for an array of names.
+         * The result is the same as calling getBucketIndex() for each name,
+         * but this is faster for large numbers of names:
+         * When the bucket is determined by the first code point of a name,
+         * then that is looked up without string comparisons.
+         *
+         * Like getBucketIndex(), this can be called on multiple threads at once,
+         * for example with each thread processing a part of a large array.
+         *
+         * @param names array of count strings to be sorted into index buckets
+         * @param count number of names
+         * @param bucketIndexes array of count bucket numbers;
+         *        receives the bucket number for each name
+         * @param errorCode Error code, will be set with the reason if the
+         *                  operation fails.
+         * @draft ICU 76
+         */
+        void getBucketIndexes(const UnicodeString *names, int32_t count,
+                              int32_t *bucketIndexes, UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
         /**
          * Returns the index-th bucket. Returns nullptr if the index is out of range.
          *
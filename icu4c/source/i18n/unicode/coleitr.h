@@ -39,6 +39,7 @@
 
 #if !UCONFIG_NO_COLLATION
 
+#include "unicode/stringpiece.h"
 #include "unicode/unistr.h"
 #include "unicode/uobject.h"
 
@@ -250,6 +251,23 @@ class U_I18N_API CollationElementIterator final : public UObject {
     */
     void setText(CharacterIterator& str, UErrorCode& status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+    * Sets the source string to UTF-8 text.
+    * The collation elements are computed directly from the UTF-8 bytes,
+    * without converting them to UTF-16.
+    * getOffset() and setOffset() then use byte offsets into the UTF-8 string.
+    *
+    * Unlike setText(), this does not copy the text: The caller must not modify or
+    * delete the text while this iterator (or a copy of it) is used with this text.
+    * Ill-formed UTF-8 sequences are treated like U+FFFD.
+    * @param str the UTF-8 source string.
+    * @param status the error code status.
+    * @draft ICU 76
+    */
+    void setTextUTF8(StringPiece str, UErrorCode& status);
+#endif  // U_HIDE_DRAFT_API
+
     /**
     * Checks if a comparison order is ignorable.
     * @param order the collation order.
@@ -360,6 +378,14 @@ class U_I18N_API CollationElementIterator final : public UObject {
 
     static int32_t getMaxExpansion(const UHashtable *maxExpansions, int32_t order);
 
+    /** @return the length of the UTF-16 or UTF-8 text */
+    inline int32_t getTextLength() const {
+        return utf8_ != nullptr ? utf8Length_ : string_.length();
+    }
+
+    /** Finds the last safe offset for setOffset() in UTF-8 text. */
+    int32_t backUpUTF8(int32_t offset) const;
+
     // CollationElementIterator private data members ----------------------------
 
     CollationIterator *iter_;  // owned
@@ -378,6 +404,9 @@ class U_I18N_API CollationElementIterator final : public UObject {
     UVector32 *offsets_;
 
     UnicodeString string_;
+    /** UTF-8 text from setTextUTF8(), aliased; nullptr when the text is in string_. */
+    const char *utf8_;
+    int32_t utf8Length_;
 };
 
 // CollationElementIterator inline method definitions --------------------------
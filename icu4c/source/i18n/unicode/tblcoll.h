@@ -655,6 +655,133 @@ class U_I18N_API RuleBasedCollator final : public Collator {
     virtual int32_t getSortKey(const char16_t *source, int32_t sourceLength,
                                uint8_t *result, int32_t resultLength) const override;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Same as getSortKey() but for a UTF-8 string,
+     * without converting it to UTF-16 first.
+     * Ill-formed UTF-8 sequences are treated like U+FFFD.
+     * @param source UTF-8 string
+     * @param sourceLength length of the string in bytes, or -1 if NUL-terminated
+     * @param result buffer to receive the sort key;
+     *        can be nullptr if resultLength is 0 (for preflighting)
+     * @param resultLength capacity of result in bytes
+     * @return the length of the sort key, including its terminating zero byte;
+     *         0 if an error occurred
+     * @draft ICU 76
+     */
+    int32_t getSortKeyUTF8(const char *source, int32_t sourceLength,
+                           uint8_t *result, int32_t resultLength) const;
+
+    /**
+     * Writes the sort keys for an array of strings one after the other into one buffer.
+     * The result is the same as calling getSortKey() for each string and
+     * concatenating the sort keys, but faster for many strings because the
+     * collation iterator and the per-level buffers are reused.
+     *
+     * Each sort key includes its terminating zero byte.
+     * If offsets is not nullptr, then offsets[i] is set to the index in dest
+     * where the i-th sort key starts, and offsets[count] is set to the total length.
+     * The offsets are set even if dest is too small, so that a caller can
+     * preflight with destCapacity=0, allocate the exact size, and then fill it.
+     *
+     * @param sources array of count strings
+     * @param sourceLengths array of count string lengths, where -1 means NUL-terminated;
+     *        can be nullptr if all strings are NUL-terminated
+     * @param count number of strings
+     * @param dest buffer to receive the sort keys;
+     *        can be nullptr if destCapacity is 0 (for preflighting)
+     * @param destCapacity capacity of dest in bytes
+     * @param offsets array of count+1 offsets into dest, or nullptr
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Set to U_BUFFER_OVERFLOW_ERROR if the sort keys
+     *                  do not fit into dest.
+     * @return the total length of all of the sort keys
+     * @draft ICU 76
+     */
+    int32_t getSortKeys(const char16_t *const *sources, const int32_t *sourceLengths,
+                        int32_t count, uint8_t *dest, int32_t destCapacity,
+                        int32_t *offsets, UErrorCode &errorCode) const;
+
+    /**
+     * Same as getSortKeys() but for UTF-8 strings.
+     * Ill-formed UTF-8 sequences are treated like U+FFFD.
+     *
+     * @param sources array of count UTF-8 strings
+     * @param sourceLengths array of count string lengths in bytes, where -1 means NUL-terminated;
+     *        can be nullptr if all strings are NUL-terminated
+     * @param count number of strings
+     * @param dest buffer to receive the sort keys;
+     *        can be nullptr if destCapacity is 0 (for preflighting)
+     * @param destCapacity capacity of dest in bytes
+     * @param offsets array of count+1 offsets into dest, or nullptr
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Set to U_BUFFER_OVERFLOW_ERROR if the sort keys
+     *                  do not fit into dest.
+     * @return the total length of all of the sort keys
+     * @draft ICU 76
+     */
+    int32_t getSortKeysUTF8(const char *const *sources, const int32_t *sourceLengths,
+                            int32_t count, uint8_t *dest, int32_t destCapacity,
+                            int32_t *offsets, UErrorCode &errorCode) const;
+
+    /**
+     * Writes a fixed-length prefix of the sort key for a string,
+     * for example for a database index with bounded key sizes.
+     *
+     * dest receives the first destCapacity bytes of the sort key that getSortKey()
+     * would return, including its terminating zero byte if that fits.
+     * The rest of dest is filled with zero bytes.
+     * Two prefixes of the same length compare like the full sort keys as far as they go:
+     * If memcmp() of the prefixes is not 0, then the strings compare the same way.
+     * If the prefixes are equal and at least one of them is complete,
+     * then the strings compare equal.
+     * Only if the prefixes are equal and both are incomplete
+     * must the strings be compared fully, for example with compare().
+     *
+     * This stops processing the string as soon as dest is full,
+     * and it is faster than ucol_nextSortKeyPart().
+     *
+     * @param source string
+     * @param sourceLength length of the string, or -1 if NUL-terminated
+     * @param dest buffer to receive the sort key prefix
+     * @param destCapacity length of the prefix in bytes, must be positive
+     * @param isComplete set to true if dest contains the whole sort key,
+     *        false if the sort key was truncated
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately.
+     * @return the number of sort key bytes in dest, not counting the zero padding;
+     *         destCapacity if the sort key was truncated
+     * @draft ICU 76
+     */
+    int32_t getSortKeyPrefix(const char16_t *source, int32_t sourceLength,
+                             uint8_t *dest, int32_t destCapacity,
+                             UBool &isComplete, UErrorCode &errorCode) const;
+
+    /**
+     * Same as getSortKeyPrefix() but for a UTF-8 string.
+     * Ill-formed UTF-8 sequences are treated like U+FFFD.
+     *
+     * @param source UTF-8 string
+     * @param sourceLength length of the string in bytes, or -1 if NUL-terminated
+     * @param dest buffer to receive the sort key prefix
+     * @param destCapacity length of the prefix in bytes, must be positive
+     * @param isComplete set to true if dest contains the whole sort key,
+     *        false if the sort key was truncated
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately.
+     * @return the number of sort key bytes in dest, not counting the zero padding;
+     *         destCapacity if the sort key was truncated
+     * @draft ICU 76
+     */
+    int32_t getSortKeyPrefixUTF8(const char *source, int32_t sourceLength,
+                                 uint8_t *dest, int32_t destCapacity,
+                                 UBool &isComplete, UErrorCode &errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Retrieves the reordering codes for this collator.
      * @param dest The array to fill with the script ordering.
@@ -782,6 +909,18 @@ class U_I18N_API RuleBasedCollator final : public Collator {
             UParseError *outParseError, UnicodeString *outReason,
             UErrorCode &errorCode);
 
+    /**
+     * Implements ucol_openRulesCached().
+     * @internal
+     */
+    void internalBuildTailoringCached(
+            const UnicodeString &rules,
+            int32_t strength,
+            UColAttributeValue decompositionMode,
+            const char *cacheDir,
+            UParseError *outParseError,
+            UErrorCode &errorCode);
+
     /** @internal */
     static inline RuleBasedCollator *rbcFromUCollator(UCollator *uc) {
         return dynamic_cast<RuleBasedCollator *>(fromUCollator(uc));
@@ -796,6 +935,15 @@ class U_I18N_API RuleBasedCollator final : public Collator {
      * @internal for tests & tools
      */
     void internalGetCEs(const UnicodeString &str, UVector64 &ces, UErrorCode &errorCode) const;
+
+    /**
+     * Returns true if the collation elements for c might depend on the
+     * surrounding text: c starts a contraction, has a prefix mapping,
+     * is a digit with numeric collation,
+     * or is a Hangul syllable while some conjoining Jamo are special.
+     * @internal for string search and AlphabeticIndex
+     */
+    UBool internalHasContext(UChar32 c) const;
 #endif  // U_HIDE_INTERNAL_API
 
 protected:
@@ -837,8 +985,14 @@ class U_I18N_API RuleBasedCollator final : public Collator {
     void writeSortKey(const char16_t *s, int32_t length,
                       SortKeyByteSink &sink, UErrorCode &errorCode) const;
 
+    void writeSortKeyUTF8(const char *s, int32_t length,
+                          SortKeyByteSink &sink, UErrorCode &errorCode) const;
+
     void writeIdenticalLevel(const char16_t *s, const char16_t *limit,
                              SortKeyByteSink &sink, UErrorCode &errorCode) const;
+    /** Converts the UTF-8 string to UTF-16 in utf16, then writes its identical level. */
+    void writeIdenticalLevelUTF8(const char *s, int32_t length, UnicodeString &utf16,
+                                 SortKeyByteSink &sink, UErrorCode &errorCode) const;
 
     const CollationSettings &getDefaultSettings() const;
 
@@ -447,6 +447,50 @@ ucol_openRules( const UChar        *rules,
                 UParseError        *parseError,
                 UErrorCode         *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Same as ucol_openRules(), but caches the built tailoring in a file.
+ *
+ * Building a collator from a large rule string can take a long time.
+ * The first call for a rule string builds the collator and writes
+ * its binary form (see ucol_cloneBinary()) together with the rules into
+ * a file in cacheDir, named after a hash of the rules.
+ * Later calls, also in other processes, memory-map that file and use its data
+ * without copying it, as long as the rules match exactly.
+ * A cache file written by a different ICU version, or for different root
+ * collation data, is ignored and replaced.
+ *
+ * Failure to read or write the cache file is not an error;
+ * the collator is then built from the rules as by ucol_openRules().
+ * The cache directory must exist, and it must be writable only by
+ * trusted processes: The files are checked for accidental damage,
+ * but their data is otherwise trusted like ICU's own collation data.
+ *
+ * @param rules A string describing the collation rules.
+ * @param rulesLength The length of rules, or -1 if NUL-terminated.
+ * @param normalizationMode The normalization mode: One of
+ *             UCOL_OFF, UCOL_ON, or
+ *             UCOL_DEFAULT (set the mode according to the rules)
+ * @param strength The default collation strength, or UCOL_DEFAULT_STRENGTH.
+ * @param cacheDir The directory for the cache files.
+ *             If NULL or empty, then this function behaves like ucol_openRules().
+ * @param parseError A pointer to UParseError to receive information about errors
+ *                   occurred during parsing. Can be NULL.
+ * @param status A pointer to a UErrorCode to receive any errors
+ * @return A pointer to a UCollator, or NULL if an error occurred.
+ * @see ucol_openRules
+ * @see ucol_cloneBinary
+ * @draft ICU 76
+ */
+U_CAPI UCollator* U_EXPORT2
+ucol_openRulesCached(const UChar *rules, int32_t rulesLength,
+                     UColAttributeValue normalizationMode,
+                     UCollationStrength strength,
+                     const char *cacheDir,
+                     UParseError *parseError,
+                     UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_DEPRECATED_API
 /** 
  * Open a collator defined by a short form string.
@@ -1033,6 +1077,220 @@ ucol_getSortKey(const    UCollator    *coll,
         uint8_t        *result,
         int32_t        resultLength);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Same as ucol_getSortKey() but for a UTF-8 string.
+ * For a RuleBasedCollator, the sort key is computed directly from the UTF-8 text
+ * without converting it to UTF-16 first.
+ * Ill-formed UTF-8 sequences are treated like U+FFFD.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param source The UTF-8 string to transform.
+ * @param sourceLength The length of source in bytes, or -1 if NUL-terminated.
+ * @param result A pointer to a buffer to receive the sort key;
+ *        can be NULL if resultLength is 0 (for preflighting).
+ * @param resultLength The maximum size of result.
+ * @return The size needed to fully store the sort key.
+ *      If there was an internal error generating the sort key,
+ *      a zero value is returned.
+ * @see ucol_getSortKey
+ * @draft ICU 76
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeyUTF8(const UCollator *coll,
+                    const char *source, int32_t sourceLength,
+                    uint8_t *result, int32_t resultLength);
+
+/**
+ * Get the sort keys for an array of strings from a UCollator,
+ * written one after the other into one buffer.
+ * The result is the same as calling ucol_getSortKey() for each string and
+ * concatenating the sort keys, but faster for many strings.
+ *
+ * Each sort key includes its terminating zero byte.
+ * If offsets is not NULL, then offsets[i] is set to the index in dest
+ * where the i-th sort key starts, and offsets[count] is set to the total length.
+ * The offsets are set even if dest is too small, so that a caller can
+ * preflight with destCapacity=0, allocate the exact size, and then fill it.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources Array of count strings.
+ * @param sourceLengths Array of count string lengths, where -1 means NUL-terminated;
+ *        can be NULL if all strings are NUL-terminated.
+ * @param count The number of strings.
+ * @param dest A buffer to receive the sort keys;
+ *        can be NULL if destCapacity is 0 (for preflighting).
+ * @param destCapacity The capacity of dest in bytes.
+ * @param offsets Array of count+1 offsets into dest, or NULL.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ *        Set to U_BUFFER_OVERFLOW_ERROR if the sort keys do not fit into dest.
+ * @return The total length of all of the sort keys.
+ * @see ucol_getSortKey
+ * @draft ICU 76
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const *sources, const int32_t *sourceLengths, int32_t count,
+                 uint8_t *dest, int32_t destCapacity,
+                 int32_t *offsets, UErrorCode *status);
+
+/**
+ * Same as ucol_getSortKeys() but for UTF-8 strings.
+ * Ill-formed UTF-8 sequences are treated like U+FFFD.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources Array of count UTF-8 strings.
+ * @param sourceLengths Array of count string lengths in bytes, where -1 means NUL-terminated;
+ *        can be NULL if all strings are NUL-terminated.
+ * @param count The number of strings.
+ * @param dest A buffer to receive the sort keys;
+ *        can be NULL if destCapacity is 0 (for preflighting).
+ * @param destCapacity The capacity of dest in bytes.
+ * @param offsets Array of count+1 offsets into dest, or NULL.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ *        Set to U_BUFFER_OVERFLOW_ERROR if the sort keys do not fit into dest.
+ * @return The total length of all of the sort keys.
+ * @see ucol_getSortKeys
+ * @draft ICU 76
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeysUTF8(const UCollator *coll,
+                     const char *const *sources, const int32_t *sourceLengths, int32_t count,
+                     uint8_t *dest, int32_t destCapacity,
+                     int32_t *offsets, UErrorCode *status);
+
+/**
+ * Writes a fixed-length prefix of the sort key for a string,
+ * for example for a database index with bounded key sizes.
+ *
+ * dest receives the first destCapacity bytes of the sort key that ucol_getSortKey()
+ * would return, including its terminating zero byte if that fits.
+ * The rest of dest is filled with zero bytes.
+ * Two prefixes of the same length compare like the full sort keys as far as they go:
+ * If memcmp() of the prefixes is not 0, then the strings compare the same way.
+ * If the prefixes are equal and at least one of them is complete,
+ * then the strings compare equal.
+ * Only if the prefixes are equal and both are incomplete
+ * must the strings be compared fully, for example with ucol_strcoll().
+ *
+ * This stops processing the string as soon as dest is full,
+ * and it is faster than ucol_nextSortKeyPart().
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param source The string.
+ * @param sourceLength The length of the string, or -1 if NUL-terminated.
+ * @param dest A buffer to receive the sort key prefix.
+ * @param destCapacity The length of the prefix in bytes; must be positive.
+ * @param isComplete Set to true if dest contains the whole sort key,
+ *        false if the sort key was truncated. Can be NULL.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The number of sort key bytes in dest, not counting the zero padding;
+ *         destCapacity if the sort key was truncated.
+ * @see ucol_getSortKey
+ * @draft ICU 76
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeyPrefix(const UCollator *coll,
+                      const UChar *source, int32_t sourceLength,
+                      uint8_t *dest, int32_t destCapacity,
+                      UBool *isComplete, UErrorCode *status);
+
+/**
+ * Same as ucol_getSortKeyPrefix() but for a UTF-8 string.
+ * Ill-formed UTF-8 sequences are treated like U+FFFD.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param source The UTF-8 string.
+ * @param sourceLength The length of the string in bytes, or -1 if NUL-terminated.
+ * @param dest A buffer to receive the sort key prefix.
+ * @param destCapacity The length of the prefix in bytes; must be positive.
+ * @param isComplete Set to true if dest contains the whole sort key,
+ *        false if the sort key was truncated. Can be NULL.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return The number of sort key bytes in dest, not counting the zero padding;
+ *         destCapacity if the sort key was truncated.
+ * @see ucol_getSortKeyPrefix
+ * @draft ICU 76
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeyPrefixUTF8(const UCollator *coll,
+                          const char *source, int32_t sourceLength,
+                          uint8_t *dest, int32_t destCapacity,
+                          UBool *isComplete, UErrorCode *status);
+
+/**
+ * Function type for one part of the work of ucol_sortStrings(),
+ * passed to a UCollTaskRunner.
+ *
+ * @param taskContext The taskContext that was passed to the UCollTaskRunner.
+ * @param taskIndex The index of this task, 0<=taskIndex<numTasks.
+ * @see UCollTaskRunner
+ * @draft ICU 76
+ */
+typedef void U_CALLCONV UCollTask(void *taskContext, int32_t taskIndex);
+
+/**
+ * Function type for a caller-supplied runner of parallel tasks,
+ * for example one that hands the tasks to an application's thread pool.
+ *
+ * It must call task(taskContext, i) exactly once for each 0<=i<numTasks,
+ * in any order and on any threads, and return only after all of those calls
+ * have returned. The tasks are independent of each other and do not throw.
+ * If it cannot use other threads, then it must call the tasks on the calling thread.
+ *
+ * @param context The runnerContext that was passed to ucol_sortStrings().
+ * @param numTasks The number of tasks.
+ * @param task The function to be called for each task.
+ * @param taskContext The first argument for each task call.
+ * @see ucol_sortStrings
+ * @draft ICU 76
+ */
+typedef void U_CALLCONV UCollTaskRunner(const void *context, int32_t numTasks,
+                                        UCollTask *task, void *taskContext);
+
+/**
+ * Sorts an array of strings according to a UCollator.
+ * The strings themselves are not modified; instead, order[] receives
+ * the indexes of the strings in sorted order.
+ *
+ * This is much faster than sorting with ucol_strcoll() for large arrays:
+ * A short sort key prefix is computed once per string, and most comparisons
+ * are resolved on those prefixes. Full string comparisons are only done
+ * for strings whose prefixes are equal.
+ *
+ * The work is done on the calling thread unless the caller supplies a runTasks function
+ * and numThreads>1. Then runTasks is called with up to numThreads tasks at a time,
+ * which compute the prefixes and sort parts of the array, and then merge the sorted parts.
+ * Small arrays are split into fewer tasks.
+ * ICU itself does not create threads.
+ * The collator must be safe for concurrent use by multiple threads,
+ * which is true for all collators created by ICU.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param strings Array of count strings.
+ * @param lengths Array of count string lengths, where -1 means NUL-terminated;
+ *        can be NULL if all strings are NUL-terminated.
+ * @param count The number of strings.
+ * @param stable If true, then strings that compare equal keep their input order.
+ *        Otherwise their relative order is unspecified.
+ * @param numThreads The maximum number of tasks to pass to runTasks at a time,
+ *        usually the number of threads that it runs them on.
+ *        Values less than 1 are treated as 1.
+ * @param runTasks The function that runs parallel tasks, or NULL to sort on the calling thread.
+ * @param runnerContext The context pointer that is passed to runTasks.
+ * @param order Array of count indexes to receive the sorted order.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @see ucol_strcoll
+ * @draft ICU 76
+ */
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar *const *strings, const int32_t *lengths, int32_t count,
+                 UBool stable, int32_t numThreads,
+                 UCollTaskRunner *runTasks, const void *runnerContext,
+                 int32_t *order, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /** Gets the next count bytes of a sort key. Caller needs
  *  to preserve state array between calls and to provide
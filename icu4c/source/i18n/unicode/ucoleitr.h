@@ -119,6 +119,32 @@ ucol_openElements(const UCollator  *coll,
                         int32_t    textLength,
                         UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Open the collation elements for a UTF-8 string.
+ * The collation elements are computed directly from the UTF-8 bytes,
+ * without converting them to UTF-16.
+ * Offsets (ucol_getOffset(), ucol_setOffset()) are byte offsets into the text.
+ * Ill-formed UTF-8 sequences are treated like U+FFFD.
+ *
+ * The UCollationElements retains a pointer to the supplied text.
+ * The caller must not modify or delete the text while the UCollationElements
+ * object is used to iterate over this text.
+ *
+ * @param coll The collator containing the desired collation rules.
+ * @param text The UTF-8 text to iterate over.
+ * @param textLength The number of bytes in text, or -1 if NUL-terminated
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @return a struct containing collation element information
+ * @see ucol_openElements
+ * @draft ICU 76
+ */
+U_CAPI UCollationElements* U_EXPORT2
+ucol_openElementsUTF8(const UCollator *coll,
+                      const char *text, int32_t textLength,
+                      UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * get a hash code for a key... Not very useful!
  * @param key    the given key.
@@ -215,6 +241,30 @@ ucol_setText(      UCollationElements *elems,
                    int32_t            textLength,
                    UErrorCode         *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Set UTF-8 text containing the collation elements.
+ * Same as ucol_setText() but the collation elements are computed directly
+ * from the UTF-8 bytes, and offsets are byte offsets into the text.
+ * Ill-formed UTF-8 sequences are treated like U+FFFD.
+ *
+ * The UCollationElements retains a pointer to the supplied text.
+ * The caller must not modify or delete the text while the UCollationElements
+ * object is used to iterate over this text.
+ *
+ * @param elems The UCollationElements to set.
+ * @param text The UTF-8 source text containing the collation elements.
+ * @param textLength The length of text in bytes, or -1 if NUL-terminated.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @see ucol_setText
+ * @draft ICU 76
+ */
+U_CAPI void U_EXPORT2
+ucol_setTextUTF8(UCollationElements *elems,
+                 const char *text, int32_t textLength,
+                 UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Get the offset of the current source character.
  * This is an offset into the text of the character containing the current
@@ -382,6 +382,29 @@ ucsdet_isInputFilterEnabled(const UCharsetDetector *ucsd);
 U_CAPI  UBool U_EXPORT2
 ucsdet_enableInputFilter(UCharsetDetector *ucsd, UBool filter);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Limit the number of input bytes that the charset detector examines.
+ * With a limit, detection only looks at the first <code>limit</code> bytes
+ * of the text set with ucsdet_setText(), which bounds the time taken
+ * for each detection regardless of the input size.
+ * The whole text remains available through ucsdet_getUChars().
+ *
+ * By default there is no limit: the Unicode and multi-byte charset
+ * detectors examine all of the input, while the markup filter and the
+ * single byte charset detectors look at no more than the first 8kB.
+ *
+ * @param ucsd   the charset detector to be modified.
+ * @param limit  the maximum number of bytes to examine, or 0 for no limit.
+ * @param status any error conditions are reported back in this variable.
+ *               A negative limit sets U_ILLEGAL_ARGUMENT_ERROR.
+ *
+ * @draft ICU 76
+ */
+U_CAPI void U_EXPORT2
+ucsdet_setScanLimit(UCharsetDetector *ucsd, int32_t limit, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
 /**
   *  Get an iterator over the set of detectable charsets -
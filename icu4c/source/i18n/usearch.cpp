@@ -13,6 +13,7 @@
 
 #if !UCONFIG_NO_COLLATION && !UCONFIG_NO_BREAK_ITERATION
 
+#include "unicode/tblcoll.h"
 #include "unicode/usearch.h"
 #include "unicode/ustring.h"
 #include "unicode/uchar.h"
@@ -319,6 +320,80 @@ inline void initializePatternCETable(UStringSearch *strsrch, UErrorCode *status)
     pattern->cesLength = offset;
 }
 
+/**
+* Hashes a processed CE to an index into the pattern's shift table.
+*/
+static
+inline int32_t hashPCE(int64_t pce)
+{
+    uint64_t h = static_cast<uint64_t>(pce);
+    h ^= h >> 32;
+    h ^= h >> 16;
+    h ^= h >> 8;
+    return static_cast<int32_t>(h & (PCE_SHIFT_TABLE_SIZE_ - 1));
+}
+
+/**
+* Initializes the tables which let usearch_search() skip text that cannot
+* start a match when comparing CEs exactly:
+* Boyer-Moore-Horspool shifts over the pattern pces, and the set of ASCII
+* characters that might start a match.
+* Pces that hash alike share the smaller shift, which is always safe.
+* An ASCII character cannot start a match if it has no context-dependent
+* mappings, is not shifted, and yields a single pce other than the first
+* pattern pce, or none at all.
+* Internal method, status assumed to be a success.
+* @param strsrch string search data, with the pattern pces set
+* @param status output error if any
+*/
+static
+inline void initializePatternSkipTables(UStringSearch *strsrch,
+                                        UErrorCode    *status)
+{
+    UPattern *pattern = &(strsrch->pattern);
+    int32_t   length  = pattern->pcesLength;
+    int32_t   maxShift = length < UINT8_MAX ? length : UINT8_MAX;
+    uprv_memset(pattern->pcesShift, maxShift, PCE_SHIFT_TABLE_SIZE_);
+    for (int32_t i = 0; i < length - 1; ++i) {
+        int32_t shift = length - 1 - i;
+        uint8_t *entry = pattern->pcesShift + hashPCE(pattern->pces[i]);
+        if (shift < *entry) {
+            *entry = static_cast<uint8_t>(shift);
+        }
+    }
+
+    pattern->hasAsciiStarts = false;
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(strsrch->collator);
+    if (rbc == nullptr || length == 0 || U_FAILURE(*status)) {
+        return;
+    }
+    UCollationElements *coleiter = strsrch->utilIter;
+    uprv_memset(pattern->asciiStarts, 0, sizeof(pattern->asciiStarts));
+    for (char16_t c = 0; c < 0x80; ++c) {
+        UBool isStart = rbc->internalHasContext(c);
+        if (!isStart && strsrch->toShift) {
+            // The pces after a shifted character depend on it,
+            // so the CE iteration must not restart after one.
+            ucol_setText(coleiter, &c, 1, status);
+            uint32_t ce = static_cast<uint32_t>(ucol_next(coleiter, status));
+            isStart = ce != static_cast<uint32_t>(UCOL_NULLORDER) &&
+                ucol_primaryOrder(ce) != 0 && strsrch->variableTop > ce;
+        }
+        if (!isStart) {
+            ucol_setText(coleiter, &c, 1, status);
+            icu::UCollationPCE iter(coleiter);
+            int64_t pce = iter.nextProcessed(nullptr, nullptr, status);
+            isStart = pce != UCOL_PROCESSED_NULLORDER &&
+                (pce == pattern->pces[0] ||
+                    iter.nextProcessed(nullptr, nullptr, status) != UCOL_PROCESSED_NULLORDER);
+        }
+        if (isStart) {
+            pattern->asciiStarts[c >> 5] |= static_cast<uint32_t>(1) << (c & 0x1f);
+        }
+    }
+    pattern->hasAsciiStarts = U_SUCCESS(*status);
+}
+
 /**
 * Initializing the pce table for a pattern.
 * Stores non-ignorable collation keys.
@@ -389,6 +464,8 @@ inline void initializePatternPCETable(UStringSearch *strsrch,
     pcetable[offset]   = 0;
     pattern->pces       = pcetable;
     pattern->pcesLength = offset;
+
+    initializePatternSkipTables(strsrch, status);
 }
 
 /**
@@ -1403,6 +1480,8 @@ struct CEIBuffer {
                ~CEIBuffer();
    const CEI   *get(int32_t index);
    const CEI   *getPrevious(int32_t index);
+   const CEI   *getAhead(int32_t index);
+   void         restart();
 };
 
 
@@ -1492,6 +1571,26 @@ const CEI *CEIBuffer::get(int32_t index) {
     return &buf[i];
 }
 
+// Get the CE with the specified index, fetching any CEs before it that
+//   have not been fetched yet.
+//   Index must be greater than n-history_size, where n is the largest index
+//   fetched so far; it may be many CEs ahead of n.
+//
+const CEI *CEIBuffer::getAhead(int32_t index) {
+    while (limitIx < index) {
+        get(limitIx);
+    }
+    return get(index);
+}
+
+// Forget all CEs, after the iterator was moved to a new text offset.
+//   The next CE fetched gets index 0.
+//
+void CEIBuffer::restart() {
+    firstIx = 0;
+    limitIx = 0;
+}
+
 // Get the CE with the specified index.
 //   Index must be in the range
 //          n-history_size < index < n+1
@@ -1762,6 +1861,27 @@ UChar32 codePointBefore(const USearch &search, int32_t index) {
     return U_SENTINEL;
 }
 
+/**
+ * Returns the first text index at or after index where a match might start,
+ * according to the pattern's set of ASCII start characters.
+ * Does not skip an ASCII character that is followed by a non-ASCII one,
+ * which might combine with it.
+ */
+int32_t skipAsciiNonStarts(const UStringSearch &strsrch, int32_t index) {
+    const char16_t *text = strsrch.search->text;
+    int32_t length = strsrch.search->textLength;
+    const uint32_t *starts = strsrch.pattern.asciiStarts;
+    while (index < length) {
+        char16_t c = text[index];
+        if (c >= 0x80 || (starts[c >> 5] & (static_cast<uint32_t>(1) << (c & 0x1f))) != 0 ||
+                (index + 1 < length && text[index + 1] >= 0x80)) {
+            break;
+        }
+        ++index;
+    }
+    return index;
+}
+
 }  // namespace
 
 U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
@@ -1820,7 +1940,17 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
     int32_t  minLimit;
     int32_t  maxLimit;
 
-
+    // With exact CE comparison, skip alignments that cannot match:
+    // Restart the CE iteration after ASCII text that cannot start a match,
+    // and shift the pattern by the Boyer-Moore-Horspool table
+    // while its last CE does not match.
+    const int32_t  pcesLength = strsrch->pattern.pcesLength;
+    const int64_t  firstPCE = pcesLength > 0 ? strsrch->pattern.pces[0] : 0;
+    const int64_t  lastPCE = pcesLength > 0 ? strsrch->pattern.pces[pcesLength - 1] : 0;
+    const UBool    useAsciiStarts = strsrch->search->elementComparisonType == 0 &&
+                                    strsrch->pattern.hasAsciiStarts;
+    const UBool    useShifts = strsrch->search->elementComparisonType == 0 && pcesLength > 1;
+    int32_t        restartIdx = startIdx;
 
     // Outer loop moves over match starting positions in the
     //      target CE space.
@@ -1838,6 +1968,38 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
     //
     for(targetIx=0; ; targetIx++)
     {
+        while (useAsciiStarts || useShifts) {
+            const CEI *cei = ceb.getAhead(targetIx);
+            if (cei == nullptr || cei->ce == UCOL_PROCESSED_NULLORDER) {
+                break;
+            }
+            if (useAsciiStarts && cei->ce != firstPCE) {
+                int32_t index = skipAsciiNonStarts(*strsrch, cei->lowIndex);
+                // setOffset() might back up; do not restart at the same index again.
+                if (index > cei->lowIndex && index > restartIdx) {
+                    restartIdx = index;
+                    ucol_setOffset(strsrch->textIter, index, status);
+                    if (!initTextProcessedIter(strsrch, status)) {
+                        break;
+                    }
+                    ceb.restart();
+                    targetIx = 0;
+                    continue;
+                }
+            }
+            if (!useShifts) {
+                break;
+            }
+            cei = ceb.getAhead(targetIx + pcesLength - 1);
+            if (cei == nullptr || cei->ce == lastPCE || cei->ce == UCOL_PROCESSED_NULLORDER) {
+                break;
+            }
+            targetIx += strsrch->pattern.pcesShift[hashPCE(cei->ce)];
+        }
+        if (U_FAILURE(*status)) {
+            break;
+        }
+
         found = true;
         //  Inner loop checks for a match beginning at each
         //  position from the outer loop.
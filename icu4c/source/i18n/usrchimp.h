@@ -127,6 +127,7 @@ class UCollationPCE : public UMemory {
 U_NAMESPACE_END
 
 #define INITIAL_ARRAY_SIZE_       256
+#define PCE_SHIFT_TABLE_SIZE_     256
 
 struct USearch {
     // required since collation element iterator does not have a getText API
@@ -157,6 +158,13 @@ struct UPattern {
           int32_t             pcesLength;
           int64_t            *pces;
           int64_t             pcesBuffer[INITIAL_ARRAY_SIZE_];
+          // Boyer-Moore-Horspool shifts for the pces, indexed by a hash
+          // of the text pce aligned with the last pattern pce
+          uint8_t             pcesShift[PCE_SHIFT_TABLE_SIZE_];
+          // bit set of the ASCII characters that might start a match,
+          // valid if hasAsciiStarts; both are set with the pces
+          uint32_t            asciiStarts[4];
+          UBool               hasAsciiStarts;
           UBool               hasPrefixAccents;
           UBool               hasSuffixAccents;
 };
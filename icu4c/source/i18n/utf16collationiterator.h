@@ -95,6 +95,14 @@ class U_I18N_API FCDUTF16CollationIterator : public UTF16CollationIterator {
 
     virtual ~FCDUTF16CollationIterator();
 
+    void setText(const char16_t *s, const char16_t *lim) {
+        UTF16CollationIterator::setText(s, lim);
+        rawStart = segmentStart = s;
+        segmentLimit = nullptr;
+        rawLimit = lim;
+        checkDir = 1;
+    }
+
     virtual bool operator==(const CollationIterator &other) const override;
 
     virtual void resetToOffset(int32_t newOffset) override;
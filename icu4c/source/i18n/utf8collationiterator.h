@@ -38,8 +38,21 @@ class U_I18N_API UTF8CollationIterator : public CollationIterator {
             : CollationIterator(d, numeric),
               u8(s), pos(p), length(len) {}
 
+    UTF8CollationIterator(const UTF8CollationIterator &other, const uint8_t *newText)
+            : CollationIterator(other),
+              u8(newText), pos(other.pos), length(other.length) {}
+
     virtual ~UTF8CollationIterator();
 
+    virtual bool operator==(const CollationIterator &other) const override;
+
+    void setText(const uint8_t *s, int32_t len) {
+        reset();
+        u8 = s;
+        pos = 0;
+        length = len;
+    }
+
     virtual void resetToOffset(int32_t newOffset) override;
 
     virtual int32_t getOffset() const override;
@@ -85,8 +98,21 @@ class U_I18N_API FCDUTF8CollationIterator : public UTF8CollationIterator {
               state(CHECK_FWD), start(p),
               nfcImpl(data->nfcImpl) {}
 
+    FCDUTF8CollationIterator(const FCDUTF8CollationIterator &other, const uint8_t *newText)
+            : UTF8CollationIterator(other, newText),
+              state(other.state), start(other.start), limit(other.limit),
+              nfcImpl(other.nfcImpl), normalized(other.normalized) {}
+
     virtual ~FCDUTF8CollationIterator();
 
+    virtual bool operator==(const CollationIterator &other) const override;
+
+    void setText(const uint8_t *s, int32_t len) {
+        UTF8CollationIterator::setText(s, len);
+        state = CHECK_FWD;
+        start = 0;
+    }
+
     virtual void resetToOffset(int32_t newOffset) override;
 
     virtual int32_t getOffset() const override;
@@ -0,0 +1,4 @@
+# Copyright (C) 2024 and later: Unicode, Inc. and others.
+# License & terms of use: http://www.unicode.org/copyright.html
+
+# Tools for the LSTM word break models in data/brkitr/lstm.
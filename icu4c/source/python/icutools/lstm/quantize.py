@@ -0,0 +1,150 @@
+# Copyright (C) 2024 and later: Unicode, Inc. and others.
+# License & terms of use: http://www.unicode.org/copyright.html
+
+"""Converts an LSTM word break model to the int8 quantized model format.
+
+The input is a model resource bundle source file as found in
+data/brkitr/lstm, with all the weights in float32 in the "data" intvector.
+The output is a resource bundle source file for the same model in which
+
+  - "weights" is a binary resource with the int8 values of the embedding
+    matrix followed by the forward W, forward U, backward W, backward U and
+    output W matrices, all row-major in their original shapes;
+  - "data" holds, in float32, the scales of those matrices interleaved with
+    the bias vectors in the order the runtime reads them (see LSTMData in
+    common/lstmbe.cpp). The embedding matrix has one scale per row (per
+    dictionary entry), the other matrices one scale per column (per output
+    unit).
+
+Each row or column is quantized symmetrically: scale = max(|values|) / 127
+and q = round(value / scale). The output file can be dropped next to the
+original model in data/brkitr/lstm (or test/testdata), and is compiled by
+the existing genrb build rules.
+
+Usage:
+    python3 -m icutools.lstm.quantize input.txt output.txt
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+
+def _to_float(bits):
+    return struct.unpack("<f", struct.pack("<i", bits))[0]
+
+
+def _to_bits(value):
+    return struct.unpack("<i", struct.pack("<f", value))[0]
+
+
+def _int_value(text, key):
+    match = re.search(r"^\s*%s:int\{(-?\d+)\}" % key, text, re.MULTILINE)
+    if not match:
+        raise ValueError("missing %s:int" % key)
+    return int(match.group(1))
+
+
+def _matrix(values, offset, rows, cols):
+    return [values[offset + r * cols:offset + (r + 1) * cols] for r in range(rows)], offset + rows * cols
+
+
+def _scale(values):
+    peak = max(abs(v) for v in values)
+    return peak / 127.0 if peak > 0 else 1.0
+
+
+def _quantize_row(row, scales):
+    return bytes(max(-127, min(127, int(round(v / s)))) & 0xff for v, s in zip(row, scales))
+
+
+def _quantize_rows(matrix):
+    scales = [_scale(row) for row in matrix]
+    weights = bytearray()
+    for row, scale in zip(matrix, scales):
+        weights += _quantize_row(row, [scale] * len(row))
+    return scales, weights
+
+
+def _quantize_columns(matrix):
+    scales = [_scale(column) for column in zip(*matrix)]
+    weights = bytearray()
+    for row in matrix:
+        weights += _quantize_row(row, scales)
+    return scales, weights
+
+
+def quantize(text, name):
+    embeddings = _int_value(text, "embeddings")
+    hunits = _int_value(text, "hunits")
+    dict_match = re.search(r"^\s*dict\{(.*?)^\s*\}", text, re.MULTILINE | re.DOTALL)
+    data_match = re.search(r"^(\s*)data:intvector\{(.*?)\}", text, re.MULTILINE | re.DOTALL)
+    if not dict_match or not data_match:
+        raise ValueError("missing dict or data")
+    num_index = len(re.findall(r'^\s*".*",?\s*$', dict_match.group(1), re.MULTILINE))
+    values = [_to_float(int(v)) for v in re.findall(r"-?\d+", data_match.group(2))]
+
+    offset = 0
+    embedding, offset = _matrix(values, offset, num_index + 1, embeddings)
+    forward_w, offset = _matrix(values, offset, embeddings, 4 * hunits)
+    forward_u, offset = _matrix(values, offset, hunits, 4 * hunits)
+    forward_b, offset = values[offset:offset + 4 * hunits], offset + 4 * hunits
+    backward_w, offset = _matrix(values, offset, embeddings, 4 * hunits)
+    backward_u, offset = _matrix(values, offset, hunits, 4 * hunits)
+    backward_b, offset = values[offset:offset + 4 * hunits], offset + 4 * hunits
+    output_w, offset = _matrix(values, offset, 2 * hunits, 4)
+    output_b, offset = values[offset:offset + 4], offset + 4
+    if offset != len(values):
+        raise ValueError("data has %d values, expected %d" % (len(values), offset))
+
+    floats = []
+    weights = bytearray()
+    for matrix, bias, quantizer in (
+            (embedding, None, _quantize_rows),
+            (forward_w, None, _quantize_columns),
+            (forward_u, forward_b, _quantize_columns),
+            (backward_w, None, _quantize_columns),
+            (backward_u, backward_b, _quantize_columns),
+            (output_w, output_b, _quantize_columns)):
+        scales, q = quantizer(matrix)
+        floats += scales
+        weights += q
+        if bias is not None:
+            floats += bias
+
+    indent = data_match.group(1).lstrip("\n")
+    hex_lines = [weights[i:i + 32].hex() for i in range(0, len(weights), 32)]
+    replacement = "%squantization{\"int8\"}\n" % indent
+    replacement += "%sweights:bin{\n" % indent
+    replacement += "".join("%s    %s\n" % (indent, line) for line in hex_lines)
+    replacement += "%s}\n" % indent
+    replacement += "%sdata:intvector{\n" % indent
+    replacement += "".join("%s    %d,\n" % (indent, _to_bits(v)) for v in floats)
+    replacement += "%s}" % indent
+
+    old_name = re.search(r"^(\S+):table", text, re.MULTILINE).group(1)
+    result = text[:data_match.start()] + "\n" + replacement + text[data_match.end():]
+    result = re.sub(r"^%s:table" % re.escape(old_name), "%s:table" % name, result, count=1, flags=re.MULTILINE)
+    result = re.sub(r'^(\s*)model\{"[^"]*"\}', r'\1model{"%s"}' % name, result, count=1, flags=re.MULTILINE)
+    return result
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(
+        prog="python3 -m icutools.lstm.quantize",
+        description="Convert an LSTM break model to the int8 quantized format.")
+    parser.add_argument("input", help="float32 model, e.g. Thai_graphclust_model4_heavy.txt")
+    parser.add_argument("output", help="quantized model; its base name becomes the bundle name")
+    args = parser.parse_args(argv)
+    with open(args.input, encoding="utf-8-sig") as f:
+        text = f.read()
+    name = os.path.splitext(os.path.basename(args.output))[0]
+    result = quantize(text, name)
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write("﻿" + result)
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
@@ -56,6 +56,8 @@ cnv_open(const char *name, UErrorCode *pErrorCode) {
 
 static void ListNames(void);
 static void TestFlushCache(void);
+static void TestNameCache(void);
+static void TestConverterPool(void);
 static void TestDuplicateAlias(void);
 static void TestCCSID(void);
 static void TestJ932(void);
@@ -92,6 +94,8 @@ void addTestConvert(TestNode** root)
     addTest(root, &ListNames,                   "tsconv/ccapitst/ListNames");
     addTest(root, &TestConvert,                 "tsconv/ccapitst/TestConvert");
     addTest(root, &TestFlushCache,              "tsconv/ccapitst/TestFlushCache"); 
+    addTest(root, &TestNameCache,               "tsconv/ccapitst/TestNameCache");
+    addTest(root, &TestConverterPool,           "tsconv/ccapitst/TestConverterPool");
     addTest(root, &TestAlias,                   "tsconv/ccapitst/TestAlias"); 
     addTest(root, &TestDuplicateAlias,          "tsconv/ccapitst/TestDuplicateAlias"); 
     addTest(root, &TestConvertSafeClone,        "tsconv/ccapitst/TestConvertSafeClone");
@@ -1141,6 +1145,159 @@ static void TestFlushCache(void) {
 #endif
 }
 
+/*
+ * Opening a converter a second time with the same name is served from the
+ * converter name cache; it must yield the same converter, name and warning
+ * as the first open, and must not keep ucnv_flushCache() from unloading data.
+ */
+static void TestNameCache(void) {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    static const char *const names[] = {
+        "windows-1252", "cp1252", "ibm-1047,swaplfnl", "ISO-2022-JP,version=1",
+        "Shift_JIS", "ibm-943", "ISO-8859-1", "US-ASCII", "UTF-16BE", "x-no-such-charset"
+    };
+    char firstName[128];
+    int32_t i, round, flushCount;
+
+    ucnv_flushCache();
+    for (round = 0; round < 2; ++round) {
+        for (i = 0; i < UPRV_LENGTHOF(names); ++i) {
+            UErrorCode firstStatus = U_ZERO_ERROR, status = U_ZERO_ERROR;
+            UConverter *first = ucnv_open(names[i], &firstStatus);
+            UConverter *second = ucnv_open(names[i], &status);
+            if (status != firstStatus) {
+                log_err("ucnv_open(%s) status %s, then %s\n",
+                        names[i], u_errorName(firstStatus), u_errorName(status));
+            }
+            if (U_SUCCESS(firstStatus) && U_SUCCESS(status)) {
+                UErrorCode nameStatus = U_ZERO_ERROR;
+                strcpy(firstName, ucnv_getName(first, &nameStatus));
+                if (strcmp(firstName, ucnv_getName(second, &nameStatus)) != 0) {
+                    log_err("ucnv_open(%s) name %s, then %s\n",
+                            names[i], firstName, ucnv_getName(second, &nameStatus));
+                }
+            }
+            ucnv_close(first);
+            ucnv_close(second);
+        }
+
+        /* Everything is closed: the data-based converters must be unloaded. */
+        if ((flushCount = ucnv_flushCache()) == 0) {
+            log_data_err("ucnv_flushCache() unloaded nothing after closing all converters\n");
+        }
+        if ((flushCount = ucnv_flushCache()) != 0) {
+            log_err("second ucnv_flushCache() unloaded %d converters, expected 0\n", (int)flushCount);
+        }
+    }
+#endif
+}
+
+static void U_CALLCONV
+poolCloseCountingFromU(const void *context, UConverterFromUnicodeArgs *fromUArgs,
+                       const UChar *codeUnits, int32_t length, UChar32 codePoint,
+                       UConverterCallbackReason reason, UErrorCode *pErrorCode) {
+    if (reason == UCNV_CLOSE) {
+        ++*(int32_t *)context;
+    } else {
+        UCNV_FROM_U_CALLBACK_STOP(NULL, fromUArgs, codeUnits, length, codePoint, reason, pErrorCode);
+    }
+}
+
+static void TestConverterPool(void) {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    static const UChar longSubst[] = { 0x5b, 0x75, 0x6e, 0x6d, 0x61, 0x70, 0x70, 0x65, 0x64, 0x5d, 0 };
+    static const UChar text[] = { 0x61, 0x20ac, 0x4e00, 0x62 };
+    UErrorCode errorCode = U_ZERO_ERROR;
+    UConverterPool *pool = ucnv_openPool(2, &errorCode);
+    UConverter *cnv, *cnv2, *cnv3, *other;
+    UConverterToUCallback toUAction;
+    UConverterFromUCallback fromUAction;
+    const void *context;
+    char subChars[4], expectedSubChars[4], out[32];
+    int8_t subCharsLength = sizeof(subChars), expectedLength = sizeof(expectedSubChars);
+    int32_t closeCount = 0, length;
+
+    if (U_FAILURE(errorCode)) {
+        log_err("ucnv_openPool(2) failed - %s\n", u_errorName(errorCode));
+        return;
+    }
+    cnv = ucnv_acquire(pool, "windows-1252", &errorCode);
+    if (U_FAILURE(errorCode)) {
+        log_data_err("ucnv_acquire(windows-1252) failed - %s\n", u_errorName(errorCode));
+        ucnv_closePool(pool);
+        return;
+    }
+    ucnv_getSubstChars(cnv, expectedSubChars, &expectedLength, &errorCode);
+
+    /* Change everything that ucnv_release() must restore. */
+    ucnv_setFromUCallBack(cnv, poolCloseCountingFromU, &closeCount, NULL, NULL, &errorCode);
+    ucnv_setToUCallBack(cnv, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+    ucnv_setSubstString(cnv, longSubst, -1, &errorCode);
+    ucnv_setFallback(cnv, true);
+    length = ucnv_toUChars(cnv, NULL, 0, "\x81", 1, &errorCode);  /* unmapped byte */
+    errorCode = U_ZERO_ERROR;
+
+    /* A different converter while the first one is in use. */
+    cnv2 = ucnv_acquire(pool, "windows-1252", &errorCode);
+    if (cnv2 == cnv || U_FAILURE(errorCode)) {
+        log_err("ucnv_acquire() returned an acquired converter or failed - %s\n", u_errorName(errorCode));
+    }
+
+    ucnv_release(pool, cnv);
+    if (closeCount != 1) {
+        log_err("ucnv_release() did not notify the callback with UCNV_CLOSE\n");
+    }
+    cnv3 = ucnv_acquire(pool, "windows-1252", &errorCode);
+    if (cnv3 != cnv) {
+        log_err("ucnv_acquire() did not reuse the released converter\n");
+    }
+    ucnv_getToUCallBack(cnv3, &toUAction, &context);
+    ucnv_getFromUCallBack(cnv3, &fromUAction, &context);
+    if (toUAction != UCNV_TO_U_CALLBACK_SUBSTITUTE || fromUAction != UCNV_FROM_U_CALLBACK_SUBSTITUTE ||
+            context != NULL) {
+        log_err("a reused converter does not have the default callbacks\n");
+    }
+    ucnv_getSubstChars(cnv3, subChars, &subCharsLength, &errorCode);
+    if (subCharsLength != expectedLength || memcmp(subChars, expectedSubChars, expectedLength) != 0) {
+        log_err("a reused converter does not have the default substitution characters\n");
+    }
+    if (ucnv_usesFallback(cnv3)) {
+        log_err("a reused converter uses fallbacks\n");
+    }
+    length = ucnv_fromUChars(cnv3, out, sizeof(out), text, UPRV_LENGTHOF(text), &errorCode);
+    if (U_FAILURE(errorCode) || length != 4 || memcmp(out, "a\x80\x1a" "b", 4) != 0) {
+        log_err("a reused converter converts incorrectly - %s\n", u_errorName(errorCode));
+    }
+    if (closeCount != 1) {
+        log_err("the callback of a released converter was called again\n");
+    }
+
+    /* The pool is full of acquired converters: This one is not pooled. */
+    other = ucnv_acquire(pool, "ISO-8859-1", &errorCode);
+    if (U_FAILURE(errorCode) || other == NULL) {
+        log_err("ucnv_acquire() of an unpooled converter failed - %s\n", u_errorName(errorCode));
+    }
+    ucnv_release(pool, other);
+    ucnv_release(pool, cnv3);
+    ucnv_release(pool, cnv2);
+
+    /* Replaces a released converter. */
+    other = ucnv_acquire(pool, "ISO-8859-1", &errorCode);
+    if (U_FAILURE(errorCode) || other == cnv || other == cnv2) {
+        log_err("ucnv_acquire() did not open a new converter - %s\n", u_errorName(errorCode));
+    }
+    ucnv_release(pool, other);
+    ucnv_release(pool, NULL);
+    ucnv_closePool(pool);
+    ucnv_closePool(NULL);
+
+    errorCode = U_ZERO_ERROR;
+    if (ucnv_openPool(0, &errorCode) != NULL || errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucnv_openPool(0) did not fail with U_ILLEGAL_ARGUMENT_ERROR\n");
+    }
+#endif
+}
+
 /**
  * Test the converter alias API, specifically the fuzzy matching of
  * alias names and the alias table integrity.  Make sure each
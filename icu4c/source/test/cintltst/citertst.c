@@ -59,6 +59,7 @@ void addCollIterTest(TestNode** root)
     addTest(root, &TestSmallBuffer, "tscoll/citertst/TestSmallBuffer");
     addTest(root, &TestDiscontiguos, "tscoll/citertst/TestDiscontiguos");
     addTest(root, &TestSearchCollatorElements, "tscoll/citertst/TestSearchCollatorElements");
+    addTest(root, &TestUTF8Elements, "tscoll/citertst/TestUTF8Elements");
 }
 
 /* The locales we support */
@@ -1259,4 +1260,131 @@ static void TestSearchCollatorElements(void)
     }
 }
 
+/* Returns the UTF-8 length of the first length16 code units of s. */
+static int32_t getUTF8Offset(const UChar *s, int32_t length16) {
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t length8 = 0;
+    u_strToUTF8WithSub(NULL, 0, &length8, s, length16, 0xfffd, NULL, &status);
+    return length8;
+}
+
+static void TestUTF8Elements(void)
+{
+    static const char *const locales[] = { "root", "sk", "ja", "de@collation=phonebook", "th" };
+    static const char *const strings[] = {
+        "", "abc", "chA ChB cH", "\\u00C5A\\u030A\\u0316a\\u0301\\u0327",
+        "\\u30A2\\u30FC\\u30AB\\u30FC\\u30FD", "x\\U0001F600y\\U00020000",
+        "\\uAC00\\u1100\\u1161\\u11A8\\uAC01", "12 345", "\\u0E40\\u0E01\\u0E4C\\u00E4\\u00DF",
+        "a\\uFFFDb"
+    };
+    int32_t l, s;
+    for (l = 0; l < UPRV_LENGTHOF(locales); ++l) {
+        UErrorCode status = U_ZERO_ERROR;
+        UCollator *coll = ucol_open(locales[l], &status);
+        UCollationElements *iter16, *iter8;
+        if (U_FAILURE(status)) {
+            log_data_err("ucol_open(%s) failed: %s\n", locales[l], u_errorName(status));
+            continue;
+        }
+        if (l == 0) {
+            /* Exercise the FCD-checking iterator, and numeric collation. */
+            ucol_setAttribute(coll, UCOL_NORMALIZATION_MODE, UCOL_ON, &status);
+            ucol_setAttribute(coll, UCOL_NUMERIC_COLLATION, UCOL_ON, &status);
+        }
+        iter16 = ucol_openElements(coll, NULL, 0, &status);
+        iter8 = ucol_openElementsUTF8(coll, NULL, 0, &status);
+        if (U_FAILURE(status)) {
+            log_err("ucol_openElements[UTF8](%s) failed: %s\n", locales[l], u_errorName(status));
+            ucol_closeElements(iter16);
+            ucol_closeElements(iter8);
+            ucol_close(coll);
+            continue;
+        }
+        for (s = 0; s < UPRV_LENGTHOF(strings); ++s) {
+            UChar text16[40];
+            char text8[120];
+            uint8_t key16[200], key8[200];
+            int32_t length16 = u_unescape(strings[s], text16, UPRV_LENGTHOF(text16));
+            int32_t length8 = 0;
+            int32_t keyLength16, keyLength8, i;
+            int32_t ce16, ce8;
+            /* The last string tests that ill-formed UTF-8 is treated like U+FFFD. */
+            UBool illFormed = s == UPRV_LENGTHOF(strings) - 1;
+            u_strToUTF8(text8, UPRV_LENGTHOF(text8), &length8, text16, length16, &status);
+            if (illFormed) {
+                uprv_strcpy(text8, "a\xff" "b");
+                length8 = 3;
+            }
+            ucol_setText(iter16, text16, length16, &status);
+            ucol_setTextUTF8(iter8, text8, length8, &status);
+            if (U_FAILURE(status)) {
+                log_err("ucol_setText[UTF8](%s, %s) failed: %s\n",
+                        locales[l], strings[s], u_errorName(status));
+                break;
+            }
+
+            /* forward */
+            do {
+                ce16 = ucol_next(iter16, &status);
+                ce8 = ucol_next(iter8, &status);
+                if (ce16 != ce8 || (!illFormed &&
+                        getUTF8Offset(text16, ucol_getOffset(iter16)) != ucol_getOffset(iter8))) {
+                    log_err("%s \"%s\" forward: UTF-16 CE %08x offset %d != UTF-8 CE %08x offset %d\n",
+                            locales[l], strings[s], ce16, ucol_getOffset(iter16),
+                            ce8, ucol_getOffset(iter8));
+                    break;
+                }
+            } while (ce16 != UCOL_NULLORDER && U_SUCCESS(status));
+
+            /* backward */
+            ucol_reset(iter16);
+            ucol_reset(iter8);
+            do {
+                ce16 = ucol_previous(iter16, &status);
+                ce8 = ucol_previous(iter8, &status);
+                if (ce16 != ce8 || (!illFormed &&
+                        getUTF8Offset(text16, ucol_getOffset(iter16)) != ucol_getOffset(iter8))) {
+                    log_err("%s \"%s\" backward: UTF-16 CE %08x offset %d != UTF-8 CE %08x offset %d\n",
+                            locales[l], strings[s], ce16, ucol_getOffset(iter16),
+                            ce8, ucol_getOffset(iter8));
+                    break;
+                }
+            } while (ce16 != UCOL_NULLORDER && U_SUCCESS(status));
+
+            /* setOffset() at each code point boundary */
+            for (i = 0; i <= length16 && !illFormed; ++i) {
+                if (i < length16 && U16_IS_TRAIL(text16[i])) { continue; }
+                ucol_setOffset(iter16, i, &status);
+                ucol_setOffset(iter8, getUTF8Offset(text16, i), &status);
+                ce16 = ucol_next(iter16, &status);
+                ce8 = ucol_next(iter8, &status);
+                if (ce16 != ce8) {
+                    log_err("%s \"%s\" setOffset(%d): UTF-16 CE %08x != UTF-8 CE %08x\n",
+                            locales[l], strings[s], i, ce16, ce8);
+                    break;
+                }
+            }
+
+            /* sort keys */
+            keyLength16 = ucol_getSortKey(coll, text16, length16, key16, UPRV_LENGTHOF(key16));
+            keyLength8 = ucol_getSortKeyUTF8(coll, text8, length8, key8, UPRV_LENGTHOF(key8));
+            if (keyLength16 != keyLength8 || uprv_memcmp(key16, key8, keyLength16) != 0) {
+                log_err("%s \"%s\": ucol_getSortKeyUTF8() differs from ucol_getSortKey()\n",
+                        locales[l], strings[s]);
+            }
+            if (ucol_getSortKeyUTF8(coll, text8, length8, NULL, 0) != keyLength8) {
+                log_err("%s \"%s\": ucol_getSortKeyUTF8() preflighting returns a different length\n",
+                        locales[l], strings[s]);
+            }
+            if (U_FAILURE(status)) {
+                log_err("%s \"%s\": error %s\n", locales[l], strings[s], u_errorName(status));
+                status = U_ZERO_ERROR;
+            }
+        }
+        ucol_closeElements(iter16);
+        ucol_closeElements(iter8);
+        ucol_close(coll);
+    }
+}
+
 #endif /* #if !UCONFIG_NO_COLLATION */
@@ -91,6 +91,12 @@ static void TestDiscontiguos(void);
 */
 static void TestSearchCollatorElements(void);
 
+/**
+* TestUTF8Elements tests that iterating over UTF-8 text and UTF-8 sort keys
+* yield the same collation elements and sort keys as for the UTF-16 text.
+**/
+static void TestUTF8Elements(void);
+
 /*------------------------------------------------------------------------
  Internal utilities
  */
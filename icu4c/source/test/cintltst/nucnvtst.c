@@ -57,6 +57,7 @@ static void TestLATIN1(void);
 static void TestSBCS(void);
 static void TestDBCS(void);
 static void TestMBCS(void);
+static void TestMBCSASCIIRuns(void);
 #if !UCONFIG_NO_LEGACY_CONVERSION && !UCONFIG_NO_FILE_IO
 static void TestICCRunout(void);
 #endif
@@ -283,6 +284,7 @@ void addTestNewConvert(TestNode** root)
    addTest(root, &TestICCRunout, "tsconv/nucnvtst/TestICCRunout");
 #endif
    addTest(root, &TestMBCS, "tsconv/nucnvtst/TestMBCS");
+   addTest(root, &TestMBCSASCIIRuns, "tsconv/nucnvtst/TestMBCSASCIIRuns");
 
 #ifdef U_ENABLE_GENERIC_ISO_2022
    addTest(root, &TestISO_2022, "tsconv/nucnvtst/TestISO_2022");
@@ -2663,6 +2665,154 @@ TestMBCS(void) {
 
 }
 
+/*
+ * The MBCS converters convert runs of ASCII in larger chunks.
+ * Compare the results for whole buffers (which take those fast paths)
+ * with one input unit at a time (which cannot).
+ */
+static void
+TestMBCSASCIIRuns(void) {
+    static const char *const names[]={
+        "windows-1252", "ibm-943_P15A-2003", "windows-936-2000", "ibm-970_P110_P110-2006_U2",
+        "ibm-1363", "gb18030", "ibm-1390", "ibm-37"
+    };
+    static const UChar nonASCII[]={ 0xe9, 0x3042, 0x4e00, 0xac00, 0x20ac, 0xffff, 0xff76 };
+
+    UChar text[2000], uchars[2000], refUChars[2000];
+    char bytes[8000], refBytes[8000];
+    int32_t offsets[8000], refOffsets[8000];
+    int32_t length=0, i, j;
+
+    /* ASCII runs of varying lengths, including controls, between non-ASCII characters */
+    for(i=0; length<1900; ++i) {
+        int32_t runLength=i%21;
+        for(j=0; j<runLength; ++j) {
+            text[length++]=(UChar)((i*7+j*3)%0x80);
+        }
+        text[length++]=nonASCII[i%UPRV_LENGTHOF(nonASCII)];
+    }
+
+    for(i=0; i<UPRV_LENGTHOF(names); ++i) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(names[i], &errorCode);
+        const UChar *src;
+        const char *bsrc;
+        char *btarget;
+        UChar *utarget;
+        int32_t bytesLength, refBytesLength, ucharsLength, refUCharsLength, k;
+        if(U_FAILURE(errorCode)) {
+            log_data_err("Unable to open %s converter: %s\n", names[i], u_errorName(errorCode));
+            continue;
+        }
+
+        /* fromUnicode: whole buffer vs. one UChar at a time */
+        src=text;
+        btarget=bytes;
+        ucnv_fromUnicode(cnv, &btarget, bytes+UPRV_LENGTHOF(bytes), &src, text+length,
+                         offsets, true, &errorCode);
+        bytesLength=(int32_t)(btarget-bytes);
+        ucnv_resetFromUnicode(cnv);
+        btarget=refBytes;
+        for(j=0; j<length && U_SUCCESS(errorCode); ++j) {
+            char *start=btarget;
+            src=text+j;
+            ucnv_fromUnicode(cnv, &btarget, refBytes+UPRV_LENGTHOF(refBytes), &src, text+j+1,
+                             refOffsets+(start-refBytes), j==length-1, &errorCode);
+            for(k=(int32_t)(start-refBytes); k<(int32_t)(btarget-refBytes); ++k) {
+                if(refOffsets[k]>=0) {
+                    refOffsets[k]+=j;
+                }
+            }
+        }
+        refBytesLength=(int32_t)(btarget-refBytes);
+        if(U_FAILURE(errorCode)) {
+            log_err("%s fromUnicode failed: %s\n", names[i], u_errorName(errorCode));
+        } else if(bytesLength!=refBytesLength || 0!=memcmp(bytes, refBytes, bytesLength)) {
+            log_err("%s fromUnicode of ASCII runs differs from one UChar at a time\n", names[i]);
+        } else {
+            for(k=0; k<bytesLength; ++k) {
+                if(refOffsets[k]>=0 && offsets[k]!=refOffsets[k]) {
+                    log_err("%s fromUnicode offsets[%d]=%d != %d\n",
+                            names[i], (int)k, (int)offsets[k], (int)refOffsets[k]);
+                    break;
+                }
+            }
+        }
+
+        /* fromUnicode with a small target buffer */
+        ucnv_resetFromUnicode(cnv);
+        src=text;
+        btarget=refBytes;
+        do {
+            char *limit=btarget+5;
+            errorCode=U_ZERO_ERROR;
+            if(limit>refBytes+UPRV_LENGTHOF(refBytes)) {
+                limit=refBytes+UPRV_LENGTHOF(refBytes);
+            }
+            ucnv_fromUnicode(cnv, &btarget, limit, &src, text+length, NULL, true, &errorCode);
+        } while(errorCode==U_BUFFER_OVERFLOW_ERROR);
+        if(U_FAILURE(errorCode) || (btarget-refBytes)!=bytesLength ||
+                0!=memcmp(bytes, refBytes, bytesLength)) {
+            log_err("%s fromUnicode with a small target buffer differs - %s\n",
+                    names[i], u_errorName(errorCode));
+        }
+
+        /* toUnicode: whole buffer vs. one byte at a time */
+        errorCode=U_ZERO_ERROR;
+        bsrc=bytes;
+        utarget=uchars;
+        ucnv_toUnicode(cnv, &utarget, uchars+UPRV_LENGTHOF(uchars), &bsrc, bytes+bytesLength,
+                       offsets, true, &errorCode);
+        ucharsLength=(int32_t)(utarget-uchars);
+        ucnv_resetToUnicode(cnv);
+        utarget=refUChars;
+        for(j=0; j<bytesLength && U_SUCCESS(errorCode); ++j) {
+            UChar *start=utarget;
+            bsrc=bytes+j;
+            ucnv_toUnicode(cnv, &utarget, refUChars+UPRV_LENGTHOF(refUChars), &bsrc, bytes+j+1,
+                           refOffsets+(start-refUChars), j==bytesLength-1, &errorCode);
+            for(k=(int32_t)(start-refUChars); k<(int32_t)(utarget-refUChars); ++k) {
+                if(refOffsets[k]>=0) {
+                    refOffsets[k]+=j;
+                }
+            }
+        }
+        refUCharsLength=(int32_t)(utarget-refUChars);
+        if(U_FAILURE(errorCode)) {
+            log_err("%s toUnicode failed: %s\n", names[i], u_errorName(errorCode));
+        } else if(ucharsLength!=refUCharsLength || 0!=u_memcmp(uchars, refUChars, ucharsLength)) {
+            log_err("%s toUnicode of ASCII runs differs from one byte at a time\n", names[i]);
+        } else {
+            for(k=0; k<ucharsLength; ++k) {
+                if(refOffsets[k]>=0 && offsets[k]!=refOffsets[k]) {
+                    log_err("%s toUnicode offsets[%d]=%d != %d\n",
+                            names[i], (int)k, (int)offsets[k], (int)refOffsets[k]);
+                    break;
+                }
+            }
+        }
+
+        /* toUnicode with a small target buffer */
+        ucnv_resetToUnicode(cnv);
+        bsrc=bytes;
+        utarget=refUChars;
+        do {
+            UChar *limit=utarget+5;
+            errorCode=U_ZERO_ERROR;
+            if(limit>refUChars+UPRV_LENGTHOF(refUChars)) {
+                limit=refUChars+UPRV_LENGTHOF(refUChars);
+            }
+            ucnv_toUnicode(cnv, &utarget, limit, &bsrc, bytes+bytesLength, NULL, true, &errorCode);
+        } while(errorCode==U_BUFFER_OVERFLOW_ERROR);
+        if(U_FAILURE(errorCode) || (utarget-refUChars)!=ucharsLength ||
+                0!=u_memcmp(uchars, refUChars, ucharsLength)) {
+            log_err("%s toUnicode with a small target buffer differs - %s\n",
+                    names[i], u_errorName(errorCode));
+        }
+        ucnv_close(cnv);
+    }
+}
+
 #if !UCONFIG_NO_LEGACY_CONVERSION && !UCONFIG_NO_FILE_IO
 static void
 TestICCRunout(void) {
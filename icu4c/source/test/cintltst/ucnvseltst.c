@@ -470,6 +470,23 @@ static void TestSelector(void)
         /* UTF-8 NUL-terminated */
         verifyResult(ucnvsel_selectForUTF8(sel_rt, s, -1, &status), manual_rt);
         verifyResult(ucnvsel_selectForUTF8(sel_fb, s, -1, &status), manual_fb);
+        /* UTF-8 batch, with length and NUL-terminated */
+        {
+          const char *strings8[2];
+          int32_t lengths8[2];
+          UEnumeration *results[2] = { NULL, NULL };
+          strings8[0] = strings8[1] = s;
+          lengths8[0] = length8;
+          lengths8[1] = -1;
+          ucnvsel_selectForUTF8Strings(sel_fb, strings8, lengths8, 2, results, &status);
+          if (U_FAILURE(status)) {
+            log_err("ucnvsel_selectForUTF8Strings() failed - %s\n", u_errorName(status));
+            status = U_ZERO_ERROR;
+          } else {
+            verifyResult(results[0], manual_fb);
+            verifyResult(results[1], manual_fb);
+          }
+        }
 
         u_strFromUTF8(utf16, UPRV_LENGTHOF(utf16), &length16, s, length8, &status);
         if (U_FAILURE(status)) {
@@ -486,12 +503,50 @@ static void TestSelector(void)
             /* UTF-16 NUL-terminated */
             verifyResult(ucnvsel_selectForString(sel_rt, utf16, -1, &status), manual_rt);
             verifyResult(ucnvsel_selectForString(sel_fb, utf16, -1, &status), manual_fb);
+            /* UTF-16 batch, all NUL-terminated */
+            {
+              const UChar *strings16[1];
+              UEnumeration *results[1] = { NULL };
+              strings16[0] = utf16;
+              ucnvsel_selectForStrings(sel_rt, strings16, NULL, 1, results, &status);
+              if (U_FAILURE(status)) {
+                log_err("ucnvsel_selectForStrings() failed - %s\n", u_errorName(status));
+                status = U_ZERO_ERROR;
+              } else {
+                verifyResult(results[0], manual_rt);
+              }
+            }
           }
         }
 
         uprv_free(manual_rt);
         uprv_free(manual_fb);
       }
+      /* a NULL string in a batch is only allowed with length 0 */
+      {
+        const char *strings8[2] = { NULL, "abc" };
+        int32_t lengths8[2] = { 0, -1 };
+        UEnumeration *results[2] = { NULL, NULL };
+        /* not a real enumeration; only checks that failures overwrite all of the results */
+        UEnumeration *unset = (UEnumeration *)strings8;
+        status = U_ZERO_ERROR;
+        ucnvsel_selectForUTF8Strings(sel_rt, strings8, lengths8, 2, results, &status);
+        uenum_close(results[0]);
+        uenum_close(results[1]);
+        if (U_FAILURE(status)) {
+          log_err("ucnvsel_selectForUTF8Strings(NULL string with length 0) failed - %s\n", u_errorName(status));
+        }
+        results[0] = results[1] = unset;
+        ucnvsel_selectForUTF8Strings(sel_rt, strings8, NULL, 2, results, &status);
+        if (status != U_ILLEGAL_ARGUMENT_ERROR || results[0] != NULL || results[1] != NULL) {
+          log_err("ucnvsel_selectForUTF8Strings(NULL string, NUL-terminated) did not fail - %s\n", u_errorName(status));
+        }
+        results[0] = results[1] = unset;
+        ucnvsel_selectForUTF8Strings(sel_rt, strings8, lengths8, 2, results, &status);
+        if (status != U_ILLEGAL_ARGUMENT_ERROR || results[0] != NULL || results[1] != NULL) {
+          log_err("ucnvsel_selectForUTF8Strings(failed status) did not set the results to NULL - %s\n", u_errorName(status));
+        }
+      }
       ucnvsel_close(sel_rt);
       ucnvsel_close(sel_fb);
       uprv_free(buffer_fb);
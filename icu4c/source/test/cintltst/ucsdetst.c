@@ -30,6 +30,7 @@ static void TestC1Bytes(void);
 static void TestInputFilter(void);
 static void TestChaining(void);
 static void TestBufferOverflow(void);
+static void TestScanLimit(void);
 static void TestIBM424(void);
 static void TestIBM420(void);
 
@@ -44,6 +45,7 @@ void addUCsdetTest(TestNode** root)
     addTest(root, &TestInputFilter, "ucsdetst/TestInputFilter");
     addTest(root, &TestChaining, "ucsdetst/TestErrorChaining");
     addTest(root, &TestBufferOverflow, "ucsdetst/TestBufferOverflow");
+    addTest(root, &TestScanLimit, "ucsdetst/TestScanLimit");
 #if !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestIBM424, "ucsdetst/TestIBM424");
     addTest(root, &TestIBM420, "ucsdetst/TestIBM420");
@@ -361,6 +363,7 @@ static void TestChaining(void) {
     ucsdet_detectAll(NULL, NULL, &status);
     ucsdet_getUChars(NULL, NULL, 0, &status);
     ucsdet_getUChars(NULL, NULL, 0, &status);
+    ucsdet_setScanLimit(NULL, 0, &status);
     ucsdet_close(NULL);
 
     /* All of this code should have done nothing. */
@@ -428,6 +431,68 @@ static void TestBufferOverflow(void) {
     ucsdet_close(csd);
 }
 
+static void TestScanLimit(void)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    static const char ss[] = "This is a string of plain English text which is long enough for the "
+               "detector to have some confidence in it, with non-ascii characters only at the end: "
+               "\\u0391\\u0392\\u0393\\u0394\\u0395\\u0396\\u0397\\u0398";
+    int32_t byteLength = 0, sLength = 0, dLength = 0, asciiLength;
+    UChar s[sizeof(ss)];
+    UChar detected[sizeof(ss)];
+    char *bytes;
+    UCharsetDetector *csd = ucsdet_open(&status);
+    const UCharsetMatch *match;
+    const char *name;
+
+    sLength = u_unescape(ss, s, sizeof(ss));
+    bytes = extractBytes(s, sLength, "UTF-8", &byteLength);
+    asciiLength = (int32_t) (strchr(bytes, ':') - bytes);
+
+    ucsdet_setText(csd, bytes, byteLength, &status);
+    match = ucsdet_detect(csd, &status);
+    name = match != NULL ? ucsdet_getName(match, &status) : NULL;
+    if (U_FAILURE(status) || name == NULL || strcmp(name, "UTF-8") != 0) {
+        log_err("Without a scan limit, detected %s instead of UTF-8 - %s\n", name, u_errorName(status));
+        goto bail;
+    }
+
+    /* Only the ASCII prefix is examined, without setting the text again. */
+    ucsdet_setScanLimit(csd, asciiLength, &status);
+    match = ucsdet_detect(csd, &status);
+    name = match != NULL ? ucsdet_getName(match, &status) : NULL;
+    if (U_FAILURE(status) || name == NULL || strcmp(name, "ISO-8859-1") != 0) {
+        log_err("With a scan limit of %d, detected %s instead of ISO-8859-1 - %s\n",
+            asciiLength, name, u_errorName(status));
+        goto bail;
+    }
+
+    /* The whole text is still converted. */
+    dLength = ucsdet_getUChars(match, detected, UPRV_LENGTHOF(detected), &status);
+    if (U_FAILURE(status) || dLength != byteLength) {
+        log_err("With a scan limit, ucsdet_getUChars() returned %d UChars instead of %d - %s\n",
+            dLength, byteLength, u_errorName(status));
+    }
+
+    status = U_ZERO_ERROR;
+    ucsdet_setScanLimit(csd, -1, &status);
+    if (status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucsdet_setScanLimit(-1) returned %s instead of U_ILLEGAL_ARGUMENT_ERROR\n", u_errorName(status));
+    }
+
+    status = U_ZERO_ERROR;
+    ucsdet_setScanLimit(csd, 0, &status);
+    match = ucsdet_detect(csd, &status);
+    name = match != NULL ? ucsdet_getName(match, &status) : NULL;
+    if (U_FAILURE(status) || name == NULL || strcmp(name, "UTF-8") != 0) {
+        log_err("After removing the scan limit, detected %s instead of UTF-8 - %s\n", name, u_errorName(status));
+    }
+
+bail:
+    freeBytes(bytes);
+    ucsdet_close(csd);
+}
+
 static void TestIBM424(void)
 {
     UErrorCode status = U_ZERO_ERROR;
@@ -16,6 +16,7 @@
 #include "intltest.h"
 #include "alphaindextst.h"
 #include "cmemory.h"
+#include "uvector.h"
 
 #include "unicode/alphaindex.h"
 #include "unicode/coll.h"
@@ -68,6 +69,7 @@ void AlphabeticIndexTest::runIndexedTest( int32_t index, UBool exec, const char*
     TESTCASE_AUTO(TestJapaneseKanji);
     TESTCASE_AUTO(TestChineseUnihan);
     TESTCASE_AUTO(testHasBuckets);
+    TESTCASE_AUTO(TestGetBucketIndexes);
     TESTCASE_AUTO_END;
 }
 
@@ -757,4 +759,79 @@ void AlphabeticIndexTest::checkHasBuckets(const Locale &locale, UScriptCode scri
             uscript_getScript(bucket->getLabel().char32At(0), errorCode));
 }
 
+void AlphabeticIndexTest::TestGetBucketIndexes() {
+    IcuTestErrorCode errorCode(*this, "TestGetBucketIndexes");
+    // Locales with contractions, multi-character labels, Hangul, and Chinese sort orders.
+    static const char *const localeIDs[] = {
+        "en", "cs", "da", "sv", "ko", "ja", "zh", "zh-u-co-unihan", "en-u-kn"
+    };
+    for (const char *localeID : localeIDs) {
+        AlphabeticIndex aindex(localeID, errorCode);
+        aindex.setMaxLabelCount(500, errorCode);
+        LocalPointer<AlphabeticIndex::ImmutableIndex> index(
+            aindex.buildImmutableIndex(errorCode), errorCode);
+        if (errorCode.errDataIfFailureAndReset("AlphabeticIndex(%s)", localeID)) {
+            continue;
+        }
+        // Names starting with each label, with suffixes that may continue
+        // a contraction or a multi-character label, or combine with the label.
+        static const char16_t *const suffixes[] = {
+            u"", u"a", u"h", u"-", u"1", u"\u00E9", u"\u0308", u"\u0316", u"zz", u"\u4E00",
+            u"\u1161", u"\u11A8",
+            u"abcdefghijklmnopqrstuvwxyz", u"\u9F8D\u9F8D\u9F8D\u9F8D\u9F8D\u9F8D\u9F8D\u9F8D"
+        };
+        UVector names(errorCode);
+        names.setDeleter(uprv_deleteUObject);
+        for (int32_t rep = 0; names.size() < 10000; ++rep) {
+            for (int32_t i = 0; i < index->getBucketCount(); ++i) {
+                UnicodeString label = index->getBucket(i)->getLabel();
+                for (const char16_t *suffix : suffixes) {
+                    UnicodeString *name = new UnicodeString(label);
+                    name->append(suffix);
+                    // Vary the name between repetitions.
+                    name->append(static_cast<UChar32>(0x61 + rep % 26));
+                    names.adoptElement(name, errorCode);
+                }
+            }
+        }
+        names.adoptElement(new UnicodeString(), errorCode);
+        UnicodeString *bogus = new UnicodeString();
+        bogus->setToBogus();
+        names.adoptElement(bogus, errorCode);
+        if (errorCode.errIfFailureAndReset("building names for %s", localeID)) {
+            continue;
+        }
+        int32_t count = names.size();
+        LocalArray<UnicodeString> nameArray(new UnicodeString[count]);
+        LocalArray<int32_t> expected(new int32_t[count]);
+        for (int32_t i = 0; i < count; ++i) {
+            nameArray[i] = *static_cast<const UnicodeString *>(names[i]);
+            expected[i] = index->getBucketIndex(nameArray[i], errorCode);
+        }
+        LocalArray<int32_t> actual(new int32_t[count]);
+        index->getBucketIndexes(nameArray.getAlias(), count, actual.getAlias(), errorCode);
+        if (errorCode.errIfFailureAndReset("getBucketIndexes(%s)", localeID)) {
+            continue;
+        }
+        for (int32_t i = 0; i < count; ++i) {
+            if (expected[i] != actual[i]) {
+                errln("%s names[%d]: getBucketIndexes()=%d != getBucketIndex()=%d",
+                      localeID, static_cast<int>(i),
+                      static_cast<int>(actual[i]), static_cast<int>(expected[i]));
+                break;
+            }
+        }
+    }
+    // Argument checking.
+    AlphabeticIndex aindex("en", errorCode);
+    LocalPointer<AlphabeticIndex::ImmutableIndex> index(aindex.buildImmutableIndex(errorCode), errorCode);
+    if (errorCode.errDataIfFailureAndReset("AlphabeticIndex(en)")) {
+        return;
+    }
+    index->getBucketIndexes(nullptr, 0, nullptr, errorCode);
+    errorCode.errIfFailureAndReset("getBucketIndexes(count=0)");
+    index->getBucketIndexes(nullptr, 1, nullptr, errorCode);
+    errorCode.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR, "getBucketIndexes(names=nullptr)");
+}
+
 #endif
@@ -53,6 +53,7 @@ class AlphabeticIndexTest: public IntlTest {
 
     void testHasBuckets();
     void checkHasBuckets(const Locale &locale, UScriptCode script);
+    void TestGetBucketIndexes();
 };
 
 #endif
@@ -11,8 +11,15 @@
 * created by: Markus W. Scherer
 */
 
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <map>
+#include <stdio.h>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "unicode/utypes.h"
@@ -37,16 +44,21 @@
 #include "cmemory.h"
 #include "collation.h"
 #include "collationdata.h"
+#include "collationfastlatin.h"
 #include "collationfcd.h"
 #include "collationiterator.h"
 #include "collationroot.h"
 #include "collationrootelements.h"
 #include "collationruleparser.h"
+#include "collationsettings.h"
 #include "collationweights.h"
 #include "cstring.h"
 #include "intltest.h"
 #include "normalizer2impl.h"
+#include "putilimp.h"
 #include "ucbuf.h"
+#include "ucmndata.h"
+#include "ucol_imp.h"
 #include "uhash.h"
 #include "uitercollationiterator.h"
 #include "utf16collationiterator.h"
@@ -90,6 +102,12 @@ class CollationTest : public IntlTest {
     void TestCollatorPredicateTypes();
     void TestUCollatorPredicateTypes();
     void TestCollatorMap();
+    void TestSortKeys();
+    void TestSortStrings();
+    void TestFastLatinGreekCyrillic();
+    void TestSortKeyPrefix();
+    void TestRulesCache();
+    void TestKeywordPrototypes();
 
 private:
     void checkFCD(const char *name, CollationIterator &ci, CodePointIterator &cpi);
@@ -168,6 +186,12 @@ void CollationTest::runIndexedTest(int32_t index, UBool exec, const char *&name,
     TESTCASE_AUTO(TestCollatorPredicateTypes);
     TESTCASE_AUTO(TestUCollatorPredicateTypes);
     TESTCASE_AUTO(TestCollatorMap);
+    TESTCASE_AUTO(TestSortKeys);
+    TESTCASE_AUTO(TestSortStrings);
+    TESTCASE_AUTO(TestFastLatinGreekCyrillic);
+    TESTCASE_AUTO(TestSortKeyPrefix);
+    TESTCASE_AUTO(TestRulesCache);
+    TESTCASE_AUTO(TestKeywordPrototypes);
     TESTCASE_AUTO_END;
 }
 
@@ -2122,4 +2146,764 @@ void CollationTest::TestCollatorMap() {
     assertEquals(R"(u16m["a"])", 2, um[u"a"]);
 }
 
+void CollationTest::TestSortKeys() {
+    IcuTestErrorCode errorCode(*this, "TestSortKeys");
+    setRootCollator(errorCode);
+    if(errorCode.isFailure()) {
+        errorCode.reset();
+        return;
+    }
+    const RuleBasedCollator *rbc = dynamic_cast<const RuleBasedCollator *>(coll);
+    if(rbc == nullptr) {
+        errln("the root collator is not a RuleBasedCollator");
+        return;
+    }
+    UnicodeString longString;
+    for(int32_t i = 0; i < 100; ++i) {
+        longString.append(u"A\u00e4\u0300 ");
+    }
+    const UnicodeString strings[] = {
+        u"abc", u"", u"ABC", u"a\u0327\u0301b",  // not FCD
+        u"\u0e40\u0e01\u0e32", u"\u4e00\u4e8c", u"a12b", u"a 3-c",
+        longString, u"\U0001F600\u00c5"
+    };
+    const int32_t count = UPRV_LENGTHOF(strings);
+    const char16_t *sources[count];
+    int32_t lengths[count];
+    std::string utf8Strings[count];
+    const char *utf8Sources[count];
+    for(int32_t i = 0; i < count; ++i) {
+        sources[i] = strings[i].getBuffer();
+        lengths[i] = strings[i].length();
+        strings[i].toUTF8String(utf8Strings[i]);
+        utf8Sources[i] = utf8Strings[i].c_str();
+    }
+    static const struct {
+        UColAttribute attr;
+        UColAttributeValue value;
+    } settings[] = {
+        { UCOL_STRENGTH, UCOL_TERTIARY },
+        { UCOL_NORMALIZATION_MODE, UCOL_ON },
+        { UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED },
+        { UCOL_STRENGTH, UCOL_QUATERNARY },
+        { UCOL_CASE_LEVEL, UCOL_ON },
+        { UCOL_NUMERIC_COLLATION, UCOL_ON },
+        { UCOL_STRENGTH, UCOL_IDENTICAL }
+    };
+    for(const auto &setting : settings) {
+        coll->setAttribute(setting.attr, setting.value, errorCode);
+        // Expected: the concatenated single sort keys.
+        std::string expected;
+        int32_t expectedOffsets[count + 1];
+        for(int32_t i = 0; i < count; ++i) {
+            expectedOffsets[i] = static_cast<int32_t>(expected.length());
+            int32_t keyLength = coll->getSortKey(strings[i], nullptr, 0);
+            std::string key(keyLength, '\0');
+            coll->getSortKey(strings[i], reinterpret_cast<uint8_t *>(key.data()), keyLength);
+            expected.append(key);
+        }
+        expectedOffsets[count] = static_cast<int32_t>(expected.length());
+        int32_t expectedLength = expectedOffsets[count];
+
+        // Preflight, then fill.
+        int32_t offsets[count + 1];
+        int32_t length = rbc->getSortKeys(sources, lengths, count, nullptr, 0, offsets, errorCode);
+        assertEquals("getSortKeys() preflighting error", U_BUFFER_OVERFLOW_ERROR, errorCode.reset());
+        assertEquals("getSortKeys() preflighting length", expectedLength, length);
+        assertEquals("getSortKeys() preflighting offsets[1]", expectedOffsets[1], offsets[1]);
+        LocalMemory<uint8_t> keys(static_cast<uint8_t *>(uprv_malloc(length)));
+        length = rbc->getSortKeys(sources, lengths, count, keys.getAlias(), length, offsets, errorCode);
+        if(errorCode.errIfFailureAndReset("getSortKeys()")) { return; }
+        assertTrue("getSortKeys() == single sort keys",
+                   length == expectedLength &&
+                   uprv_memcmp(keys.getAlias(), expected.data(), length) == 0 &&
+                   uprv_memcmp(offsets, expectedOffsets, sizeof(offsets)) == 0);
+
+        // NUL-terminated UTF-8 via the C API, into a buffer that is too short.
+        uprv_memset(keys.getAlias(), 0, length);
+        length = ucol_getSortKeysUTF8(coll->toUCollator(), utf8Sources, nullptr, count,
+                                      keys.getAlias(), expectedLength - 1, offsets, errorCode);
+        assertEquals("ucol_getSortKeysUTF8() short buffer error", U_BUFFER_OVERFLOW_ERROR, errorCode.reset());
+        assertEquals("ucol_getSortKeysUTF8() short buffer length", expectedLength, length);
+        length = ucol_getSortKeysUTF8(coll->toUCollator(), utf8Sources, nullptr, count,
+                                      keys.getAlias(), expectedLength, offsets, errorCode);
+        if(errorCode.errIfFailureAndReset("ucol_getSortKeysUTF8()")) { return; }
+        assertTrue("ucol_getSortKeysUTF8() == single sort keys",
+                   length == expectedLength &&
+                   uprv_memcmp(keys.getAlias(), expected.data(), length) == 0 &&
+                   uprv_memcmp(offsets, expectedOffsets, sizeof(offsets)) == 0);
+    }
+
+    // Ill-formed UTF-8 sorts like U+FFFD.
+    const char *illegal[] = { "a\x80z", "a\xed\xa0\x80z" };
+    const char *fffd[] = { "a\xef\xbf\xbdz", "a\xef\xbf\xbd\xef\xbf\xbd\xef\xbf\xbdz" };
+    uint8_t keys1[100], keys2[100];
+    int32_t length1 = rbc->getSortKeysUTF8(illegal, nullptr, 2, keys1, UPRV_LENGTHOF(keys1), nullptr, errorCode);
+    int32_t length2 = rbc->getSortKeysUTF8(fffd, nullptr, 2, keys2, UPRV_LENGTHOF(keys2), nullptr, errorCode);
+    if(errorCode.errIfFailureAndReset("getSortKeysUTF8(ill-formed)")) { return; }
+    assertTrue("getSortKeysUTF8(ill-formed) == U+FFFD",
+               length1 == length2 && uprv_memcmp(keys1, keys2, length1) == 0);
+
+    rbc->getSortKeys(nullptr, nullptr, 1, nullptr, 0, nullptr, errorCode);
+    assertEquals("getSortKeys(sources=nullptr)", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
+namespace {
+
+// Task runners for ucol_sortStrings().
+// The context counts the tasks that were run.
+
+void U_CALLCONV runTasksOnThreads(const void *context, int32_t numTasks,
+                                  UCollTask *task, void *taskContext) {
+    std::vector<std::thread> threads;
+    for(int32_t i = 1; i < numTasks; ++i) {
+        threads.emplace_back(task, taskContext, i);
+    }
+    task(taskContext, 0);
+    for(std::thread &t : threads) { t.join(); }
+    *static_cast<int32_t *>(const_cast<void *>(context)) += numTasks;
+}
+
+void U_CALLCONV runTasksBackward(const void *context, int32_t numTasks,
+                                 UCollTask *task, void *taskContext) {
+    for(int32_t i = numTasks - 1; i >= 0; --i) {
+        task(taskContext, i);
+    }
+    *static_cast<int32_t *>(const_cast<void *>(context)) += numTasks;
+}
+
+}  // namespace
+
+void CollationTest::TestSortStrings() {
+    IcuTestErrorCode errorCode(*this, "TestSortStrings");
+    setRootCollator(errorCode);
+    if(errorCode.isFailure()) {
+        errorCode.reset();
+        return;
+    }
+    // Enough strings for several tasks, with many duplicates,
+    // long shared prefixes, and strings that differ only in case or accents.
+    static const char16_t *const pieces[] = {
+        u"a", u"A", u"\u00e4", u"b", u"-", u" ", u"\u0436", u"1", u"\u4e00"
+    };
+    const int32_t count = 20000;
+    LocalArray<UnicodeString> strings(new UnicodeString[count]);
+    LocalMemory<const char16_t *> sources(static_cast<const char16_t **>(uprv_malloc(count * sizeof(const char16_t *))));
+    LocalMemory<int32_t> lengths(static_cast<int32_t *>(uprv_malloc(count * sizeof(int32_t))));
+    uint32_t seed = 1;
+    for(int32_t i = 0; i < count; ++i) {
+        if((i % 3) == 0) { strings[i] = u"prefix shared by many strings "; }
+        int32_t length = 1 + i % 7;
+        for(int32_t j = 0; j < length; ++j) {
+            seed = seed * 1103515245 + 12345;
+            strings[i].append(pieces[(seed >> 16) % UPRV_LENGTHOF(pieces)]);
+        }
+        sources[i] = strings[i].getTerminatedBuffer();
+        lengths[i] = (i & 1) ? strings[i].length() : -1;
+    }
+    std::vector<int32_t> expected(count);
+    for(int32_t i = 0; i < count; ++i) { expected[i] = i; }
+    std::stable_sort(expected.begin(), expected.end(), [&](int32_t a, int32_t b) {
+        UErrorCode ec = U_ZERO_ERROR;
+        return coll->compare(strings[a], strings[b], ec) == UCOL_LESS;
+    });
+
+    std::vector<int32_t> order(count);
+    static const struct {
+        const char *name;
+        UCollTaskRunner *runTasks;
+        int32_t numThreads;
+        // Sorting the chunks is one call of the runner with numThreads tasks,
+        // then merging them is one call per merge round with more than one pair.
+        int32_t expectedNumTasks;
+    } runners[] = {
+        { "calling thread", nullptr, 4, 0 },
+        { "one task", runTasksOnThreads, 1, 0 },
+        { "threads", runTasksOnThreads, 4, 4 + 2 },
+        { "backward", runTasksBackward, 3, 3 }
+    };
+    for(const auto &runner : runners) {
+        int32_t numTasks = 0;
+        ucol_sortStrings(coll->toUCollator(), sources.getAlias(), lengths.getAlias(), count,
+                         true, runner.numThreads, runner.runTasks, &numTasks,
+                         order.data(), errorCode);
+        if(errorCode.errIfFailureAndReset("ucol_sortStrings(stable)")) { return; }
+        assertTrue(UnicodeString("stable sort with runner ") + runner.name, order == expected);
+        assertEquals(UnicodeString("tasks run by ") + runner.name, runner.expectedNumTasks, numTasks);
+
+        ucol_sortStrings(coll->toUCollator(), sources.getAlias(), nullptr, count,
+                         false, runner.numThreads, runner.runTasks, &numTasks,
+                         order.data(), errorCode);
+        if(errorCode.errIfFailureAndReset("ucol_sortStrings(unstable)")) { return; }
+        std::vector<bool> seen(count);
+        UBool isSorted = true;
+        for(int32_t i = 0; i < count; ++i) {
+            int32_t index = order[i];
+            if(index < 0 || count <= index || seen[index]) {
+                isSorted = false;
+                break;
+            }
+            seen[index] = true;
+            if(i > 0 &&
+                    coll->compare(strings[order[i - 1]], strings[index], errorCode) == UCOL_GREATER) {
+                isSorted = false;
+                break;
+            }
+        }
+        assertTrue(UnicodeString("unstable sort with runner ") + runner.name, isSorted);
+    }
+
+    ucol_sortStrings(coll->toUCollator(), nullptr, nullptr, 1, true, 1, nullptr, nullptr,
+                     order.data(), errorCode);
+    assertEquals("ucol_sortStrings(strings=nullptr)", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
+void CollationTest::TestFastLatinGreekCyrillic() {
+    IcuTestErrorCode errorCode(*this, "TestFastLatinGreekCyrillic");
+    // The Latin fastpath also handles basic Greek and Cyrillic letters,
+    // with script reordering. Its results must match the sort key order.
+    static const char16_t *const pieces[] = {
+        u"a", u"A", u"ä", u"z", u"1", u"9", u" ", u"-", u"’",
+        u"α", u"Α", u"ά", u"σ", u"ς", u"Ω", u"ϊ", u"ΐ",
+        u"а", u"А", u"ё", u"Ё", u"й", u"ж", u"і", u"ї",
+        u"ў", u"́", u"Ѡ"
+    };
+    static const char *const locales[] = { "root", "ru", "uk", "sr", "el", "da" };
+    static const char16_t *const rules[] = {
+        u"[reorder Grek Cyrl Latn]", u"[reorder Cyrl Latn Grek]",
+        u"[reorder Latn digit]", u"[reorder Cyrl digit]", u"[reorder symbol Cyrl punct]",
+        u"&е<ё<<<Ё &ω<ж"
+    };
+    static const UColAttribute attributes[] = {
+        UCOL_ATTRIBUTE_COUNT, UCOL_ALTERNATE_HANDLING, UCOL_CASE_FIRST,
+        UCOL_CASE_LEVEL, UCOL_STRENGTH, UCOL_NUMERIC_COLLATION
+    };
+    static const UColAttributeValue values[] = {
+        UCOL_DEFAULT, UCOL_SHIFTED, UCOL_UPPER_FIRST, UCOL_ON, UCOL_QUATERNARY, UCOL_ON
+    };
+    const int32_t numCollators = UPRV_LENGTHOF(locales) + UPRV_LENGTHOF(rules);
+    for(int32_t c = 0; c < numCollators; ++c) {
+        LocalPointer<Collator> collator;
+        UnicodeString name;
+        if(c < UPRV_LENGTHOF(locales)) {
+            collator.adoptInstead(Collator::createInstance(Locale(locales[c]), errorCode));
+            name = UnicodeString(locales[c], -1, US_INV);
+        } else {
+            name = rules[c - UPRV_LENGTHOF(locales)];
+            collator.adoptInstead(new RuleBasedCollator(name, errorCode));
+        }
+        if(errorCode.errDataIfFailureAndReset("unable to create collator %d", static_cast<int>(c))) {
+            continue;
+        }
+        for(int32_t a = 0; a < UPRV_LENGTHOF(attributes); ++a) {
+            if(attributes[a] != UCOL_ATTRIBUTE_COUNT) {
+                collator->setAttribute(attributes[a], values[a], errorCode);
+            }
+            uint32_t seed = 1;
+            UnicodeString prev;
+            CollationKey prevKey;
+            std::string prev8;
+            for(int32_t i = 0; i < 1000; ++i) {
+                UnicodeString s;
+                int32_t length = 1 + i % 6;
+                for(int32_t j = 0; j < length; ++j) {
+                    seed = seed * 1103515245 + 12345;
+                    s.append(pieces[(seed >> 16) % UPRV_LENGTHOF(pieces)]);
+                }
+                CollationKey key;
+                collator->getCollationKey(s, key, errorCode);
+                std::string s8;
+                s.toUTF8String(s8);
+                if(i > 0) {
+                    UCollationResult expected = prevKey.compareTo(key, errorCode);
+                    UCollationResult result = collator->compare(prev, s, errorCode);
+                    UCollationResult result8 = collator->compareUTF8(prev8, s8, errorCode);
+                    if(result != expected || result8 != expected) {
+                        errln(name + u" attribute " + a + u": compare(" + prev + u", " + s +
+                              u")=" + static_cast<int32_t>(result) +
+                              u" UTF-8=" + static_cast<int32_t>(result8) +
+                              u" but sort keys " + static_cast<int32_t>(expected));
+                        break;
+                    }
+                }
+                prev = s;
+                prevKey = key;
+                prev8 = s8;
+            }
+            if(errorCode.errIfFailureAndReset("collator %d attribute %d", static_cast<int>(c), static_cast<int>(a))) {
+                break;
+            }
+            if(attributes[a] != UCOL_ATTRIBUTE_COUNT) {
+                collator->setAttribute(attributes[a], UCOL_DEFAULT, errorCode);
+            }
+        }
+    }
+
+    // Greek and Cyrillic text must actually take the fast path,
+    // with and without script reordering, rather than bail out to the slow path.
+    const CollationData *rootData = CollationRoot::getData(errorCode);
+    const CollationSettings *rootSettings = CollationRoot::getSettings(errorCode);
+    if(errorCode.errDataIfFailureAndReset("CollationRoot::getData()")) {
+        return;
+    }
+    if(rootData->fastLatinTable == nullptr) {
+        errln("the root collation data has no fast Latin table");
+        return;
+    }
+    static const char16_t *const pairs[][2] = {
+        { u"α", u"β" }, { u"αβγ", u"αβδ" }, { u"Ωμέγα", u"ωμέγα" }, { u"άλφα", u"αλφα" },
+        { u"мир", u"мор" }, { u"ёлка", u"елка" }, { u"Привет", u"привет" }, { u"йод", u"иод" },
+        { u"abc", u"абв" }, { u"αβγ", u"абв" }, { u"abc", u"αβγ" }
+    };
+    static const int32_t reorderings[][3] = {
+        { UCOL_REORDER_CODE_NONE, 0, 0 },
+        { USCRIPT_GREEK, USCRIPT_CYRILLIC, USCRIPT_LATIN },
+        { USCRIPT_CYRILLIC, USCRIPT_LATIN, USCRIPT_GREEK }
+    };
+    LocalPointer<Collator> root(Collator::createInstance(Locale::getRoot(), errorCode));
+    if(errorCode.errDataIfFailureAndReset("Collator::createInstance(root)")) {
+        return;
+    }
+    for(int32_t r = 0; r < UPRV_LENGTHOF(reorderings); ++r) {
+        int32_t length = reorderings[r][0] == UCOL_REORDER_CODE_NONE ? 0 : 3;
+        CollationSettings settings(*rootSettings);
+        settings.setReordering(*rootData, reorderings[r], length, errorCode);
+        root->setReorderCodes(reorderings[r], length, errorCode);
+        uint16_t primaries[CollationFastLatin::PRIMARIES_CAPACITY];
+        int32_t options = CollationFastLatin::getOptions(
+            rootData, settings, primaries, UPRV_LENGTHOF(primaries));
+        if(errorCode.errIfFailureAndReset("setReordering(%d)", static_cast<int>(r))) {
+            continue;
+        }
+        if(options < 0) {
+            errln("reordering %d: the fast path is disabled", static_cast<int>(r));
+            continue;
+        }
+        for(int32_t i = 0; i < UPRV_LENGTHOF(pairs); ++i) {
+            UnicodeString left(pairs[i][0]), right(pairs[i][1]);
+            std::string left8, right8;
+            left.toUTF8String(left8);
+            right.toUTF8String(right8);
+            int32_t result = CollationFastLatin::compareUTF16(
+                rootData->fastLatinTable, primaries, options,
+                left.getBuffer(), left.length(), right.getBuffer(), right.length());
+            int32_t result8 = CollationFastLatin::compareUTF8(
+                rootData->fastLatinTable, primaries, options,
+                reinterpret_cast<const uint8_t *>(left8.data()), static_cast<int32_t>(left8.length()),
+                reinterpret_cast<const uint8_t *>(right8.data()), static_cast<int32_t>(right8.length()));
+            int32_t expected = root->compare(left, right, errorCode);
+            if(result != expected || result8 != expected) {
+                errln(UnicodeString(u"reordering ") + r + u": fast compare(" + left + u", " + right +
+                      u")=" + result + u" UTF-8=" + result8 + u" but expected " + expected +
+                      u" (" + CollationFastLatin::BAIL_OUT_RESULT + u" is the slow path)");
+            }
+        }
+    }
+}
+
+void CollationTest::TestSortKeyPrefix() {
+    IcuTestErrorCode errorCode(*this, "TestSortKeyPrefix");
+    static const char16_t *const strings[] = {
+        u"", u"a", u"ab", u"Ab", u"a-b", u"äbc", u"https://www.example.com/a/b/c?d=e",
+        u"\u00E4\u0327\u0301", u"一二三", u"12345678901234567890", u"\U0001D400bc"
+    };
+    static const UColAttributeValue strengths[] = {
+        UCOL_PRIMARY, UCOL_TERTIARY, UCOL_QUATERNARY, UCOL_IDENTICAL
+    };
+    LocalPointer<Collator> coll(Collator::createInstance(Locale("de"), errorCode));
+    if(errorCode.errDataIfFailureAndReset("Collator::createInstance(de)")) {
+        return;
+    }
+    RuleBasedCollator *rbc = dynamic_cast<RuleBasedCollator *>(coll.getAlias());
+    coll->setAttribute(UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, errorCode);
+    for(int32_t st = 0; st < UPRV_LENGTHOF(strengths); ++st) {
+        coll->setAttribute(UCOL_STRENGTH, strengths[st], errorCode);
+        for(int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+            UnicodeString s(strings[i]);
+            std::string s8;
+            s.toUTF8String(s8);
+            CollationKey key;
+            coll->getCollationKey(s, key, errorCode);
+            int32_t keyLength;
+            const uint8_t *keyBytes = key.getByteArray(keyLength);
+            // The full sort key length bounds the capacities tested below.
+            const int32_t maxCapacity = keyLength + 2;
+            std::vector<uint8_t> expectedBuffer(maxCapacity), prefixBuffer(maxCapacity),
+                                 prefix8Buffer(maxCapacity);
+            uint8_t *expected = expectedBuffer.data();
+            uint8_t *prefix = prefixBuffer.data();
+            uint8_t *prefix8 = prefix8Buffer.data();
+            for(int32_t capacity = 1; capacity <= maxCapacity; ++capacity) {
+                uprv_memset(expected, 0, capacity);
+                uprv_memcpy(expected, keyBytes, keyLength < capacity ? keyLength : capacity);
+                UBool isComplete = false;
+                UBool isComplete8 = false;
+                UBool isCompleteC = false;
+                int32_t length = rbc->getSortKeyPrefix(
+                    s.getBuffer(), s.length(), prefix, capacity, isComplete, errorCode);
+                int32_t length8 = rbc->getSortKeyPrefixUTF8(
+                    s8.data(), -1, prefix8, capacity, isComplete8, errorCode);
+                if(errorCode.errIfFailureAndReset("getSortKeyPrefix(%d, capacity %d)",
+                                                  static_cast<int>(i), static_cast<int>(capacity))) {
+                    continue;
+                }
+                UBool expectedComplete = keyLength <= capacity;
+                int32_t expectedLength = expectedComplete ? keyLength : capacity;
+                if(length != expectedLength || isComplete != expectedComplete ||
+                        uprv_memcmp(prefix, expected, capacity) != 0) {
+                    errln("getSortKeyPrefix(string %d, capacity %d) strength %d: "
+                          "wrong prefix or length %d or complete=%d",
+                          static_cast<int>(i), static_cast<int>(capacity), static_cast<int>(st),
+                          static_cast<int>(length), isComplete);
+                }
+                if(length8 != expectedLength || isComplete8 != expectedComplete ||
+                        uprv_memcmp(prefix8, expected, capacity) != 0) {
+                    errln("getSortKeyPrefixUTF8(string %d, capacity %d) strength %d: "
+                          "wrong prefix or length %d or complete=%d",
+                          static_cast<int>(i), static_cast<int>(capacity), static_cast<int>(st),
+                          static_cast<int>(length8), isComplete8);
+                }
+                int32_t lengthC = ucol_getSortKeyPrefix(coll->toUCollator(), s.getTerminatedBuffer(), -1,
+                                                        prefix, capacity, &isCompleteC, errorCode);
+                if(lengthC != expectedLength || isCompleteC != expectedComplete ||
+                        uprv_memcmp(prefix, expected, capacity) != 0) {
+                    errln("ucol_getSortKeyPrefix(string %d, capacity %d) strength %d: wrong result",
+                          static_cast<int>(i), static_cast<int>(capacity), static_cast<int>(st));
+                }
+            }
+        }
+    }
+    uint8_t prefix[4];
+    UBool isComplete;
+    rbc->getSortKeyPrefix(u"a", 1, prefix, 0, isComplete, errorCode);
+    errorCode.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR, "capacity 0");
+}
+
+#if !UCONFIG_NO_FILE_IO
+
+namespace {
+
+std::string readCacheFile(const std::filesystem::path &path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeCacheFile(const std::filesystem::path &path, const std::string &bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), bytes.length());
+}
+
+}  // namespace
+
+#endif  // !UCONFIG_NO_FILE_IO
+
+void CollationTest::TestRulesCache() {
+    IcuTestErrorCode errorCode(*this, "TestRulesCache");
+    UnicodeString rules(u"# TestRulesCache\n&a<æ<<<Æ &c<ch<<<cH<<<Ch<<<CH &[before 1]d<ö [strength 2]");
+    static const char16_t *const strings[] = {
+        u"a", u"æ", u"Æ", u"b", u"c", u"ch", u"CH", u"ci", u"ö", u"d", u"ö", u"z"
+    };
+    UParseError parseError;
+    LocalUCollatorPointer built(ucol_openRules(
+        rules.getBuffer(), rules.length(), UCOL_DEFAULT, UCOL_DEFAULT, &parseError, errorCode));
+    if(errorCode.errDataIfFailureAndReset("ucol_openRules()")) {
+        return;
+    }
+    // Checks that the collator orders the strings like the collator built from the rules.
+    auto checkLikeBuilt = [&](const UCollator *coll, const char *label) {
+        for(int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+            for(int32_t j = 0; j < UPRV_LENGTHOF(strings); ++j) {
+                UCollationResult expected = ucol_strcoll(built.getAlias(), strings[i], -1, strings[j], -1);
+                UCollationResult actual = ucol_strcoll(coll, strings[i], -1, strings[j], -1);
+                if(actual != expected) {
+                    errln(UnicodeString(label, -1, US_INV) + u": compare(" + strings[i] + u", " +
+                          strings[j] + u")=" + static_cast<int32_t>(actual) + u" but built " +
+                          static_cast<int32_t>(expected));
+                    return;
+                }
+            }
+        }
+    };
+#if !UCONFIG_NO_FILE_IO
+    // Use a new, empty directory for the cache files.
+    std::error_code ec;
+    std::filesystem::path dir;
+    for(int32_t attempt = 0; attempt < 100; ++attempt) {
+        dir = std::filesystem::temp_directory_path(ec) /
+            ("icu_TestRulesCache_" + std::to_string(static_cast<int64_t>(uprv_getUTCtime())) +
+             "_" + std::to_string(attempt));
+        if(!ec && std::filesystem::create_directory(dir, ec)) {
+            break;
+        }
+        dir.clear();
+    }
+    if(dir.empty()) {
+        errln("unable to create a temporary directory for the cache");
+        return;
+    }
+    std::string cacheDir = dir.string();
+    // File name as in collationbuilder.cpp: ICU major version and FNV-1a hash of the rules.
+    uint64_t hash = 0xcbf29ce484222325;
+    for(int32_t i = 0; i < rules.length(); ++i) {
+        hash = (hash ^ rules[i]) * 0x100000001b3;
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "coll%s_%08lx%08lx.col", U_ICU_VERSION_SHORT,
+             static_cast<unsigned long>(hash >> 32), static_cast<unsigned long>(hash & 0xffffffff));
+    std::filesystem::path path = dir / name;
+    auto openCached = [&](UColAttributeValue normalization, UCollationStrength strength) {
+        return ucol_openRulesCached(rules.getBuffer(), rules.length(), normalization, strength,
+                                    cacheDir.c_str(), &parseError, errorCode);
+    };
+
+    // The first open builds the collator and writes the cache file.
+    LocalUCollatorPointer first(openCached(UCOL_DEFAULT, UCOL_DEFAULT));
+    if(errorCode.errIfFailureAndReset("ucol_openRulesCached() to build")) {
+        std::filesystem::remove_all(dir, ec);
+        return;
+    }
+    checkLikeBuilt(first.getAlias(), "first collator");
+    std::string original = readCacheFile(path);
+    if(original.empty()) {
+        errln("ucol_openRulesCached() did not write %s", path.string().c_str());
+        std::filesystem::remove_all(dir, ec);
+        return;
+    }
+    // Only the final file must remain, no temporary files.
+    int32_t numFiles = 0;
+    for(const auto &entry : std::filesystem::directory_iterator(dir, ec)) {
+        (void)entry;
+        ++numFiles;
+    }
+    assertEquals("number of files in the cache directory", 1, numFiles);
+
+    // The cache file format: a 32-byte DataHeader,
+    // then int32_t indexes[] which include the tailoring offset, length & checksum.
+    const int32_t headerSize = 32;
+    int32_t indexes[5];
+    uprv_memcpy(indexes, original.data() + headerSize, sizeof(indexes));
+    int32_t tailoringStart = headerSize + indexes[2];
+    assertEquals("cache file length", static_cast<int64_t>(tailoringStart + indexes[3]),
+                 static_cast<int64_t>(original.length()));
+    // Checksum as in collationbuilder.cpp: FNV-1a hash of the tailoring bytes.
+    auto checksum = [](const std::string &bytes, int32_t start) {
+        uint32_t hash = 0x811c9dc5;
+        for(size_t i = start; i < bytes.length(); ++i) {
+            hash = (hash ^ static_cast<uint8_t>(bytes[i])) * 0x01000193;
+        }
+        return static_cast<int32_t>(hash);
+    };
+    assertEquals("cache file checksum", checksum(original, tailoringStart), indexes[4]);
+
+    // The second open must load the cached tailoring rather than build a new one.
+    // Replace the cached tailoring with one for different rules, so that a cache hit
+    // is observable: "b" then sorts before "a".
+    UnicodeString otherRules(u"&b<a");
+    LocalUCollatorPointer other(ucol_openRules(
+        otherRules.getBuffer(), otherRules.length(), UCOL_DEFAULT, UCOL_DEFAULT, &parseError, errorCode));
+    int32_t otherLength = ucol_cloneBinary(other.getAlias(), nullptr, 0, errorCode);
+    errorCode.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR, "ucol_cloneBinary(preflight)");
+    std::string otherBinary(otherLength, '\0');
+    ucol_cloneBinary(other.getAlias(), reinterpret_cast<uint8_t *>(otherBinary.data()),
+                     otherLength, errorCode);
+    std::string forged = original.substr(0, tailoringStart) + otherBinary;
+    int32_t forgedLength = otherLength;
+    uprv_memcpy(forged.data() + headerSize + 3 * 4, &forgedLength, 4);
+    int32_t forgedChecksum = checksum(forged, tailoringStart);
+    uprv_memcpy(forged.data() + headerSize + 4 * 4, &forgedChecksum, 4);
+    writeCacheFile(path, forged);
+    LocalUCollatorPointer hit(openCached(UCOL_DEFAULT, UCOL_DEFAULT));
+    if(errorCode.errIfFailureAndReset("ucol_openRulesCached() from the cache")) {
+        std::filesystem::remove_all(dir, ec);
+        return;
+    }
+    assertEquals("cache hit: compare(b, a)", UCOL_LESS,
+                 ucol_strcoll(hit.getAlias(), u"b", -1, u"a", -1));
+    int32_t length;
+    const char16_t *cachedRules = ucol_getRules(hit.getAlias(), &length);
+    if(rules != UnicodeString(false, cachedRules, length)) {
+        errln("ucol_getRules() of the cached collator differs from the input rules");
+    }
+    if(readCacheFile(path) != forged) {
+        errln("a cache hit rewrote the cache file");
+    }
+
+    // A cache hit with the real tailoring behaves like the built collator,
+    // with the attributes applied on top of the cached data.
+    writeCacheFile(path, original);
+    LocalUCollatorPointer cached(openCached(UCOL_DEFAULT, UCOL_DEFAULT));
+    LocalUCollatorPointer cachedTertiary(openCached(UCOL_ON, UCOL_TERTIARY));
+    if(errorCode.errIfFailureAndReset("ucol_openRulesCached() from the cache")) {
+        std::filesystem::remove_all(dir, ec);
+        return;
+    }
+    checkLikeBuilt(cached.getAlias(), "cached collator");
+    if(ucol_getStrength(cached.getAlias()) != UCOL_SECONDARY ||
+            ucol_getStrength(cachedTertiary.getAlias()) != UCOL_TERTIARY ||
+            ucol_getAttribute(cachedTertiary.getAlias(), UCOL_NORMALIZATION_MODE, errorCode) != UCOL_ON) {
+        errln("cached collators have the wrong attributes");
+    }
+
+    // Stale, truncated and corrupt files are cache misses:
+    // The collator is built from the rules, and the file is rewritten.
+    std::string staleVersion = original;
+    staleVersion[offsetof(DataHeader, info) + offsetof(UDataInfo, dataVersion)] ^= 1;
+    std::string staleRules = original;
+    staleRules[headerSize + 5 * 4] ^= 1;  // first rules code unit
+    std::string truncatedRules = original.substr(0, headerSize + 5 * 4 + 2);
+    std::string truncatedTailoring = original.substr(0, tailoringStart + indexes[3] / 2);
+    std::string truncatedHeader = original.substr(0, headerSize + 8);
+    std::string badOffset = original;
+    int32_t huge = 0x7ffffff0;
+    uprv_memcpy(badOffset.data() + headerSize + 2 * 4, &huge, 4);
+    std::string badLength = original;
+    uprv_memcpy(badLength.data() + headerSize + 3 * 4, &huge, 4);
+    std::string badIndexesLength = original;
+    uprv_memcpy(badIndexesLength.data() + headerSize, &huge, 4);
+    std::string damagedTailoring = original;
+    damagedTailoring[tailoringStart + indexes[3] / 2] ^= 1;
+    std::string garbage(original.length(), '\x5a');
+    const struct {
+        const char *label;
+        const std::string &bytes;
+    } misses[] = {
+        { "stale ICU version", staleVersion },
+        { "different rules", staleRules },
+        { "truncated in the rules", truncatedRules },
+        { "truncated in the tailoring", truncatedTailoring },
+        { "tailoring checksum mismatch", damagedTailoring },
+        { "truncated in the indexes", truncatedHeader },
+        { "tailoring offset out of bounds", badOffset },
+        { "tailoring length out of bounds", badLength },
+        { "indexes length out of bounds", badIndexesLength },
+        { "not a data file", garbage }
+    };
+    for(const auto &miss : misses) {
+        writeCacheFile(path, miss.bytes);
+        LocalUCollatorPointer rebuilt(openCached(UCOL_DEFAULT, UCOL_DEFAULT));
+        if(errorCode.errIfFailureAndReset("ucol_openRulesCached(%s)", miss.label)) {
+            continue;
+        }
+        checkLikeBuilt(rebuilt.getAlias(), miss.label);
+        if(readCacheFile(path) != original) {
+            errln("ucol_openRulesCached(%s) did not rewrite the cache file", miss.label);
+        }
+    }
+#else
+    LocalUCollatorPointer cached(ucol_openRulesCached(
+        rules.getBuffer(), rules.length(), UCOL_DEFAULT, UCOL_DEFAULT, ".",
+        &parseError, errorCode));
+    if(errorCode.errIfFailureAndReset("ucol_openRulesCached() without file I/O")) {
+        return;
+    }
+    checkLikeBuilt(cached.getAlias(), "collator without file I/O");
+    std::string cacheDir(".");
+#endif  // !UCONFIG_NO_FILE_IO
+    // Syntax errors are reported as by ucol_openRules(), and nothing is cached.
+    UnicodeString badRules(u"&a<<<<<<b");
+    LocalUCollatorPointer bad(ucol_openRulesCached(
+        badRules.getBuffer(), badRules.length(), UCOL_DEFAULT, UCOL_DEFAULT, cacheDir.c_str(),
+        &parseError, errorCode));
+    if(errorCode.isSuccess() || bad.isValid()) {
+        errln("ucol_openRulesCached(bad rules) did not fail");
+    }
+    errorCode.reset();
+#if !UCONFIG_NO_FILE_IO
+    numFiles = 0;
+    for(const auto &entry : std::filesystem::directory_iterator(dir, ec)) {
+        (void)entry;
+        ++numFiles;
+    }
+    assertEquals("number of files after the bad rules", 1, numFiles);
+    std::filesystem::remove_all(dir, ec);
+#endif
+}
+
+void CollationTest::TestKeywordPrototypes() {
+    IcuTestErrorCode errorCode(*this, "TestKeywordPrototypes");
+    // Collators with locale keywords are clones of cached prototypes.
+    // Each clone must have the keyword attributes and be independent of the others.
+    Locale locale("de@collation=phonebook;colNumeric=yes;colStrength=primary");
+    LocalPointer<Collator> first(Collator::createInstance(locale, errorCode));
+    if(errorCode.errDataIfFailureAndReset("Collator::createInstance(%s)", locale.getName())) {
+        return;
+    }
+    LocalPointer<Collator> second(Collator::createInstance(locale, errorCode));
+    errorCode.errIfFailureAndReset("Collator::createInstance(%s) again", locale.getName());
+    if(first.getAlias() == second.getAlias() ||
+            first->getAttribute(UCOL_NUMERIC_COLLATION, errorCode) != UCOL_ON ||
+            second->getAttribute(UCOL_STRENGTH, errorCode) != UCOL_PRIMARY) {
+        errln("Collator::createInstance(%s) did not apply the keyword attributes", locale.getName());
+    }
+    first->setAttribute(UCOL_NUMERIC_COLLATION, UCOL_OFF, errorCode);
+    first->setStrength(Collator::TERTIARY);
+    LocalPointer<Collator> third(Collator::createInstance(locale, errorCode));
+    errorCode.errIfFailureAndReset("Collator::createInstance(%s) after setAttribute()", locale.getName());
+    if(first->compare(u"a10", u"a9", errorCode) != UCOL_LESS ||
+            second->compare(u"a10", u"a9", errorCode) != UCOL_GREATER ||
+            third->compare(u"a10", u"a9", errorCode) != UCOL_GREATER ||
+            third->compare(u"ae", u"Ä", errorCode) != UCOL_EQUAL) {
+        errln("setAttribute() on one clone affected other clones");
+    }
+    errorCode.errIfFailureAndReset("compare()");
+    // Errors from keyword values are reported for every instance.
+    for(int32_t i = 0; i < 2; ++i) {
+        LocalPointer<Collator> bad(Collator::createInstance(Locale("de@colNumeric=maybe"), errorCode));
+        if(errorCode.get() != U_ILLEGAL_ARGUMENT_ERROR || bad.isValid()) {
+            errln("Collator::createInstance(de@colNumeric=maybe) #%d did not fail: %s",
+                  static_cast<int>(i), errorCode.errorName());
+        }
+        errorCode.reset();
+    }
+
+    // When the prototype table is full, a new locale ID replaces the least recently used one.
+    int32_t numLocales;
+    const Locale *locales = Collator::getAvailableLocales(numLocales);
+    const int32_t numIDs = UCOL_MAX_KEYWORD_PROTOTYPES + 2;
+    if(numLocales < numIDs) {
+        errln("too few available collation locales: %d", static_cast<int>(numLocales));
+        return;
+    }
+    std::vector<std::string> ids;
+    for(int32_t i = 0; i < numIDs; ++i) {
+        // The prototypes are keyed by the full, canonical locale ID.
+        std::string id = std::string(locales[i].getName()) + "@colNumeric=yes";
+        ids.push_back(Locale(id.c_str()).getName());
+    }
+    // Create collators for all of the IDs, and use the first one again after each other one.
+    for(int32_t i = 0; i < numIDs; ++i) {
+        for(int32_t j : { i, 0 }) {
+            LocalPointer<Collator> coll(Collator::createInstance(Locale(ids[j].c_str()), errorCode));
+            if(errorCode.errIfFailureAndReset("Collator::createInstance(%s)", ids[j].c_str())) {
+                return;
+            }
+            if(coll->getAttribute(UCOL_NUMERIC_COLLATION, errorCode) != UCOL_ON) {
+                errln("Collator::createInstance(%s) did not set colNumeric", ids[j].c_str());
+            }
+            if(i == 0 && !hasCollatorKeywordPrototype(ids[0].c_str())) {
+                // Collators are not cached once a test has registered a collator service.
+                logln("no keyword prototypes while a collator service is registered");
+                return;
+            }
+        }
+    }
+    // The two least recently used ones were replaced.
+    int32_t numCached = 0;
+    for(int32_t i = 0; i < numIDs; ++i) {
+        UBool expected = i != 1 && i != 2;
+        UBool isCached = hasCollatorKeywordPrototype(ids[i].c_str());
+        if(isCached != expected) {
+            errln("hasCollatorKeywordPrototype(%s)=%d but expected %d",
+                  ids[i].c_str(), isCached, expected);
+        }
+        numCached += isCached;
+    }
+    assertEquals("number of cached prototypes", UCOL_MAX_KEYWORD_PROTOTYPES, numCached);
+    // A replaced prototype is created and cached again.
+    LocalPointer<Collator> again(Collator::createInstance(Locale(ids[1].c_str()), errorCode));
+    errorCode.errIfFailureAndReset("Collator::createInstance(%s) again", ids[1].c_str());
+    assertTrue("prototype cached again after it was replaced", hasCollatorKeywordPrototype(ids[1].c_str()));
+    assertFalse("least recently used prototype replaced", hasCollatorKeywordPrototype(ids[3].c_str()));
+}
+
 #endif  // !UCONFIG_NO_COLLATION
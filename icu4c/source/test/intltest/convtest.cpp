@@ -18,6 +18,8 @@
 *   Test file for data-driven conversion tests.
 */
 
+#include <string>
+
 #include "unicode/utypes.h"
 
 #if !UCONFIG_NO_LEGACY_CONVERSION
@@ -31,6 +33,8 @@
  * not testing conversion for a custom configuration like this should be ok.
  */
 
+#include "unicode/bytestream.h"
+#include "unicode/transcoder.h"
 #include "unicode/ucnv.h"
 #include "unicode/unistr.h"
 #include "unicode/parsepos.h"
@@ -79,6 +83,7 @@ ConversionTest::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
     TESTCASE_AUTO(TestDefaultIgnorableCallback);
     TESTCASE_AUTO(TestUTF8ToUTF8Overflow);
     TESTCASE_AUTO(TestUTF8ToUTF8Streaming);
+    TESTCASE_AUTO(TestTranscoder);
     TESTCASE_AUTO_END;
 }
 
@@ -898,6 +903,143 @@ ConversionTest::TestUTF8ToUTF8Streaming() {
     assertSuccess("UTF-8->UTF-8", errorCode);
 }
 
+namespace {
+
+// Byte ring buffer as an I/O loop would use it, for TestTranscoder().
+class TestRingBuffer {
+public:
+    TestRingBuffer(char *buffer, int32_t capacity) : buffer(buffer), capacity(capacity) {}
+    int32_t length() const { return len; }
+    // contiguous readable bytes
+    char *readStart() { return buffer + start; }
+    int32_t readLength() const { return capacity - start < len ? capacity - start : len; }
+    void consume(int32_t n) { start = (start + n) % capacity; len -= n; }
+    // contiguous writable space
+    char *writeStart() { return buffer + (start + len) % capacity; }
+    int32_t writeLength() const {
+        int32_t end = (start + len) % capacity;
+        return len == capacity ? 0 : end >= start ? capacity - end : start - end;
+    }
+    void produce(int32_t n) { len += n; }
+
+private:
+    char *buffer;
+    int32_t capacity;
+    int32_t start = 0;
+    int32_t len = 0;
+};
+
+std::string convertAll(const char *toName, const char *fromName, const std::string &s, UErrorCode &errorCode) {
+    char buffer[200];
+    int32_t length = ucnv_convert(toName, fromName, buffer, UPRV_LENGTHOF(buffer),
+                                  s.data(), static_cast<int32_t>(s.length()), &errorCode);
+    return U_SUCCESS(errorCode) ? std::string(buffer, length) : std::string();
+}
+
+}  // namespace
+
+void
+ConversionTest::TestTranscoder() {
+    IcuTestErrorCode errorCode(*this, "TestTranscoder");
+    const std::string text(
+        "Hello \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e text "
+        "\xe3\x83\x86\xe3\x82\xad\xe3\x82\xb9\xe3\x83\x88.\r\n");
+
+    // UTF-8 to Shift_JIS through small caller-owned ring buffers,
+    // with wrap-around and an output consumer slower than the transcoder.
+    {
+        std::string expected = convertAll("Shift_JIS", "UTF-8", text, errorCode);
+        Transcoder transcoder("UTF-8", "Shift_JIS", errorCode);
+        char inBuffer[7], outBuffer[5];
+        TestRingBuffer in(inBuffer, UPRV_LENGTHOF(inBuffer)), out(outBuffer, UPRV_LENGTHOF(outBuffer));
+        const char *p = text.data(), *pLimit = p + text.length();
+        std::string result;
+        UBool done = false;
+        for (int32_t i = 0; i < 1000 && !(done && out.length() == 0) && errorCode.isSuccess(); ++i) {
+            while (p < pLimit && in.writeLength() > 0) {
+                int32_t n = in.writeLength() < pLimit - p ? in.writeLength() : static_cast<int32_t>(pLimit - p);
+                uprv_memcpy(in.writeStart(), p, n);
+                in.produce(n);
+                p += n;
+            }
+            const char *sourceStart = in.readStart(), *source = sourceStart;
+            char *targetStart = out.writeStart(), *target = targetStart;
+            UBool flush = p == pLimit && in.readLength() == in.length();
+            UBool more = transcoder.transcode(source, source + in.readLength(),
+                                              target, target + out.writeLength(),
+                                              flush, errorCode);
+            in.consume(static_cast<int32_t>(source - sourceStart));
+            out.produce(static_cast<int32_t>(target - targetStart));
+            done = flush && !more;
+            for (int32_t n = 0; n < 3 && out.length() > 0; ++n) {
+                result.push_back(*out.readStart());
+                out.consume(1);
+            }
+        }
+        assertTrue("ring buffers: done", done);
+        assertTrue("ring buffers: same as ucnv_convert()", result == expected);
+        assertEquals("ring buffers: bytes consumed",
+                     static_cast<int64_t>(text.length()), transcoder.getSourceBytesConsumed());
+        assertEquals("ring buffers: bytes produced",
+                     static_cast<int64_t>(expected.length()), transcoder.getTargetBytesProduced());
+    }
+
+    // UTF-16BE to stateful ISO-2022-JP into a ByteSink,
+    // with input chunks that split code units.
+    {
+        std::string utf16 = convertAll("UTF-16BE", "UTF-8", text, errorCode);
+        std::string expected = convertAll("ISO-2022-JP", "UTF-16BE", utf16, errorCode);
+        Transcoder transcoder("UTF-16BE", "ISO-2022-JP", errorCode);
+        std::string result;
+        StringByteSink<std::string> sink(&result);
+        for (size_t start = 0; start < utf16.length(); start += 5) {
+            size_t length = utf16.length() - start < 5 ? utf16.length() - start : 5;
+            transcoder.transcode(StringPiece(utf16.data() + start, static_cast<int32_t>(length)), sink,
+                                 start + length == utf16.length(), errorCode);
+        }
+        assertTrue("ByteSink: same as ucnv_convert()", result == expected);
+        assertEquals("ByteSink: ends in ASCII", "\x1b(B.\r\n", result.substr(result.length() - 6).c_str());
+    }
+
+    // Back-pressure, and no NUL termination.
+    {
+        Transcoder transcoder("UTF-8", "UTF-16LE", errorCode);
+        const char *source = "abc";
+        char buffer[8];
+        uprv_memset(buffer, 'x', sizeof(buffer));
+        char *target = buffer;
+        assertTrue("target full", transcoder.transcode(source, source + 3, target, buffer + 4, true, errorCode));
+        assertEquals("first output length", 4, static_cast<int32_t>(target - buffer));
+        assertTrue("more output", !transcoder.transcode(source, source, target, buffer + 8, true, errorCode));
+        assertEquals("output length", 6, static_cast<int32_t>(target - buffer));
+        assertTrue("output", uprv_memcmp(buffer, "a\0b\0c\0xx", 8) == 0);
+    }
+
+    // Conversion errors and converter callbacks.
+    {
+        Transcoder transcoder("UTF-8", "US-ASCII", errorCode);
+        ucnv_setFromUCallBack(transcoder.getTargetConverter(), UCNV_FROM_U_CALLBACK_STOP,
+                              nullptr, nullptr, nullptr, errorCode);
+        const char *source = "a\xc3\xa9";
+        char buffer[8];
+        char *target = buffer;
+        transcoder.transcode(source, source + 3, target, buffer + 8, true, errorCode);
+        errorCode.expectErrorAndReset(U_INVALID_CHAR_FOUND);
+        assertEquals("output before the error", 1, static_cast<int32_t>(target - buffer));
+        transcoder.reset();
+        assertEquals("reset bytes consumed", static_cast<int64_t>(0), transcoder.getSourceBytesConsumed());
+    }
+    {
+        Transcoder transcoder("UTF-8", "no-such-charset", errorCode);
+        errorCode.expectErrorAndReset(U_FILE_ACCESS_ERROR);
+        const char *source = "a";
+        char buffer[8];
+        char *target = buffer;
+        transcoder.transcode(source, source + 1, target, buffer + 8, true, errorCode);
+        errorCode.expectErrorAndReset(U_INVALID_STATE_ERROR);
+    }
+}
+
 // open testdata or ICU data converter ------------------------------------- ***
 
 UConverter *
@@ -1194,6 +1336,119 @@ stepToUnicode(ConversionCase &cc, UConverter *cnv,
     return static_cast<int32_t>(target - result);
 }
 
+static int32_t
+stepToUTF8(ConversionCase &cc,
+           UConverter *cnv, UConverter *utf8Cnv,
+           char16_t *result, int32_t resultCapacity,
+           int32_t step,
+           UErrorCode *pErrorCode) {
+    const char *source, *sourceLimit, *bytesLimit;
+    char16_t pivotBuffer[32];
+    char16_t *pivotSource, *pivotTarget, *pivotLimit;
+    char utf8[3*256];
+    char *target, *targetLimit, *utf8Limit;
+    UBool flush;
+
+    source = reinterpret_cast<const char*>(cc.bytes);
+    pivotSource=pivotTarget=pivotBuffer;
+    target=utf8;
+    bytesLimit=source+cc.bytesLength;
+    utf8Limit=utf8+UPRV_LENGTHOF(utf8);
+
+    // call ucnv_convertEx() with in/out buffers no larger than (step) at a time
+    // move only one buffer (in vs. out) at a time to be extra mean
+    // step==0 performs bulk conversion
+
+    // initialize the partial limits for the loop
+    if(step==0) {
+        // use the entire buffers
+        sourceLimit=bytesLimit;
+        targetLimit=utf8Limit;
+        flush=cc.finalFlush;
+
+        pivotLimit=pivotBuffer+UPRV_LENGTHOF(pivotBuffer);
+    } else {
+        // start with empty partial buffers
+        sourceLimit=source;
+        targetLimit=target;
+        flush=false;
+
+        // empty pivot is not allowed, make it of length step
+        pivotLimit=pivotBuffer+step;
+    }
+
+    for(;;) {
+        // resetting the opposite conversion direction must not affect this one
+        ucnv_resetToUnicode(utf8Cnv);
+        ucnv_resetFromUnicode(cnv);
+
+        // convert
+        ucnv_convertEx(utf8Cnv, cnv,
+            &target, targetLimit,
+            &source, sourceLimit,
+            pivotBuffer, &pivotSource, &pivotTarget, pivotLimit,
+            false, flush, pErrorCode);
+
+        // check pointers and errors
+        if(source>sourceLimit || target>targetLimit) {
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+            break;
+        } else if(*pErrorCode==U_BUFFER_OVERFLOW_ERROR) {
+            if(target!=targetLimit) {
+                // buffer overflow must only be set when the target is filled
+                *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+                break;
+            } else if(targetLimit==utf8Limit) {
+                // not just a partial overflow
+                break;
+            }
+
+            // the partial target is filled, set a new limit, reset the error and continue
+            targetLimit=(utf8Limit-target)>=step ? target+step : utf8Limit;
+            *pErrorCode=U_ZERO_ERROR;
+        } else if(U_FAILURE(*pErrorCode)) {
+            // toUnicode error, done
+            break;
+        } else {
+            if(source!=sourceLimit) {
+                // when no error occurs, then the input must be consumed
+                *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+                break;
+            }
+
+            if(sourceLimit==bytesLimit) {
+                // we are done
+                if(*pErrorCode==U_STRING_NOT_TERMINATED_WARNING) {
+                    // ucnv_convertEx() warns about not terminating the output
+                    // but ucnv_toUnicode() does not and so
+                    // checkToUnicode() does not expect it
+                    *pErrorCode=U_ZERO_ERROR;
+                }
+                break;
+            }
+
+            // the partial conversion succeeded, set a new limit and continue
+            sourceLimit=(bytesLimit-source)>=step ? source+step : bytesLimit;
+            flush = static_cast<UBool>(cc.finalFlush && sourceLimit == bytesLimit);
+        }
+    }
+
+    // convert the UTF-8 output back to UTF-16 for checking,
+    // followed by what ucnv_convertEx() left in the pivot buffer at an error
+    UErrorCode errorCode=U_ZERO_ERROR;
+    int32_t length;
+    u_strFromUTF8(result, resultCapacity, &length,
+                  utf8, static_cast<int32_t>(target - utf8), &errorCode);
+    if(U_FAILURE(errorCode)) {
+        *pErrorCode=errorCode;
+        return 0;
+    }
+    while(pivotSource<pivotTarget && length<resultCapacity) {
+        result[length++]=*pivotSource++;
+    }
+    return length;
+}
+
 UBool
 ConversionTest::ToUnicodeCase(ConversionCase &cc, UConverterToUCallback callback, const char *option) {
     // open the converter
@@ -1224,22 +1479,33 @@ ConversionTest::ToUnicodeCase(ConversionCase &cc, UConverterToUCallback callback
 
     static const struct {
         int32_t step;
-        const char *name;
+        const char *name, *utf8Name;
     } steps[]={
-        { 0, "bulk" }, // must be first for offsets to be checked
-        { 1, "step=1" },
-        { 3, "step=3" },
-        { 7, "step=7" },
-        { -1, "getNext" },
-        { -2, "toU(bulk)+getNext" },
-        { -3, "getNext+toU(bulk)" },
-        { -4, "toU(1)+getNext" },
-        { -5, "getNext+toU(1)" },
-        { -12, "toU(5)+getNext" },
-        { -13, "getNext+toU(5)" },
+        { 0, "bulk", "utf8" }, // must be first for offsets to be checked
+        { 1, "step=1", "utf8 step=1" },
+        { 3, "step=3", "utf8 step=3" },
+        { 7, "step=7", "utf8 step=7" },
+        { -1, "getNext", nullptr },
+        { -2, "toU(bulk)+getNext", nullptr },
+        { -3, "getNext+toU(bulk)", nullptr },
+        { -4, "toU(1)+getNext", nullptr },
+        { -5, "getNext+toU(1)", nullptr },
+        { -12, "toU(5)+getNext", nullptr },
+        { -13, "getNext+toU(5)", nullptr },
     };
     int32_t i, step;
 
+    // test direct conversion to UTF-8 only if the expected output is well-formed
+    // and fits into the UTF-8 buffer
+    UBool testUTF8;
+    {
+        UErrorCode utf8ErrorCode=U_ZERO_ERROR;
+        u_strToUTF8(nullptr, 0, &resultLength, cc.unicode, cc.unicodeLength, &utf8ErrorCode);
+        testUTF8 = static_cast<UBool>(
+            (utf8ErrorCode==U_BUFFER_OVERFLOW_ERROR || U_SUCCESS(utf8ErrorCode)) &&
+            resultLength<=3*UPRV_LENGTHOF(result));
+    }
+
     ok=true;
     for(i=0; i<UPRV_LENGTHOF(steps) && ok; ++i) {
         step=steps[i].step;
@@ -1283,6 +1549,28 @@ ConversionTest::ToUnicodeCase(ConversionCase &cc, UConverterToUCallback callback
             errln("toUnicode[%d](%s) Conversion wrote too much to result at index %d",
                 cc.caseNr, cc.charset, resultLength);
         }
+
+        // bulk test is first, then offsets are not checked any more
+        cc.offsets=nullptr;
+
+        // test direct conversion to UTF-8
+        if(ok && step>=0 && testUTF8) {
+            errorCode.reset();
+            resultLength=stepToUTF8(cc, cnv.getAlias(), utf8Cnv,
+                                    result, UPRV_LENGTHOF(result),
+                                    step, errorCode);
+            ok=checkToUnicode(
+                    cc, cnv.getAlias(), steps[i].utf8Name,
+                    result, resultLength,
+                    nullptr,
+                    errorCode);
+            if(errorCode.isFailure() || !cc.finalFlush) {
+                // reset if an error occurred or we did not flush
+                // otherwise do nothing to make sure that flushing resets
+                ucnv_resetToUnicode(cnv.getAlias());
+                ucnv_resetFromUnicode(utf8Cnv);
+            }
+        }
     }
 
     // not a real loop, just a convenience for breaking out of the block
@@ -78,6 +78,7 @@ class ConversionTest : public IntlTest {
     void TestDefaultIgnorableCallback();
     void TestUTF8ToUTF8Overflow();
     void TestUTF8ToUTF8Streaming();
+    void TestTranscoder();
 
 private:
     UBool
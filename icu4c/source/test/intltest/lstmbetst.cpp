@@ -30,6 +30,9 @@ void LSTMBETest::runIndexedTest( int32_t index, UBool exec, const char* &name, c
     TESTCASE_AUTO(TestBurmeseGraphclust);
     TESTCASE_AUTO(TestThaiGraphclustWithLargeMemory);
     TESTCASE_AUTO(TestThaiCodepointsWithLargeMemory);
+    TESTCASE_AUTO(TestThaiGraphclustInt8);
+    TESTCASE_AUTO(TestThaiCodepointsInt8);
+    TESTCASE_AUTO(TestBurmeseGraphclustInt8);
 
     TESTCASE_AUTO_END;
 }
@@ -293,4 +296,121 @@ void LSTMBETest::runTestWithLargeMemory( const char* model, UScriptCode script)
         text += text;
     }
 }
+
+void LSTMBETest::TestThaiGraphclustInt8() {
+    runQuantizedAccuracyTest("Thai_graphclust_model4_heavy_Test.txt", "Thai_graphclust_model4_heavy", USCRIPT_THAI);
+}
+
+void LSTMBETest::TestThaiCodepointsInt8() {
+    runQuantizedAccuracyTest("Thai_codepoints_exclusive_model5_heavy_Test.txt",
+                             "Thai_codepoints_exclusive_model5_heavy", USCRIPT_THAI);
+}
+
+void LSTMBETest::TestBurmeseGraphclustInt8() {
+    runQuantizedAccuracyTest("Burmese_graphclust_model5_heavy_Test.txt", "Burmese_graphclust_model5_heavy", USCRIPT_MYANMAR);
+}
+
+// Word boundaries found by engine in text, including the end of the text.
+static std::vector<int32_t> findLSTMBreaks(const LanguageBreakEngine* engine, const UnicodeString& text,
+                                           UErrorCode& status) {
+    std::vector<int32_t> result;
+    UText ut = UTEXT_INITIALIZER;
+    utext_openConstUnicodeString(&ut, &text, &status);
+    UVector32 breaks(status);
+    engine->findBreaks(&ut, 0, text.length(), breaks, false, status);
+    utext_close(&ut);
+    for (int32_t i = 0; U_SUCCESS(status) && i < breaks.size(); i++) {
+        result.push_back(breaks.elementAti(i));
+    }
+    result.push_back(text.length());
+    return result;
+}
+
+// Run the float model and its int8 quantized variant (model + "_int8", created
+// with python/icutools/lstm/quantize.py) over the inputs of a test file, and
+// report the boundary F-measure of both against the expected output.
+// The quantized model must not lose more than two percentage points.
+void LSTMBETest::runQuantizedAccuracyTest(const char* filename, const char* model, UScriptCode script) {
+    UErrorCode status = U_ZERO_ERROR;
+    CharString quantizedModel(model, status);
+    quantizedModel.append("_int8", status);
+    LocalPointer<const LanguageBreakEngine> engine(createEngineFromTestData(model, script, status));
+    LocalPointer<const LanguageBreakEngine> quantized(
+        createEngineFromTestData(quantizedModel.data(), script, status));
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    const char *testDataDirectory = IntlTest::getSourceTestData(status);
+    CharString testFileName(testDataDirectory, -1, status);
+    testFileName.append(filename, -1, status);
+    int len;
+    char16_t *testFile = ReadAndConvertFile(testFileName.data(), len, "UTF-8", status);
+    if (U_FAILURE(status)) {
+        errln("%s:%d Error %s opening test file %s", __FILE__, __LINE__, u_errorName(status), filename);
+        return;
+    }
+    UnicodeString testString(false, testFile, len);
+
+    int32_t expectedCount = 0;
+    int32_t found[2] = {0, 0};
+    int32_t correct[2] = {0, 0};
+    int32_t disagreements = 0;
+    std::vector<int32_t> actual[2];
+    int32_t start = 0;
+    int32_t end;
+    do {
+        end = testString.indexOf(u'\n', start);
+        UnicodeString line = testString.tempSubString(start, end < 0 ? INT32_MAX : end - start);
+        line.trim();
+        int32_t tab = line.indexOf(u'\t');
+        if (tab > 0) {
+            UnicodeString key = line.tempSubString(0, tab);
+            UnicodeString value = line.tempSubString(tab + 1);
+            if (key == u"Input:") {
+                actual[0] = findLSTMBreaks(engine.getAlias(), value, status);
+                actual[1] = findLSTMBreaks(quantized.getAlias(), value, status);
+                if (actual[0] != actual[1]) {
+                    disagreements++;
+                }
+            } else if (key == u"Output:" && !actual[0].empty()) {
+                std::vector<int32_t> expected;
+                int32_t position = 0;
+                for (int32_t i = 0; i < value.length(); i++) {
+                    if (value.charAt(i) == u'|') {
+                        if (position > 0 && (expected.empty() || expected.back() != position)) {
+                            expected.push_back(position);
+                        }
+                    } else {
+                        position++;
+                    }
+                }
+                expectedCount += static_cast<int32_t>(expected.size());
+                for (int32_t m = 0; m < 2; m++) {
+                    found[m] += static_cast<int32_t>(actual[m].size());
+                    for (int32_t b : actual[m]) {
+                        if (std::binary_search(expected.begin(), expected.end(), b)) {
+                            correct[m]++;
+                        }
+                    }
+                    actual[m].clear();
+                }
+            }
+        }
+        start = end + 1;
+    } while (end >= 0 && U_SUCCESS(status));
+    delete [] testFile;
+    if (U_FAILURE(status) || expectedCount == 0) {
+        errln("%s:%d Error %s running %s", __FILE__, __LINE__, u_errorName(status), filename);
+        return;
+    }
+
+    double fMeasure[2];
+    for (int32_t m = 0; m < 2; m++) {
+        fMeasure[m] = 2.0 * correct[m] / (found[m] + expectedCount);
+    }
+    infoln("%s: float F=%.4f, int8 F=%.4f, delta=%.4f, %d inputs with different breaks",
+           model, fMeasure[0], fMeasure[1], fMeasure[1] - fMeasure[0], static_cast<int>(disagreements));
+    assertTrue(UnicodeString(model) + u" int8 accuracy within 2% of float", fMeasure[0] - fMeasure[1] <= 0.02);
+}
 #endif // #if !UCONFIG_NO_BREAK_ITERATION
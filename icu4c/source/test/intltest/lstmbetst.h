@@ -37,11 +37,15 @@ class LSTMBETest: public IntlTest {
     void TestBurmeseGraphclust();
     void TestThaiGraphclustWithLargeMemory();
     void TestThaiCodepointsWithLargeMemory();
+    void TestThaiGraphclustInt8();
+    void TestThaiCodepointsInt8();
+    void TestBurmeseGraphclustInt8();
 
 private:
     const LanguageBreakEngine* createEngineFromTestData(const char* model, UScriptCode script, UErrorCode& status);
     void runTestFromFile(const char* filename, const char* locale);
     void runTestWithLargeMemory(const char* model, UScriptCode script);
+    void runQuantizedAccuracyTest(const char* filename, const char* model, UScriptCode script);
 
     // Test parameters, from the test framework and test invocation.
     const char* fTestParams;
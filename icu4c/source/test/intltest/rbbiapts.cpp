@@ -25,6 +25,7 @@
 #include "unicode/ustring.h"
 #include "unicode/utext.h"
 #include "cmemory.h"
+#include "sharedbreakiterator.h"
 #if !UCONFIG_NO_BREAK_ITERATION
 #include "unicode/filteredbrk.h"
 #include <stdio.h> // for snprintf
@@ -1438,6 +1439,97 @@ void RBBIAPITest::TestFilteredBreakIteratorBuilder() {
 #endif
 }
 
+//---------------------------------------------
+// TestBreakIteratorPool
+//     Iterators handed out by the pool must behave like freshly created ones,
+//     and released iterators must be reused with their text reset.
+//---------------------------------------------
+void RBBIAPITest::TestBreakIteratorPool() {
+    UErrorCode status = U_ZERO_ERROR;
+    BreakIteratorPool pool(2, status);
+    TEST_ASSERT_SUCCESS(status);
+
+    UnicodeString text(u"Hello, world. Goodbye.");
+    LocalPointer<BreakIterator> expected(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d Failed to create word break iterator - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    expected->setText(text);
+
+    BreakIterator *bi = pool.acquire(Locale::getEnglish(), UBRK_WORD, status);
+    TEST_ASSERT_SUCCESS(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    TEST_ASSERT(bi->first() == 0);
+    TEST_ASSERT(bi->next() == BreakIterator::DONE);
+    bi->setText(text);
+    for (int32_t b = expected->first(), p = bi->first(); b != BreakIterator::DONE; b = expected->next(), p = bi->next()) {
+        TEST_ASSERT(b == p);
+    }
+    pool.release(bi);
+
+    // The released iterator is handed out again, without the previous text.
+    BreakIterator *reused = pool.acquire(Locale::getEnglish(), UBRK_WORD, status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(reused == bi);
+    TEST_ASSERT(reused->first() == 0);
+    TEST_ASSERT(reused->next() == BreakIterator::DONE);
+
+    // With no idle iterator left, the prototype is cloned; the clone shares the rule data.
+    BreakIterator *cloned = pool.acquire(Locale::getEnglish(), UBRK_WORD, status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(cloned != nullptr && cloned != reused);
+    uint32_t length = 0;
+    const uint8_t *rules = static_cast<RuleBasedBreakIterator *>(reused)->getBinaryRules(length);
+    TEST_ASSERT(static_cast<RuleBasedBreakIterator *>(cloned)->getBinaryRules(length) == rules);
+
+    // Different break types do not share iterators.
+    BreakIterator *line = pool.acquire(Locale::getEnglish(), UBRK_LINE, status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(line != nullptr && static_cast<RuleBasedBreakIterator *>(line)->getBinaryRules(length) != rules);
+    pool.release(line);
+
+    pool.release(reused);
+    pool.release(cloned);
+    {
+        BreakIteratorLease lease(pool, Locale::getEnglish(), UBRK_WORD, status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT(lease.get() == cloned);
+        lease->setText(text);
+        TEST_ASSERT(lease->following(0) == 5);
+    }
+
+    // Iterators go back to the locale/type pair they were acquired for,
+    // whatever the order of the releases.
+    BreakIterator *word = pool.acquire(Locale::getEnglish(), UBRK_WORD, status);
+    line = pool.acquire(Locale::getEnglish(), UBRK_LINE, status);
+    TEST_ASSERT_SUCCESS(status);
+    pool.release(line);
+    pool.release(word);
+    TEST_ASSERT(pool.acquire(Locale::getEnglish(), UBRK_LINE, status) == line);
+    TEST_ASSERT(pool.acquire(Locale::getEnglish(), UBRK_WORD, status) == word);
+    TEST_ASSERT_SUCCESS(status);
+
+    // An iterator that was acquired before a flush is deleted when it is released,
+    // and so is one that the pool did not hand out.
+    pool.flush();
+    pool.release(word);
+    pool.release(line);
+    pool.release(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    TEST_ASSERT_SUCCESS(status);
+    BreakIterator *afterFlush = pool.acquire(Locale::getEnglish(), UBRK_WORD, status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(afterFlush != nullptr && afterFlush->first() == 0 && afterFlush->next() == BreakIterator::DONE);
+    pool.release(afterFlush);
+    pool.flush();
+
+    status = U_ZERO_ERROR;
+    TEST_ASSERT(pool.acquire(Locale::getEnglish(), static_cast<UBreakIteratorType>(99), status) == nullptr);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+}
+
 //---------------------------------------------
 // runIndexedTest
 //---------------------------------------------
@@ -1466,6 +1558,9 @@ void RBBIAPITest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestGetBinaryRules);
 #endif
     TESTCASE_AUTO(TestRefreshInputText);
+#if !UCONFIG_NO_FILE_IO
+    TESTCASE_AUTO(TestBreakIteratorPool);
+#endif
 #if !UCONFIG_NO_BREAK_ITERATION
     TESTCASE_AUTO(TestFilteredBreakIteratorBuilder);
 #endif
@@ -91,6 +91,8 @@ class RBBIAPITest: public IntlTest {
 
     void TestRefreshInputText();
 
+    void TestBreakIteratorPool();
+
     /**
      *Internal subroutines
      **/
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cinttypes>
 #include <list>
 #include <random>
@@ -27,6 +28,7 @@
 #include <utility>
 #include <vector>
 #include <string_view>
+#include <thread>
 
 #include "unicode/brkiter.h"
 #include "unicode/localpointer.h"
@@ -155,6 +157,7 @@ void RBBITest::runIndexedTest( int32_t index, UBool exec, const char* &name, cha
     TESTCASE_AUTO(TestBug22585);
     TESTCASE_AUTO(TestBug22602);
     TESTCASE_AUTO(TestBug22636);
+    TESTCASE_AUTO(TestCjkBreakEngineScratch);
 
 #if U_ENABLE_TRACING
     TESTCASE_AUTO(TestTraceCreateCharacter);
@@ -6173,4 +6176,106 @@ void RBBITest::TestBug22581() {
 
     RuleBasedBreakIterator bi(ruleStr, pe, ec);
 }
+
+// The boundaries of the text that bi has been set to.
+static std::vector<int32_t> getBoundaries(BreakIterator &bi) {
+    std::vector<int32_t> boundaries;
+    for (int32_t b = bi.first(); b != BreakIterator::DONE; b = bi.next()) {
+        boundaries.push_back(b);
+    }
+    return boundaries;
+}
+
+static std::vector<int32_t> getBoundaries(BreakIterator &bi, const UnicodeString &text) {
+    bi.setText(text);
+    return getBoundaries(bi);
+}
+
+static std::vector<int32_t> getUTF8Boundaries(BreakIterator &bi, const std::string &text,
+                                              UErrorCode &status) {
+    LocalUTextPointer ut(utext_openUTF8(nullptr, text.data(), static_cast<int64_t>(text.length()),
+                                        &status));
+    bi.setText(ut.getAlias(), status);
+    return U_SUCCESS(status) ? getBoundaries(bi) : std::vector<int32_t>();
+}
+
+void RBBITest::TestCjkBreakEngineScratch() {
+    // CjkBreakEngine reuses its working storage from one range to the next,
+    // frees it after ranges longer than 4096 code units, and NFKC-normalizes
+    // only the part of a range after its longest normalized prefix.
+    // Segmenting the same text must give the same boundaries whatever was
+    // segmented before, and on several threads at once.
+    // Without a CJ dictionary the characters are not broken by the engine,
+    // and the test only checks that the boundaries are consistent.
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> bi(BreakIterator::createWordInstance(Locale::getJapanese(), status));
+    if (!assertSuccess(WHERE, status, true)) {
+        return;
+    }
+    // Halfwidth katakana need normalization. In the first text they follow a
+    // normalized prefix; in the second they start the range.
+    UnicodeString prefixed(u"日本語の文章をｺﾝﾋﾟｭｰﾀｰで書きます");
+    UnicodeString halfwidth(u"ｺﾝﾋﾟｭｰﾀｰを使って日本語の文章を書きます");
+    // One dictionary range of more than 4096 code units.
+    UnicodeString longRange;
+    while (longRange.length() <= 5000) {
+        longRange.append(halfwidth).append(prefixed);
+    }
+    std::string prefixedUTF8;
+    prefixed.toUTF8String(prefixedUTF8);
+
+    std::vector<int32_t> prefixedExpected = getBoundaries(*bi, prefixed);
+    std::vector<int32_t> halfwidthExpected = getBoundaries(*bi, halfwidth);
+    std::vector<int32_t> utf8Expected = getUTF8Boundaries(*bi, prefixedUTF8, status);
+    assertSuccess(WHERE, status);
+    assertTrue(WHERE, prefixedExpected.size() >= 2 && prefixedExpected.back() == prefixed.length());
+    assertTrue(WHERE, utf8Expected.size() == prefixedExpected.size());
+
+    // The text ranges are separated by a character that the engine does not
+    // handle, so each range is segmented by its own call.
+    UnicodeString twice = UnicodeString(prefixed).append(u'。').append(prefixed);
+    std::vector<int32_t> twiceBoundaries = getBoundaries(*bi, twice);
+    std::vector<int32_t> twiceExpected(prefixedExpected);
+    for (int32_t b : prefixedExpected) {
+        twiceExpected.push_back(prefixed.length() + 1 + b);
+    }
+    assertTrue(WHERE, twiceBoundaries == twiceExpected);
+
+    std::vector<int32_t> longExpected = getBoundaries(*bi, longRange);
+    assertTrue(WHERE, longExpected.size() >= 2 && longExpected.back() == longRange.length());
+    assertTrue(WHERE, getBoundaries(*bi, prefixed) == prefixedExpected);
+    assertTrue(WHERE, getBoundaries(*bi, longRange) == longExpected);
+    assertTrue(WHERE, getBoundaries(*bi, halfwidth) == halfwidthExpected);
+    assertTrue(WHERE, getUTF8Boundaries(*bi, prefixedUTF8, status) == utf8Expected);
+    assertTrue(WHERE, getBoundaries(*bi, halfwidth) == halfwidthExpected);
+    assertSuccess(WHERE, status);
+
+    // Each thread segments the texts with its own iterator, using the same engine.
+    std::atomic<int32_t> mismatches(0);
+    auto segment = [&](BreakIterator *threadBi) {
+        UErrorCode threadStatus = U_ZERO_ERROR;
+        for (int32_t i = 0; i < 10; i++) {
+            if (getBoundaries(*threadBi, prefixed) != prefixedExpected ||
+                    getBoundaries(*threadBi, longRange) != longExpected ||
+                    getBoundaries(*threadBi, halfwidth) != halfwidthExpected ||
+                    getUTF8Boundaries(*threadBi, prefixedUTF8, threadStatus) != utf8Expected) {
+                mismatches++;
+            }
+        }
+        if (U_FAILURE(threadStatus)) {
+            mismatches++;
+        }
+    };
+    LocalPointer<BreakIterator> bi1(bi->clone());
+    LocalPointer<BreakIterator> bi2(bi->clone());
+    if (!assertTrue(WHERE, bi1.isValid() && bi2.isValid())) {
+        return;
+    }
+    std::thread t1(segment, bi1.getAlias());
+    std::thread t2(segment, bi2.getAlias());
+    t1.join();
+    t2.join();
+    assertEquals(WHERE, 0, mismatches.load());
+}
+
 #endif // #if !UCONFIG_NO_BREAK_ITERATION
@@ -106,6 +106,7 @@ class RBBITest: public IntlTest {
     void TestBug22585();
     void TestBug22602();
     void TestBug22636();
+    void TestCjkBreakEngineScratch();
 
 #if U_ENABLE_TRACING
     void TestTraceCreateCharacter();
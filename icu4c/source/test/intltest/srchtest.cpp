@@ -20,6 +20,8 @@
 #include "cmemory.h"
 #include <string.h>
 #include <stdio.h>
+#include <set>
+#include <utility>
 
 // private definitions -----------------------------------------------------
 
@@ -170,6 +172,8 @@ void StringSearchTest::runIndexedTest(int32_t index, UBool exec,
         CASE(34, TestSubclass)
         CASE(35, TestCoverage)
         CASE(36, TestDiacriticMatch)
+        CASE(37, TestLongText)
+        CASE(38, TestIgnorableStarts)
         default: name = ""; break;
     }
 #else
@@ -1687,6 +1691,130 @@ void StringSearchTest::TestDiacriticMatch()
     
 }
  
+void StringSearchTest::TestLongText()
+{
+    // Long ASCII runs let the search skip ahead over characters that cannot
+    // start a match; matches around contractions and combining marks must not change.
+    UErrorCode status = U_ZERO_ERROR;
+    RuleBasedCollator coll(UnicodeString(u"&c<ch<<<cH<<<Ch<<<CH"), status);
+    if (U_FAILURE(status)) {
+        dataerrln("Error opening collator %s", u_errorName(status));
+        return;
+    }
+    UnicodeString filler(u"the quick brown fox jumps over a lazy dog. ");
+    int32_t fillerCount = 0;
+    UnicodeString text;
+    while (text.length() < 3000) { text.append(filler); ++fillerCount; }
+    int32_t chicken = text.length();
+    text.append(u"cchicken hicken, ");
+    while (text.length() < 6000) { text.append(filler); ++fillerCount; }
+    int32_t cafe = text.length();
+    text.append(u"cafe\u0301 cafe ");
+    while (text.length() < 9000) { text.append(filler); ++fillerCount; }
+    int32_t end = text.length();
+    text.append(u"CHICKEN");
+
+    static const struct {
+        const char16_t *pattern;
+        Collator::ECollationStrength strength;
+    } cases[] = {
+        { u"chicken", Collator::TERTIARY },
+        { u"chicken", Collator::PRIMARY },
+        { u"hicken", Collator::PRIMARY },
+        { u"cafe", Collator::TERTIARY },
+        { u"cafe", Collator::PRIMARY },
+        { u"fox jumps", Collator::PRIMARY }
+    };
+    const int32_t expected[][3] = {
+        { chicken + 1, -1, -1 },
+        { chicken + 1, end, -1 },
+        { chicken + 9, -1, -1 },
+        { cafe + 6, -1, -1 },
+        { cafe, cafe + 6, -1 }
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        coll.setStrength(cases[i].strength);
+        StringSearch strsrch(UnicodeString(cases[i].pattern), text, &coll, nullptr, status);
+        if (U_FAILURE(status)) {
+            errln("Error opening string search %s", u_errorName(status));
+            return;
+        }
+        int32_t count = 0;
+        for (int32_t match = strsrch.first(status); match != USEARCH_DONE;
+                match = strsrch.next(status)) {
+            if (i < UPRV_LENGTHOF(expected) &&
+                    (count >= UPRV_LENGTHOF(expected[i]) || match != expected[i][count])) {
+                errln(UnicodeString(u"case ") + i + u" \"" + cases[i].pattern +
+                      u"\": unexpected match at " + match);
+            }
+            ++count;
+        }
+        int32_t expectedCount = fillerCount;
+        if (i < UPRV_LENGTHOF(expected)) {
+            for (expectedCount = 0; expectedCount < UPRV_LENGTHOF(expected[i]) &&
+                    expected[i][expectedCount] >= 0; ++expectedCount) {}
+        }
+        if (U_FAILURE(status) || count != expectedCount) {
+            errln(UnicodeString(u"case ") + i + u" \"" + cases[i].pattern + u"\": " +
+                  count + u" matches instead of " + expectedCount + u", " + u_errorName(status));
+        }
+    }
+}
+
+void StringSearchTest::TestIgnorableStarts()
+{
+    // ASCII characters without collation elements might start a match,
+    // so forward search must not skip them and must find what backward search finds.
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<Collator> coll(Collator::createInstance(Locale::getJapanese(), status));
+    if (U_FAILURE(status)) {
+        dataerrln("Error opening collator %s", u_errorName(status));
+        return;
+    }
+    coll->setAttribute(UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, status);
+    coll->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, status);
+    static const struct {
+        const char16_t *pattern;
+        const char16_t *text;
+    } cases[] = {
+        { u"\x01h", u"h-\x01hh" },
+        { u"\x01h", u"\x01hh \x01h" },
+        { u"-h", u"h--hh" },
+        { u"h\x01", u"h\x01h-h" }
+    };
+    static const Collator::ECollationStrength strengths[] = {
+        Collator::PRIMARY, Collator::TERTIARY, Collator::QUATERNARY, Collator::IDENTICAL
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        for (Collator::ECollationStrength strength : strengths) {
+            coll->setStrength(strength);
+            UnicodeString pattern(cases[i].pattern);
+            StringSearch strsrch(pattern, UnicodeString(cases[i].text),
+                                 dynamic_cast<RuleBasedCollator *>(coll.getAlias()), nullptr, status);
+            if (U_FAILURE(status)) {
+                errln("Error opening string search %s", u_errorName(status));
+                return;
+            }
+            // Backward search may report its first match twice, so compare sets of matches.
+            std::set<std::pair<int32_t, int32_t>> forward, backward;
+            for (int32_t match = strsrch.first(status); match != USEARCH_DONE;
+                    match = strsrch.next(status)) {
+                forward.emplace(match, strsrch.getMatchedLength());
+            }
+            for (int32_t match = strsrch.last(status); match != USEARCH_DONE;
+                    match = strsrch.previous(status)) {
+                backward.emplace(match, strsrch.getMatchedLength());
+            }
+            if (U_FAILURE(status) || forward != backward) {
+                errln(UnicodeString(u"case ") + i + u" at strength " + strength + u": " +
+                      static_cast<int32_t>(forward.size()) + u" forward matches, " +
+                      static_cast<int32_t>(backward.size()) + u" backward, " + u_errorName(status));
+                status = U_ZERO_ERROR;
+            }
+        }
+    }
+}
+
 void StringSearchTest::TestCanonical()
 {
     int count = 0;
@@ -91,6 +91,8 @@ class StringSearchTest: public IntlTest
     void TestSubclass();
     void TestCoverage();
     void TestDiacriticMatch();
+    void TestLongText();
+    void TestIgnorableStarts();
 #endif
 };
 
@@ -38,6 +38,7 @@
     "ko_KR",
     "ru_RU",
     "ru_RU",
+    "el_GR",
     "th_TH",
     "th_TH"
 );
@@ -62,6 +63,7 @@
     $filePrefix."Korean.txt",
     $filePrefix."Latin.txt",
     $filePrefix."Russian.txt",
+    $filePrefix."Greek.txt",
     $filePrefix."Latin.txt",
     $filePrefix."Thai.txt"
 );
@@ -64,6 +64,39 @@
     ####
     "ISO2022JP From Unicode",   ["$p1,TestICU_ISO2022JP_FromUnicode",   "$p2,TestICU_ISO2022JP_FromUnicode" ],
     "ISO2022JP To Unicode",     ["$p1,TestICU_ISO2022JP_ToUnicode",     "$p2,TestICU_ISO2022JP_ToUnicode" ],
+    ####
+    "Shift-JIS mixed From Unicode", ["$p1,TestICU_SJIS_Mixed_FromUnicode",  "$p2,TestICU_SJIS_Mixed_FromUnicode" ],
+    "Shift-JIS mixed To Unicode", ["$p1,TestICU_SJIS_Mixed_ToUnicode",    "$p2,TestICU_SJIS_Mixed_ToUnicode" ],
+    ####
+    "GBK From Unicode",         ["$p1,TestICU_GBK_FromUnicode",         "$p2,TestICU_GBK_FromUnicode" ],
+    "GBK To Unicode",           ["$p1,TestICU_GBK_ToUnicode",           "$p2,TestICU_GBK_ToUnicode" ],
+    ####
+    "EUC-KR From Unicode",      ["$p1,TestICU_EUCKR_FromUnicode",       "$p2,TestICU_EUCKR_FromUnicode" ],
+    "EUC-KR To Unicode",        ["$p1,TestICU_EUCKR_ToUnicode",         "$p2,TestICU_EUCKR_ToUnicode" ],
+    ####
+    "windows-1252 From Unicode", ["$p1,TestICU_Windows1252_FromUnicode", "$p2,TestICU_Windows1252_FromUnicode" ],
+    "windows-1252 To Unicode",  ["$p1,TestICU_Windows1252_ToUnicode",   "$p2,TestICU_Windows1252_ToUnicode" ],
+    ####
+    "windows-1251 From Unicode", ["$p1,TestICU_Windows1251_FromUnicode", "$p2,TestICU_Windows1251_FromUnicode" ],
+    "windows-1251 To Unicode",  ["$p1,TestICU_Windows1251_ToUnicode",   "$p2,TestICU_Windows1251_ToUnicode" ],
+    ####
+    "SCSU Cyrillic compress",    ["$p1,TestICU_SCSU_Cyrillic_Compress", "$p2,TestICU_SCSU_Cyrillic_Compress" ],
+    "SCSU Cyrillic decompress",  ["$p1,TestICU_SCSU_Cyrillic_Decompress", "$p2,TestICU_SCSU_Cyrillic_Decompress" ],
+    "SCSU Japanese compress",    ["$p1,TestICU_SCSU_Japanese_Compress", "$p2,TestICU_SCSU_Japanese_Compress" ],
+    "SCSU Japanese decompress",  ["$p1,TestICU_SCSU_Japanese_Decompress", "$p2,TestICU_SCSU_Japanese_Decompress" ],
+    "SCSU Korean compress",      ["$p1,TestICU_SCSU_Korean_Compress", "$p2,TestICU_SCSU_Korean_Compress" ],
+    "SCSU Korean decompress",    ["$p1,TestICU_SCSU_Korean_Decompress", "$p2,TestICU_SCSU_Korean_Decompress" ],
+    "SCSU Multilingual compress", ["$p1,TestICU_SCSU_Multilingual_Compress", "$p2,TestICU_SCSU_Multilingual_Compress" ],
+    "SCSU Multilingual decompress", ["$p1,TestICU_SCSU_Multilingual_Decompress", "$p2,TestICU_SCSU_Multilingual_Decompress" ],
+    ####
+    "BOCU-1 Cyrillic compress",  ["$p1,TestICU_BOCU1_Cyrillic_Compress", "$p2,TestICU_BOCU1_Cyrillic_Compress" ],
+    "BOCU-1 Cyrillic decompress", ["$p1,TestICU_BOCU1_Cyrillic_Decompress", "$p2,TestICU_BOCU1_Cyrillic_Decompress" ],
+    "BOCU-1 Japanese compress",  ["$p1,TestICU_BOCU1_Japanese_Compress", "$p2,TestICU_BOCU1_Japanese_Compress" ],
+    "BOCU-1 Japanese decompress", ["$p1,TestICU_BOCU1_Japanese_Decompress", "$p2,TestICU_BOCU1_Japanese_Decompress" ],
+    "BOCU-1 Korean compress",    ["$p1,TestICU_BOCU1_Korean_Compress", "$p2,TestICU_BOCU1_Korean_Compress" ],
+    "BOCU-1 Korean decompress",  ["$p1,TestICU_BOCU1_Korean_Decompress", "$p2,TestICU_BOCU1_Korean_Decompress" ],
+    "BOCU-1 Multilingual compress", ["$p1,TestICU_BOCU1_Multilingual_Compress", "$p2,TestICU_BOCU1_Multilingual_Compress" ],
+    "BOCU-1 Multilingual decompress", ["$p1,TestICU_BOCU1_Multilingual_Decompress", "$p2,TestICU_BOCU1_Multilingual_Decompress" ],
 };
 
 
@@ -20,8 +20,36 @@
 #include <stdio.h>
 #include "cmemory.h" // for UPRV_LENGTHOF
 
+long gICUAllocationCount = 0;
+
+U_CDECL_BEGIN
+
+static void *U_CALLCONV
+countingAlloc(const void * /*context*/, size_t size) {
+    ++gICUAllocationCount;
+    return malloc(size);
+}
+
+static void *U_CALLCONV
+countingRealloc(const void * /*context*/, void *mem, size_t size) {
+    ++gICUAllocationCount;
+    return realloc(mem, size);
+}
+
+static void U_CALLCONV
+countingFree(const void * /*context*/, void *mem) {
+    free(mem);
+}
+
+U_CDECL_END
+
 int main(int argc, const char* argv[]){
     UErrorCode status = U_ZERO_ERROR;
+    // Count heap allocations for the open/convert/close test cases.
+    u_setMemoryFunctions(nullptr, countingAlloc, countingRealloc, countingFree, &status);
+    if(U_FAILURE(status)){
+        return status;
+    }
     ConverterPerformanceTest test(argc, argv, status);
     if(U_FAILURE(status)){
         return status;
@@ -116,6 +144,64 @@ UPerfFunction* ConverterPerformanceTest::runIndexedTest(int32_t index, UBool exe
         TESTCASE(52,TestWinANSI_ISO2022JP_ToUnicode);
         TESTCASE(53,TestWinANSI_ISO2022JP_FromUnicode);
 
+        // mostly ASCII markup mixed with native text
+        TESTCASE(54,TestICU_SJIS_Mixed_ToUnicode);
+        TESTCASE(55,TestICU_SJIS_Mixed_FromUnicode);
+        TESTCASE(56,TestWinIML2_SJIS_Mixed_ToUnicode);
+        TESTCASE(57,TestWinIML2_SJIS_Mixed_FromUnicode);
+        TESTCASE(58,TestWinANSI_SJIS_Mixed_ToUnicode);
+        TESTCASE(59,TestWinANSI_SJIS_Mixed_FromUnicode);
+
+        TESTCASE(60,TestICU_GBK_ToUnicode);
+        TESTCASE(61,TestICU_GBK_FromUnicode);
+        TESTCASE(62,TestWinIML2_GBK_ToUnicode);
+        TESTCASE(63,TestWinIML2_GBK_FromUnicode);
+        TESTCASE(64,TestWinANSI_GBK_ToUnicode);
+        TESTCASE(65,TestWinANSI_GBK_FromUnicode);
+
+        TESTCASE(66,TestICU_EUCKR_ToUnicode);
+        TESTCASE(67,TestICU_EUCKR_FromUnicode);
+        TESTCASE(68,TestWinIML2_EUCKR_ToUnicode);
+        TESTCASE(69,TestWinIML2_EUCKR_FromUnicode);
+        TESTCASE(70,TestWinANSI_EUCKR_ToUnicode);
+        TESTCASE(71,TestWinANSI_EUCKR_FromUnicode);
+
+        TESTCASE(72,TestICU_Windows1252_ToUnicode);
+        TESTCASE(73,TestICU_Windows1252_FromUnicode);
+        TESTCASE(74,TestWinIML2_Windows1252_ToUnicode);
+        TESTCASE(75,TestWinIML2_Windows1252_FromUnicode);
+        TESTCASE(76,TestWinANSI_Windows1252_ToUnicode);
+        TESTCASE(77,TestWinANSI_Windows1252_FromUnicode);
+
+        TESTCASE(78,TestICU_Windows1251_ToUnicode);
+        TESTCASE(79,TestICU_Windows1251_FromUnicode);
+        TESTCASE(80,TestWinIML2_Windows1251_ToUnicode);
+        TESTCASE(81,TestWinIML2_Windows1251_FromUnicode);
+        TESTCASE(82,TestWinANSI_Windows1251_ToUnicode);
+        TESTCASE(83,TestWinANSI_Windows1251_FromUnicode);
+
+        // converter per short text, as for HTTP responses; events are allocations
+        TESTCASE(84,TestICU_SJIS_OpenConvertClose);
+        TESTCASE(85,TestICU_SJIS_PooledConvert);
+
+        // SCSU and BOCU-1; operations are UTF-16 bytes, events are compressed bytes
+        TESTCASE(86,TestICU_SCSU_Cyrillic_Compress);
+        TESTCASE(87,TestICU_SCSU_Cyrillic_Decompress);
+        TESTCASE(88,TestICU_SCSU_Japanese_Compress);
+        TESTCASE(89,TestICU_SCSU_Japanese_Decompress);
+        TESTCASE(90,TestICU_SCSU_Korean_Compress);
+        TESTCASE(91,TestICU_SCSU_Korean_Decompress);
+        TESTCASE(92,TestICU_SCSU_Multilingual_Compress);
+        TESTCASE(93,TestICU_SCSU_Multilingual_Decompress);
+        TESTCASE(94,TestICU_BOCU1_Cyrillic_Compress);
+        TESTCASE(95,TestICU_BOCU1_Cyrillic_Decompress);
+        TESTCASE(96,TestICU_BOCU1_Japanese_Compress);
+        TESTCASE(97,TestICU_BOCU1_Japanese_Decompress);
+        TESTCASE(98,TestICU_BOCU1_Korean_Compress);
+        TESTCASE(99,TestICU_BOCU1_Korean_Decompress);
+        TESTCASE(100,TestICU_BOCU1_Multilingual_Compress);
+        TESTCASE(101,TestICU_BOCU1_Multilingual_Decompress);
+
         default: 
             name = ""; 
             return nullptr;
@@ -657,3 +743,481 @@ UPerfFunction*  ConverterPerformanceTest::TestWinANSI_ISO2022JP_ToUnicode(){
     }
     return pf;
 }
+
+//#################
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SJIS_Mixed_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("sjis", (char16_t *)sjis_mixed_uniSource, UPRV_LENGTHOF(sjis_mixed_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_SJIS_Mixed_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("sjis",(char*)sjis_mixed_encSource, UPRV_LENGTHOF(sjis_mixed_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestWinIML2_SJIS_Mixed_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2FromUnicodePerfFunction("sjis",sjis_mixed_uniSource, UPRV_LENGTHOF(sjis_mixed_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinIML2_SJIS_Mixed_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2ToUnicodePerfFunction("sjis",(char*)sjis_mixed_encSource, UPRV_LENGTHOF(sjis_mixed_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestWinANSI_SJIS_Mixed_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIFromUnicodePerfFunction("sjis",sjis_mixed_uniSource, UPRV_LENGTHOF(sjis_mixed_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinANSI_SJIS_Mixed_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIToUnicodePerfFunction("sjis",(char*)sjis_mixed_encSource, UPRV_LENGTHOF(sjis_mixed_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+//#################
+
+UPerfFunction* ConverterPerformanceTest::TestICU_GBK_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("gbk", (char16_t *)gbk_uniSource, UPRV_LENGTHOF(gbk_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_GBK_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("gbk",(char*)gbk_encSource, UPRV_LENGTHOF(gbk_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestWinIML2_GBK_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2FromUnicodePerfFunction("gbk",gbk_uniSource, UPRV_LENGTHOF(gbk_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinIML2_GBK_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2ToUnicodePerfFunction("gbk",(char*)gbk_encSource, UPRV_LENGTHOF(gbk_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestWinANSI_GBK_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIFromUnicodePerfFunction("gbk",gbk_uniSource, UPRV_LENGTHOF(gbk_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinANSI_GBK_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIToUnicodePerfFunction("gbk",(char*)gbk_encSource, UPRV_LENGTHOF(gbk_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+//#################
+
+UPerfFunction* ConverterPerformanceTest::TestICU_EUCKR_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("euc-kr", (char16_t *)euckr_uniSource, UPRV_LENGTHOF(euckr_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_EUCKR_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("euc-kr",(char*)euckr_encSource, UPRV_LENGTHOF(euckr_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestWinIML2_EUCKR_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2FromUnicodePerfFunction("euc-kr",euckr_uniSource, UPRV_LENGTHOF(euckr_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinIML2_EUCKR_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2ToUnicodePerfFunction("euc-kr",(char*)euckr_encSource, UPRV_LENGTHOF(euckr_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestWinANSI_EUCKR_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIFromUnicodePerfFunction("euc-kr",euckr_uniSource, UPRV_LENGTHOF(euckr_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinANSI_EUCKR_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIToUnicodePerfFunction("euc-kr",(char*)euckr_encSource, UPRV_LENGTHOF(euckr_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+//#################
+
+UPerfFunction* ConverterPerformanceTest::TestICU_Windows1252_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("windows-1252", (char16_t *)windows1252_uniSource, UPRV_LENGTHOF(windows1252_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_Windows1252_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("windows-1252",(char*)windows1252_encSource, UPRV_LENGTHOF(windows1252_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestWinIML2_Windows1252_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2FromUnicodePerfFunction("windows-1252",windows1252_uniSource, UPRV_LENGTHOF(windows1252_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinIML2_Windows1252_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2ToUnicodePerfFunction("windows-1252",(char*)windows1252_encSource, UPRV_LENGTHOF(windows1252_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestWinANSI_Windows1252_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIFromUnicodePerfFunction("windows-1252",windows1252_uniSource, UPRV_LENGTHOF(windows1252_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinANSI_Windows1252_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIToUnicodePerfFunction("windows-1252",(char*)windows1252_encSource, UPRV_LENGTHOF(windows1252_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+//#################
+
+UPerfFunction* ConverterPerformanceTest::TestICU_Windows1251_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("windows-1251", (char16_t *)windows1251_uniSource, UPRV_LENGTHOF(windows1251_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_Windows1251_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("windows-1251",(char*)windows1251_encSource, UPRV_LENGTHOF(windows1251_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestWinIML2_Windows1251_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2FromUnicodePerfFunction("windows-1251",windows1251_uniSource, UPRV_LENGTHOF(windows1251_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinIML2_Windows1251_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinIMultiLanguage2ToUnicodePerfFunction("windows-1251",(char*)windows1251_encSource, UPRV_LENGTHOF(windows1251_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestWinANSI_Windows1251_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIFromUnicodePerfFunction("windows-1251",windows1251_uniSource, UPRV_LENGTHOF(windows1251_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestWinANSI_Windows1251_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new WinANSIToUnicodePerfFunction("windows-1251",(char*)windows1251_encSource, UPRV_LENGTHOF(windows1251_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SJIS_OpenConvertClose(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUOpenConvertClosePerfFunction("sjis", (char*)sjis_encSource, UPRV_LENGTHOF(sjis_encSource), false, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SJIS_PooledConvert(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUOpenConvertClosePerfFunction("sjis", (char*)sjis_encSource, UPRV_LENGTHOF(sjis_encSource), true, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+// sample texts for the compression tests
+static const char16_t* const multilingualSources[] = {
+    (char16_t *)windows1252_uniSource, (char16_t *)windows1251_uniSource,
+    (char16_t *)latin7_uniSource, (char16_t *)ebcdic_arabic_uniSource,
+    (char16_t *)sjis_uniSource, (char16_t *)gbk_uniSource, (char16_t *)euckr_uniSource
+};
+static const int32_t multilingualLengths[] = {
+    UPRV_LENGTHOF(windows1252_uniSource), UPRV_LENGTHOF(windows1251_uniSource),
+    UPRV_LENGTHOF(latin7_uniSource), UPRV_LENGTHOF(ebcdic_arabic_uniSource),
+    UPRV_LENGTHOF(sjis_uniSource), UPRV_LENGTHOF(gbk_uniSource), UPRV_LENGTHOF(euckr_uniSource)
+};
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Cyrillic_Compress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)windows1251_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(windows1251_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("SCSU", sources, lengths, 1, false, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Cyrillic_Decompress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)windows1251_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(windows1251_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("SCSU", sources, lengths, 1, true, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Japanese_Compress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)sjis_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(sjis_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("SCSU", sources, lengths, 1, false, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Japanese_Decompress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)sjis_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(sjis_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("SCSU", sources, lengths, 1, true, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Korean_Compress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)euckr_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(euckr_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("SCSU", sources, lengths, 1, false, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Korean_Decompress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)euckr_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(euckr_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("SCSU", sources, lengths, 1, true, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Multilingual_Compress(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUCompressionPerfFunction("SCSU", multilingualSources, multilingualLengths, UPRV_LENGTHOF(multilingualSources), false, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SCSU_Multilingual_Decompress(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUCompressionPerfFunction("SCSU", multilingualSources, multilingualLengths, UPRV_LENGTHOF(multilingualSources), true, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Cyrillic_Compress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)windows1251_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(windows1251_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("BOCU-1", sources, lengths, 1, false, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Cyrillic_Decompress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)windows1251_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(windows1251_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("BOCU-1", sources, lengths, 1, true, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Japanese_Compress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)sjis_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(sjis_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("BOCU-1", sources, lengths, 1, false, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Japanese_Decompress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)sjis_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(sjis_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("BOCU-1", sources, lengths, 1, true, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Korean_Compress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)euckr_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(euckr_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("BOCU-1", sources, lengths, 1, false, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Korean_Decompress(){
+    UErrorCode status = U_ZERO_ERROR;
+    const char16_t* const sources[] = { (char16_t *)euckr_uniSource };
+    const int32_t lengths[] = { UPRV_LENGTHOF(euckr_uniSource) };
+    UPerfFunction* pf = new ICUCompressionPerfFunction("BOCU-1", sources, lengths, 1, true, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Multilingual_Compress(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUCompressionPerfFunction("BOCU-1", multilingualSources, multilingualLengths, UPRV_LENGTHOF(multilingualSources), false, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_BOCU1_Multilingual_Decompress(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUCompressionPerfFunction("BOCU-1", multilingualSources, multilingualLengths, UPRV_LENGTHOF(multilingualSources), true, status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
@@ -117,6 +117,136 @@ class ICUFromUnicodePerfFunction : public UPerfFunction{
     }
 };
 
+// Number of ICU heap allocations so far, counted by the memory functions
+// that main() installs with u_setMemoryFunctions().
+extern long gICUAllocationCount;
+
+// Opens a converter (or acquires it from a pool), converts a short text to Unicode,
+// and closes (or releases) the converter, as for one HTTP response body.
+// The number of events is the number of ICU heap allocations per conversion.
+class ICUOpenConvertClosePerfFunction : public UPerfFunction{
+private:
+    UConverterPool* pool;
+    const char* name;
+    const char* src;
+    int32_t srcLen;
+    char16_t target[MAX_BUF_SIZE];
+    long allocations;
+
+public:
+    ICUOpenConvertClosePerfFunction(const char* cnvName, const char* source, int32_t sourceLen,
+                                    UBool usePool, UErrorCode& status){
+        pool = usePool ? ucnv_openPool(4, &status) : nullptr;
+        name = cnvName;
+        src = source;
+        srcLen = sourceLen < MAX_BUF_SIZE ? sourceLen : MAX_BUF_SIZE;
+        allocations = 0;
+        if(U_FAILURE(status)){
+            return;
+        }
+        call(&status);  // warm up the converter cache and the pool
+        long start = gICUAllocationCount;
+        call(&status);
+        allocations = gICUAllocationCount - start;
+    }
+    virtual void call(UErrorCode* status){
+        UConverter* conv = pool != nullptr ? ucnv_acquire(pool, name, status) : ucnv_open(name, status);
+        const char* mySrc = src;
+        char16_t* myTarget = target;
+        ucnv_toUnicode(conv, &myTarget, target + MAX_BUF_SIZE, &mySrc, src + srcLen, nullptr, true, status);
+        if(pool != nullptr){
+            ucnv_release(pool, conv);
+        } else {
+            ucnv_close(conv);
+        }
+    }
+    virtual long getOperationsPerIteration(){
+        return 1;
+    }
+    virtual long getEventsPerIteration(){
+        return allocations;
+    }
+    ~ICUOpenConvertClosePerfFunction(){
+        ucnv_closePool(pool);
+    }
+};
+
+// Compresses Unicode text with SCSU or BOCU-1, or decompresses it again.
+// The text is the concatenation of one or more sample texts.
+// Operations are UTF-16 bytes, so 1000 divided by the time per operation in ns is MB/s;
+// events are compressed bytes, so events per operation is the compression ratio.
+class ICUCompressionPerfFunction : public UPerfFunction{
+private:
+    UConverter* conv;
+    char16_t* text;
+    int32_t textLen;
+    char* bytes;
+    int32_t bytesLen;
+    char16_t* target;
+    UBool decompress;
+
+public:
+    ICUCompressionPerfFunction(const char* name, const char16_t* const sources[], const int32_t lengths[], int32_t count,
+                               UBool decompressText, UErrorCode& status){
+        conv = ucnv_open(name, &status);
+        text = nullptr;
+        bytes = nullptr;
+        target = nullptr;
+        textLen = bytesLen = 0;
+        decompress = decompressText;
+        if(U_FAILURE(status)){
+            return;
+        }
+        for(int32_t i = 0; i < count; ++i){
+            textLen += lengths[i];
+        }
+        text = (char16_t*)malloc(textLen * U_SIZEOF_UCHAR);
+        target = (char16_t*)malloc(textLen * U_SIZEOF_UCHAR);
+        if(text == nullptr || target == nullptr){
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        char16_t* p = text;
+        for(int32_t i = 0; i < count; ++i){
+            u_memcpy(p, sources[i], lengths[i]);
+            p += lengths[i];
+        }
+        bytesLen = ucnv_fromUChars(conv, nullptr, 0, text, textLen, &status);
+        if(status == U_BUFFER_OVERFLOW_ERROR){
+            status = U_ZERO_ERROR;
+            bytes = (char*)malloc(bytesLen);
+            if(bytes == nullptr){
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            ucnv_fromUChars(conv, bytes, bytesLen, text, textLen, &status);
+        }
+    }
+    virtual void call(UErrorCode* status){
+        if(decompress){
+            const char* mySrc = bytes;
+            char16_t* myTarget = target;
+            ucnv_toUnicode(conv, &myTarget, target + textLen, &mySrc, bytes + bytesLen, nullptr, true, status);
+        } else {
+            const char16_t* mySrc = text;
+            char* myTarget = bytes;
+            ucnv_fromUnicode(conv, &myTarget, bytes + bytesLen, &mySrc, text + textLen, nullptr, true, status);
+        }
+    }
+    virtual long getOperationsPerIteration(){
+        return textLen * U_SIZEOF_UCHAR;
+    }
+    virtual long getEventsPerIteration(){
+        return bytesLen;
+    }
+    ~ICUCompressionPerfFunction(){
+        free(text);
+        free(bytes);
+        free(target);
+        ucnv_close(conv);
+    }
+};
+
 class ICUOpenAllConvertersFunction : public UPerfFunction{
 private:
     UBool cleanup;
@@ -566,6 +696,61 @@ class  ConverterPerformanceTest : public UPerfTest{
     UPerfFunction* TestWinIML2_ISO2022JP_ToUnicode();
     UPerfFunction* TestWinIML2_ISO2022JP_FromUnicode(); 
 
+    UPerfFunction* TestICU_SJIS_Mixed_ToUnicode();
+    UPerfFunction* TestICU_SJIS_Mixed_FromUnicode();
+    UPerfFunction* TestWinANSI_SJIS_Mixed_ToUnicode();
+    UPerfFunction* TestWinANSI_SJIS_Mixed_FromUnicode();
+    UPerfFunction* TestWinIML2_SJIS_Mixed_ToUnicode();
+    UPerfFunction* TestWinIML2_SJIS_Mixed_FromUnicode();
+
+    UPerfFunction* TestICU_GBK_ToUnicode();
+    UPerfFunction* TestICU_GBK_FromUnicode();
+    UPerfFunction* TestWinANSI_GBK_ToUnicode();
+    UPerfFunction* TestWinANSI_GBK_FromUnicode();
+    UPerfFunction* TestWinIML2_GBK_ToUnicode();
+    UPerfFunction* TestWinIML2_GBK_FromUnicode();
+
+    UPerfFunction* TestICU_EUCKR_ToUnicode();
+    UPerfFunction* TestICU_EUCKR_FromUnicode();
+    UPerfFunction* TestWinANSI_EUCKR_ToUnicode();
+    UPerfFunction* TestWinANSI_EUCKR_FromUnicode();
+    UPerfFunction* TestWinIML2_EUCKR_ToUnicode();
+    UPerfFunction* TestWinIML2_EUCKR_FromUnicode();
+
+    UPerfFunction* TestICU_Windows1252_ToUnicode();
+    UPerfFunction* TestICU_Windows1252_FromUnicode();
+    UPerfFunction* TestWinANSI_Windows1252_ToUnicode();
+    UPerfFunction* TestWinANSI_Windows1252_FromUnicode();
+    UPerfFunction* TestWinIML2_Windows1252_ToUnicode();
+    UPerfFunction* TestWinIML2_Windows1252_FromUnicode();
+
+    UPerfFunction* TestICU_Windows1251_ToUnicode();
+    UPerfFunction* TestICU_Windows1251_FromUnicode();
+    UPerfFunction* TestWinANSI_Windows1251_ToUnicode();
+    UPerfFunction* TestWinANSI_Windows1251_FromUnicode();
+    UPerfFunction* TestWinIML2_Windows1251_ToUnicode();
+    UPerfFunction* TestWinIML2_Windows1251_FromUnicode();
+
+    UPerfFunction* TestICU_SJIS_OpenConvertClose();
+    UPerfFunction* TestICU_SJIS_PooledConvert();
+
+    UPerfFunction* TestICU_SCSU_Cyrillic_Compress();
+    UPerfFunction* TestICU_SCSU_Cyrillic_Decompress();
+    UPerfFunction* TestICU_SCSU_Japanese_Compress();
+    UPerfFunction* TestICU_SCSU_Japanese_Decompress();
+    UPerfFunction* TestICU_SCSU_Korean_Compress();
+    UPerfFunction* TestICU_SCSU_Korean_Decompress();
+    UPerfFunction* TestICU_SCSU_Multilingual_Compress();
+    UPerfFunction* TestICU_SCSU_Multilingual_Decompress();
+    UPerfFunction* TestICU_BOCU1_Cyrillic_Compress();
+    UPerfFunction* TestICU_BOCU1_Cyrillic_Decompress();
+    UPerfFunction* TestICU_BOCU1_Japanese_Compress();
+    UPerfFunction* TestICU_BOCU1_Japanese_Decompress();
+    UPerfFunction* TestICU_BOCU1_Korean_Compress();
+    UPerfFunction* TestICU_BOCU1_Korean_Decompress();
+    UPerfFunction* TestICU_BOCU1_Multilingual_Compress();
+    UPerfFunction* TestICU_BOCU1_Multilingual_Decompress();
+
 };
 
 #endif
@@ -2731,5 +2731,983 @@ unsigned char utf8_encSmSource[]={
     0xE3,0x80,0x80,0xE3,0x80,0x81,0xE3,0x80,0x82,0x20,0xEF,0xBC,0x8E,0xE3,0x83,0xBB,
     0xEF,0xBC,0x9A,0xEF,0xBC,0x9B,0x0D,0x0A
 };
+WCHAR sjis_mixed_uniSource[]={
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x65E5,0x672C,0x8A9E,0x0020,
+    0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x6771,0x4EAC,0x90FD,0x0020,
+    0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,
+    0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,
+    0x0022,0x003E,0x6587,0x5B57,0x30B3,0x30FC,0x30C9,0x0020,0x003C,0x002F,
+    0x0061,0x003E,0x0020,0x5909,0x63DB,0x0020,0x0049,0x0074,0x0065,0x006D,
+    0x0020,0x0034,0x0032,0x003A,0x0020,0x30C6,0x30B9,0x30C8,0x0020,0x0073,
+    0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x3072,
+    0x3089,0x304C,0x306A,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,
+    0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0x65E5,
+    0x672C,0x8A9E,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0x6771,0x4EAC,
+    0x90FD,0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,
+    0x0031,0x002E,0x0030,0x003B,0x0020,0x6587,0x5B57,0x30B3,0x30FC,0x30C9,
+    0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,
+    0x5909,0x63DB,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,
+    0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x30C6,
+    0x30B9,0x30C8,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x3072,
+    0x3089,0x304C,0x306A,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,
+    0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,
+    0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x65E5,0x672C,0x8A9E,0x0020,
+    0x003C,0x002F,0x0061,0x003E,0x0020,0x6771,0x4EAC,0x90FD,0x0020,0x0049,
+    0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x6587,0x5B57,
+    0x30B3,0x30FC,0x30C9,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,
+    0x0073,0x006F,0x002C,0x0020,0x5909,0x63DB,0x0020,0x003C,0x0074,0x0064,
+    0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,
+    0x0074,0x003E,0x30C6,0x30B9,0x30C8,0x0020,0x003C,0x002F,0x0074,0x0064,
+    0x003E,0x3072,0x3089,0x304C,0x306A,0x0020,0x0056,0x0065,0x0072,0x0073,
+    0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x65E5,
+    0x672C,0x8A9E,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,
+    0x0034,0x0020,0x6771,0x4EAC,0x90FD,0x0020,0x003C,0x0070,0x0020,0x0063,
+    0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,
+    0x0022,0x003E,0x6587,0x5B57,0x30B3,0x30FC,0x30C9,0x0020,0x003C,0x002F,
+    0x0070,0x003E,0x000D,0x000A,0x5909,0x63DB,0x0020,0x003C,0x0061,0x0020,
+    0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,
+    0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x30C6,
+    0x30B9,0x30C8,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x3072,0x3089,
+    0x304C,0x306A,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,
+    0x003A,0x0020,0x65E5,0x672C,0x8A9E,0x0020,0x0073,0x0065,0x0065,0x0020,
+    0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x6771,0x4EAC,0x90FD,0x0020,
+    0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,
+    0x006C,0x0065,0x0066,0x0074,0x003E,0x6587,0x5B57,0x30B3,0x30FC,0x30C9,
+    0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0x5909,0x63DB,0x0020,0x0056,
+    0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,
+    0x003B,0x0020,0x30C6,0x30B9,0x30C8,0x0020,0x0028,0x0063,0x0029,0x0020,
+    0x0032,0x0030,0x0032,0x0034,0x0020,0x3072,0x3089,0x304C,0x306A,0x0020,
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x65E5,0x672C,0x8A9E,0x0020,
+    0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x6771,0x4EAC,0x90FD,0x0020,
+    0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,
+    0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,
+    0x0022,0x003E,0x6587,0x5B57,0x30B3,0x30FC,0x30C9,0x0020,0x003C,0x002F,
+    0x0061,0x003E,0x0020,0x5909,0x63DB,0x0020,0x0049,0x0074,0x0065,0x006D,
+    0x0020,0x0034,0x0032,0x003A,0x0020,0x30C6,0x30B9,0x30C8,0x0020,0x0073,
+    0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x3072,
+    0x3089,0x304C,0x306A,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,
+    0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0x65E5,
+    0x672C,0x8A9E,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0x6771,0x4EAC,
+    0x90FD,0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,
+    0x0031,0x002E,0x0030,0x003B,0x0020,0x6587,0x5B57,0x30B3,0x30FC,0x30C9,
+    0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,
+    0x5909,0x63DB,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,
+    0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x30C6,
+    0x30B9,0x30C8,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x3072,
+    0x3089,0x304C,0x306A,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,
+    0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,
+    0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x65E5,0x672C,0x8A9E,0x0020,
+    0x003C,0x002F,0x0061,0x003E,0x0020,0x6771,0x4EAC,0x90FD,0x0020,0x0049,
+    0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x6587,0x5B57,
+    0x30B3,0x30FC,0x30C9,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,
+    0x0073,0x006F,0x002C,0x0020,0x5909,0x63DB,0x0020,0x003C,0x0074,0x0064,
+    0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,
+    0x0074,0x003E,0x30C6,0x30B9,0x30C8,0x0020,0x003C,0x002F,0x0074,0x0064,
+    0x003E,0x3072,0x3089,0x304C,0x306A,0x0020,0x0056,0x0065,0x0072,0x0073,
+    0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x65E5,
+    0x672C,0x8A9E,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,
+    0x0034,0x0020,0x6771,0x4EAC,0x90FD,0x0020,0x003C,0x0070,0x0020,0x0063,
+    0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,
+    0x0022,0x003E,0x6587,0x5B57,0x30B3,0x30FC,0x30C9,0x0020,0x003C,0x002F,
+    0x0070,0x003E,0x000D,0x000A,0x5909,0x63DB,0x0020,0x003C,0x0061,0x0020,
+    0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,
+    0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x30C6,
+    0x30B9,0x30C8,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x3072,0x3089,
+    0x304C,0x306A,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,
+    0x003A,0x0020,0x65E5,0x672C,0x8A9E,0x0020,0x0073,0x0065,0x0065,0x0020,
+    0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x6771,0x4EAC,0x90FD,0x0020,
+    0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,
+    0x006C,0x0065,0x0066,0x0074,0x003E,0x6587,0x5B57,0x30B3,0x30FC,0x30C9,
+    0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0x5909,0x63DB,0x0020,0x0056,
+    0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,
+    0x003B,0x0020,0x30C6,0x30B9,0x30C8,0x0020,0x0028,0x0063,0x0029,0x0020,
+    0x0032,0x0030,0x0032,0x0034,0x0020,0x3072,0x3089,0x304C,0x306A,0x0020,
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x65E5,0x672C,0x8A9E,0x0020,
+    0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x6771,0x4EAC,0x90FD,0x0020,
+    0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,
+    0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,
+    0x0022,0x003E,0x6587,0x5B57,0x30B3,0x30FC,0x30C9,0x0020,0x003C,0x002F,
+    0x0061,0x003E,0x0020,0x5909,0x63DB,0x0020,0x0049,0x0074,0x0065,0x006D,
+    0x0020,0x0034,0x0032,0x003A,0x0020,0x30C6,0x30B9,0x30C8,0x0020,0x0073,
+    0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x3072,
+    0x3089,0x304C,0x306A,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,
+    0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0x65E5,
+    0x672C,0x8A9E,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0x6771,0x4EAC,
+    0x90FD,0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,
+    0x0031,0x002E,0x0030,0x003B,0x0020,0x6587,0x5B57,0x30B3,0x30FC,0x30C9,
+    0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,
+    0x5909,0x63DB,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,
+    0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x30C6,
+    0x30B9,0x30C8,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x3072,
+    0x3089,0x304C,0x306A,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,
+    0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,
+    0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x65E5,0x672C,0x8A9E,0x0020,
+    0x003C,0x002F,0x0061,0x003E,0x0020,0x6771,0x4EAC,0x90FD,0x0020,0x0049,
+    0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x6587,0x5B57,
+    0x30B3,0x30FC,0x30C9,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,
+    0x0073,0x006F,0x002C,0x0020,0x5909,0x63DB,0x0020,0x003C,0x0074,0x0064,
+    0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,
+    0x0074,0x003E,0x30C6,0x30B9,0x30C8,0x0020,0x003C,0x002F,0x0074,0x0064,
+    0x003E,0x3072,0x3089,0x304C,0x306A,0x0020,0x0056,0x0065,0x0072,0x0073,
+    0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x65E5,
+    0x672C,0x8A9E,0x0020
+};
+
+unsigned char sjis_mixed_encSource[]={
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0x93,0xFA,0x96,0x7B,
+    0x8C,0xEA,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x20,0x3C,0x61,0x20,0x68,
+    0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0x95,0xB6,
+    0x8E,0x9A,0x83,0x52,0x81,0x5B,0x83,0x68,0x20,0x3C,0x2F,0x61,0x3E,0x20,0x95,0xCF,0x8A,0xB7,0x20,0x49,
+    0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0x83,0x65,0x83,0x58,0x83,0x67,0x20,0x73,0x65,0x65,0x20,0x61,
+    0x6C,0x73,0x6F,0x2C,0x20,0x82,0xD0,0x82,0xE7,0x82,0xAA,0x82,0xC8,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,
+    0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0x93,0xFA,0x96,0x7B,0x8C,0xEA,0x20,0x3C,0x2F,0x74,0x64,
+    0x3E,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,
+    0x20,0x95,0xB6,0x8E,0x9A,0x83,0x52,0x81,0x5B,0x83,0x68,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,
+    0x20,0x95,0xCF,0x8A,0xB7,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,
+    0x22,0x3E,0x83,0x65,0x83,0x58,0x83,0x67,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x82,0xD0,0x82,0xE7,0x82,
+    0xAA,0x82,0xC8,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,
+    0x68,0x74,0x6D,0x6C,0x22,0x3E,0x93,0xFA,0x96,0x7B,0x8C,0xEA,0x20,0x3C,0x2F,0x61,0x3E,0x20,0x93,0x8C,
+    0x8B,0x9E,0x93,0x73,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0x95,0xB6,0x8E,0x9A,0x83,0x52,
+    0x81,0x5B,0x83,0x68,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x95,0xCF,0x8A,0xB7,0x20,
+    0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0x83,0x65,0x83,0x58,0x83,
+    0x67,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x82,0xD0,0x82,0xE7,0x82,0xAA,0x82,0xC8,0x20,0x56,0x65,0x72,0x73,
+    0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0x93,0xFA,0x96,0x7B,0x8C,0xEA,0x20,0x28,0x63,0x29,0x20,
+    0x32,0x30,0x32,0x34,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,
+    0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0x95,0xB6,0x8E,0x9A,0x83,0x52,0x81,0x5B,0x83,0x68,0x20,0x3C,
+    0x2F,0x70,0x3E,0x0D,0x0A,0x95,0xCF,0x8A,0xB7,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,
+    0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0x83,0x65,0x83,0x58,0x83,0x67,0x20,0x3C,
+    0x2F,0x61,0x3E,0x20,0x82,0xD0,0x82,0xE7,0x82,0xAA,0x82,0xC8,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,
+    0x3A,0x20,0x93,0xFA,0x96,0x7B,0x8C,0xEA,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x93,
+    0x8C,0x8B,0x9E,0x93,0x73,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,
+    0x3E,0x95,0xB6,0x8E,0x9A,0x83,0x52,0x81,0x5B,0x83,0x68,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x95,0xCF,0x8A,
+    0xB7,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0x83,0x65,0x83,0x58,0x83,
+    0x67,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0x82,0xD0,0x82,0xE7,0x82,0xAA,0x82,0xC8,0x20,
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0x93,0xFA,0x96,0x7B,
+    0x8C,0xEA,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x20,0x3C,0x61,0x20,0x68,
+    0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0x95,0xB6,
+    0x8E,0x9A,0x83,0x52,0x81,0x5B,0x83,0x68,0x20,0x3C,0x2F,0x61,0x3E,0x20,0x95,0xCF,0x8A,0xB7,0x20,0x49,
+    0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0x83,0x65,0x83,0x58,0x83,0x67,0x20,0x73,0x65,0x65,0x20,0x61,
+    0x6C,0x73,0x6F,0x2C,0x20,0x82,0xD0,0x82,0xE7,0x82,0xAA,0x82,0xC8,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,
+    0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0x93,0xFA,0x96,0x7B,0x8C,0xEA,0x20,0x3C,0x2F,0x74,0x64,
+    0x3E,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,
+    0x20,0x95,0xB6,0x8E,0x9A,0x83,0x52,0x81,0x5B,0x83,0x68,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,
+    0x20,0x95,0xCF,0x8A,0xB7,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,
+    0x22,0x3E,0x83,0x65,0x83,0x58,0x83,0x67,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x82,0xD0,0x82,0xE7,0x82,
+    0xAA,0x82,0xC8,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,
+    0x68,0x74,0x6D,0x6C,0x22,0x3E,0x93,0xFA,0x96,0x7B,0x8C,0xEA,0x20,0x3C,0x2F,0x61,0x3E,0x20,0x93,0x8C,
+    0x8B,0x9E,0x93,0x73,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0x95,0xB6,0x8E,0x9A,0x83,0x52,
+    0x81,0x5B,0x83,0x68,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x95,0xCF,0x8A,0xB7,0x20,
+    0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0x83,0x65,0x83,0x58,0x83,
+    0x67,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x82,0xD0,0x82,0xE7,0x82,0xAA,0x82,0xC8,0x20,0x56,0x65,0x72,0x73,
+    0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0x93,0xFA,0x96,0x7B,0x8C,0xEA,0x20,0x28,0x63,0x29,0x20,
+    0x32,0x30,0x32,0x34,0x20,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,
+    0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0x95,0xB6,0x8E,0x9A,0x83,0x52,0x81,0x5B,0x83,0x68,0x20,0x3C,
+    0x2F,0x70,0x3E,0x0D,0x0A,0x95,0xCF,0x8A,0xB7,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,
+    0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0x83,0x65,0x83,0x58,0x83,0x67,0x20,0x3C,
+    0x2F,0x61,0x3E,0x20,0x82,0xD0,0x82,0xE7,0x82,0xAA,0x82,0xC8,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,
+    0x3A,0x20,0x93,0xFA,0x96,0x7B,0x8C,0xEA,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x93,
+    0x8C,0x8B,0x9E,0x93,0x73,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,
+    0x3E,0x95,0xB6,0x8E,0x9A,0x83,0x52,0x81,0x5B,0x83,0x68,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x95,0xCF,0x8A,
+    0xB7,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0x83,0x65,0x83,0x58,0x83,
+    0x67,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0x82,0xD0,0x82,0xE7,0x82,0xAA,0x82,0xC8,0x20,
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0x93,0xFA,0x96,0x7B,
+    0x8C,0xEA,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x20,0x3C,0x61,0x20,0x68,
+    0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0x95,0xB6,
+    0x8E,0x9A,0x83,0x52,0x81,0x5B,0x83,0x68,0x20,0x3C,0x2F,0x61,0x3E,0x20,0x95,0xCF,0x8A,0xB7,0x20,0x49,
+    0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0x83,0x65,0x83,0x58,0x83,0x67,0x20,0x73,0x65,0x65,0x20,0x61,
+    0x6C,0x73,0x6F,0x2C,0x20,0x82,0xD0,0x82,0xE7,0x82,0xAA,0x82,0xC8,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,
+    0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0x93,0xFA,0x96,0x7B,0x8C,0xEA,0x20,0x3C,0x2F,0x74,0x64,
+    0x3E,0x93,0x8C,0x8B,0x9E,0x93,0x73,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,
+    0x20,0x95,0xB6,0x8E,0x9A,0x83,0x52,0x81,0x5B,0x83,0x68,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,
+    0x20,0x95,0xCF,0x8A,0xB7,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,
+    0x22,0x3E,0x83,0x65,0x83,0x58,0x83,0x67,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x82,0xD0,0x82,0xE7,0x82,
+    0xAA,0x82,0xC8,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,
+    0x68,0x74,0x6D,0x6C,0x22,0x3E,0x93,0xFA,0x96,0x7B,0x8C,0xEA,0x20,0x3C,0x2F,0x61,0x3E,0x20,0x93,0x8C,
+    0x8B,0x9E,0x93,0x73,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0x95,0xB6,0x8E,0x9A,0x83,0x52,
+    0x81,0x5B,0x83,0x68,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x95,0xCF,0x8A,0xB7,0x20,
+    0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0x83,0x65,0x83,0x58,0x83,
+    0x67,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x82,0xD0,0x82,0xE7,0x82,0xAA,0x82,0xC8,0x20,0x56,0x65,0x72,0x73,
+    0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0x93,0xFA,0x96,0x7B,0x8C,0xEA,0x20
+};
+
+WCHAR gbk_uniSource[]={
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x4E2D,0x6587,0x0020,0x003C,
+    0x002F,0x0070,0x003E,0x000D,0x000A,0x5B57,0x7B26,0x96C6,0x0020,0x003C,
+    0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,
+    0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,
+    0x003E,0x8F6C,0x6362,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x5317,
+    0x4EAC,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,
+    0x0020,0x7B80,0x4F53,0x5B57,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,
+    0x006C,0x0073,0x006F,0x002C,0x0020,0x6E2C,0x8A66,0x0020,0x003C,0x0074,
+    0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,
+    0x0066,0x0074,0x003E,0x4E2D,0x6587,0x0020,0x003C,0x002F,0x0074,0x0064,
+    0x003E,0x5B57,0x7B26,0x96C6,0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,
+    0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x8F6C,0x6362,
+    0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,
+    0x5317,0x4EAC,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,
+    0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x7B80,
+    0x4F53,0x5B57,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x6E2C,
+    0x8A66,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,
+    0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,
+    0x006D,0x006C,0x0022,0x003E,0x4E2D,0x6587,0x0020,0x003C,0x002F,0x0061,
+    0x003E,0x0020,0x5B57,0x7B26,0x96C6,0x0020,0x0049,0x0074,0x0065,0x006D,
+    0x0020,0x0034,0x0032,0x003A,0x0020,0x8F6C,0x6362,0x0020,0x0073,0x0065,
+    0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x5317,0x4EAC,
+    0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,
+    0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0x7B80,0x4F53,0x5B57,0x0020,
+    0x003C,0x002F,0x0074,0x0064,0x003E,0x6E2C,0x8A66,0x0020,0x0056,0x0065,
+    0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,
+    0x0020,0x4E2D,0x6587,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,
+    0x0032,0x0034,0x0020,0x5B57,0x7B26,0x96C6,0x0020,0x003C,0x0070,0x0020,
+    0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,
+    0x0074,0x0022,0x003E,0x8F6C,0x6362,0x0020,0x003C,0x002F,0x0070,0x003E,
+    0x000D,0x000A,0x5317,0x4EAC,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,
+    0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,
+    0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x7B80,0x4F53,0x5B57,
+    0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x6E2C,0x8A66,0x0020,0x0049,
+    0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x4E2D,0x6587,
+    0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,
+    0x0020,0x5B57,0x7B26,0x96C6,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,
+    0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,
+    0x8F6C,0x6362,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0x5317,0x4EAC,
+    0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,
+    0x002E,0x0030,0x003B,0x0020,0x7B80,0x4F53,0x5B57,0x0020,0x0028,0x0063,
+    0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0x6E2C,0x8A66,0x0020,
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x4E2D,0x6587,0x0020,0x003C,
+    0x002F,0x0070,0x003E,0x000D,0x000A,0x5B57,0x7B26,0x96C6,0x0020,0x003C,
+    0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,
+    0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,
+    0x003E,0x8F6C,0x6362,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x5317,
+    0x4EAC,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,
+    0x0020,0x7B80,0x4F53,0x5B57,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,
+    0x006C,0x0073,0x006F,0x002C,0x0020,0x6E2C,0x8A66,0x0020,0x003C,0x0074,
+    0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,
+    0x0066,0x0074,0x003E,0x4E2D,0x6587,0x0020,0x003C,0x002F,0x0074,0x0064,
+    0x003E,0x5B57,0x7B26,0x96C6,0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,
+    0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x8F6C,0x6362,
+    0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,
+    0x5317,0x4EAC,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,
+    0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x7B80,
+    0x4F53,0x5B57,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x6E2C,
+    0x8A66,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,
+    0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,
+    0x006D,0x006C,0x0022,0x003E,0x4E2D,0x6587,0x0020,0x003C,0x002F,0x0061,
+    0x003E,0x0020,0x5B57,0x7B26,0x96C6,0x0020,0x0049,0x0074,0x0065,0x006D,
+    0x0020,0x0034,0x0032,0x003A,0x0020,0x8F6C,0x6362,0x0020,0x0073,0x0065,
+    0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x5317,0x4EAC,
+    0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,
+    0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0x7B80,0x4F53,0x5B57,0x0020,
+    0x003C,0x002F,0x0074,0x0064,0x003E,0x6E2C,0x8A66,0x0020,0x0056,0x0065,
+    0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,
+    0x0020,0x4E2D,0x6587,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,
+    0x0032,0x0034,0x0020,0x5B57,0x7B26,0x96C6,0x0020,0x003C,0x0070,0x0020,
+    0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,
+    0x0074,0x0022,0x003E,0x8F6C,0x6362,0x0020,0x003C,0x002F,0x0070,0x003E,
+    0x000D,0x000A,0x5317,0x4EAC,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,
+    0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,
+    0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x7B80,0x4F53,0x5B57,
+    0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x6E2C,0x8A66,0x0020,0x0049,
+    0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x4E2D,0x6587,
+    0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,
+    0x0020,0x5B57,0x7B26,0x96C6,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,
+    0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,
+    0x8F6C,0x6362,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0x5317,0x4EAC,
+    0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,
+    0x002E,0x0030,0x003B,0x0020,0x7B80,0x4F53,0x5B57,0x0020,0x0028,0x0063,
+    0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0x6E2C,0x8A66,0x0020,
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x4E2D,0x6587,0x0020,0x003C,
+    0x002F,0x0070,0x003E,0x000D,0x000A,0x5B57,0x7B26,0x96C6,0x0020,0x003C,
+    0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,
+    0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,
+    0x003E,0x8F6C,0x6362,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x5317,
+    0x4EAC,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,
+    0x0020,0x7B80,0x4F53,0x5B57,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,
+    0x006C,0x0073,0x006F,0x002C,0x0020,0x6E2C,0x8A66,0x0020,0x003C,0x0074,
+    0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,
+    0x0066,0x0074,0x003E,0x4E2D,0x6587,0x0020,0x003C,0x002F,0x0074,0x0064,
+    0x003E,0x5B57,0x7B26,0x96C6,0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,
+    0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x8F6C,0x6362,
+    0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,
+    0x5317,0x4EAC,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,
+    0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x7B80,
+    0x4F53,0x5B57,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x6E2C,
+    0x8A66,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,
+    0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,
+    0x006D,0x006C,0x0022,0x003E,0x4E2D,0x6587,0x0020,0x003C,0x002F,0x0061,
+    0x003E,0x0020,0x5B57,0x7B26,0x96C6,0x0020,0x0049,0x0074,0x0065,0x006D,
+    0x0020,0x0034,0x0032,0x003A,0x0020,0x8F6C,0x6362,0x0020,0x0073,0x0065,
+    0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x5317,0x4EAC,
+    0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,
+    0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0x7B80,0x4F53,0x5B57,0x0020,
+    0x003C,0x002F,0x0074,0x0064,0x003E,0x6E2C,0x8A66,0x0020,0x0056,0x0065,
+    0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,
+    0x0020,0x4E2D,0x6587,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,
+    0x0032,0x0034,0x0020,0x5B57,0x7B26,0x96C6,0x0020,0x003C,0x0070,0x0020,
+    0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,
+    0x0074,0x0022,0x003E,0x8F6C,0x6362,0x0020,0x003C,0x002F,0x0070,0x003E,
+    0x000D,0x000A,0x5317,0x4EAC,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,
+    0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,
+    0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x7B80,0x4F53,0x5B57,
+    0x0020
+};
+
+unsigned char gbk_encSource[]={
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xD6,0xD0,0xCE,0xC4,
+    0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,
+    0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xD7,0xAA,0xBB,0xBB,
+    0x20,0x3C,0x2F,0x61,0x3E,0x20,0xB1,0xB1,0xBE,0xA9,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,
+    0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x9C,0x79,0xD4,
+    0x87,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xD6,0xD0,0xCE,
+    0xC4,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,
+    0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xD7,0xAA,0xBB,0xBB,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,
+    0x20,0xB1,0xB1,0xBE,0xA9,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,
+    0x22,0x3E,0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x9C,0x79,0xD4,0x87,0x20,
+    0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,
+    0x22,0x3E,0xD6,0xD0,0xCE,0xC4,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x49,
+    0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xD7,0xAA,0xBB,0xBB,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,
+    0x6F,0x2C,0x20,0xB1,0xB1,0xBE,0xA9,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,
+    0x66,0x74,0x3E,0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x9C,0x79,0xD4,0x87,0x20,
+    0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xD6,0xD0,0xCE,0xC4,0x20,0x28,0x63,
+    0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,
+    0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xD7,0xAA,0xBB,0xBB,0x20,0x3C,0x2F,0x70,0x3E,0x0D,
+    0x0A,0xB1,0xB1,0xBE,0xA9,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,
+    0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x3C,0x2F,0x61,0x3E,0x20,
+    0x9C,0x79,0xD4,0x87,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xD6,0xD0,0xCE,0xC4,0x20,0x73,
+    0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x3C,0x74,0x64,0x20,
+    0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xD7,0xAA,0xBB,0xBB,0x20,0x3C,0x2F,0x74,0x64,
+    0x3E,0xB1,0xB1,0xBE,0xA9,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xBC,
+    0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0x9C,0x79,0xD4,0x87,0x20,
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xD6,0xD0,0xCE,0xC4,
+    0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,
+    0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xD7,0xAA,0xBB,0xBB,
+    0x20,0x3C,0x2F,0x61,0x3E,0x20,0xB1,0xB1,0xBE,0xA9,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,
+    0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x9C,0x79,0xD4,
+    0x87,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xD6,0xD0,0xCE,
+    0xC4,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,
+    0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xD7,0xAA,0xBB,0xBB,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,
+    0x20,0xB1,0xB1,0xBE,0xA9,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,
+    0x22,0x3E,0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x9C,0x79,0xD4,0x87,0x20,
+    0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,
+    0x22,0x3E,0xD6,0xD0,0xCE,0xC4,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x49,
+    0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xD7,0xAA,0xBB,0xBB,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,
+    0x6F,0x2C,0x20,0xB1,0xB1,0xBE,0xA9,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,
+    0x66,0x74,0x3E,0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x9C,0x79,0xD4,0x87,0x20,
+    0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xD6,0xD0,0xCE,0xC4,0x20,0x28,0x63,
+    0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,
+    0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xD7,0xAA,0xBB,0xBB,0x20,0x3C,0x2F,0x70,0x3E,0x0D,
+    0x0A,0xB1,0xB1,0xBE,0xA9,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,
+    0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x3C,0x2F,0x61,0x3E,0x20,
+    0x9C,0x79,0xD4,0x87,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xD6,0xD0,0xCE,0xC4,0x20,0x73,
+    0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x3C,0x74,0x64,0x20,
+    0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xD7,0xAA,0xBB,0xBB,0x20,0x3C,0x2F,0x74,0x64,
+    0x3E,0xB1,0xB1,0xBE,0xA9,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xBC,
+    0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0x9C,0x79,0xD4,0x87,0x20,
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xD6,0xD0,0xCE,0xC4,
+    0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,
+    0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xD7,0xAA,0xBB,0xBB,
+    0x20,0x3C,0x2F,0x61,0x3E,0x20,0xB1,0xB1,0xBE,0xA9,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,
+    0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x9C,0x79,0xD4,
+    0x87,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xD6,0xD0,0xCE,
+    0xC4,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,
+    0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xD7,0xAA,0xBB,0xBB,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,
+    0x20,0xB1,0xB1,0xBE,0xA9,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,
+    0x22,0x3E,0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x9C,0x79,0xD4,0x87,0x20,
+    0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,
+    0x22,0x3E,0xD6,0xD0,0xCE,0xC4,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x49,
+    0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xD7,0xAA,0xBB,0xBB,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,
+    0x6F,0x2C,0x20,0xB1,0xB1,0xBE,0xA9,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,
+    0x66,0x74,0x3E,0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x9C,0x79,0xD4,0x87,0x20,
+    0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xD6,0xD0,0xCE,0xC4,0x20,0x28,0x63,
+    0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xD7,0xD6,0xB7,0xFB,0xBC,0xAF,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,
+    0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xD7,0xAA,0xBB,0xBB,0x20,0x3C,0x2F,0x70,0x3E,0x0D,
+    0x0A,0xB1,0xB1,0xBE,0xA9,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,
+    0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xBC,0xF2,0xCC,0xE5,0xD7,0xD6,0x20
+};
+
+WCHAR euckr_uniSource[]={
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0xD55C,0xAD6D,0xC5B4,0x0020,
+    0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0xBB38,0xC790,0x0020,0x003C,
+    0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,
+    0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,
+    0x003E,0xBCC0,0xD658,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0xC11C,
+    0xC6B8,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,
+    0x0020,0xD14C,0xC2A4,0xD2B8,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,
+    0x006C,0x0073,0x006F,0x002C,0x0020,0xC778,0xCF54,0xB529,0x0020,0x003C,
+    0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,
+    0x0065,0x0066,0x0074,0x003E,0xD55C,0xAD6D,0xC5B4,0x0020,0x003C,0x002F,
+    0x0074,0x0064,0x003E,0xBB38,0xC790,0x0020,0x0056,0x0065,0x0072,0x0073,
+    0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0xBCC0,
+    0xD658,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,
+    0x0020,0xC11C,0xC6B8,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,
+    0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,
+    0xD14C,0xC2A4,0xD2B8,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,
+    0xC778,0xCF54,0xB529,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,
+    0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,
+    0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0xD55C,0xAD6D,0xC5B4,0x0020,
+    0x003C,0x002F,0x0061,0x003E,0x0020,0xBB38,0xC790,0x0020,0x0049,0x0074,
+    0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0xBCC0,0xD658,0x0020,
+    0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,
+    0xC11C,0xC6B8,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,
+    0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0xD14C,0xC2A4,
+    0xD2B8,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0xC778,0xCF54,0xB529,
+    0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,
+    0x002E,0x0030,0x003B,0x0020,0xD55C,0xAD6D,0xC5B4,0x0020,0x0028,0x0063,
+    0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0xBB38,0xC790,0x0020,
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0xBCC0,0xD658,0x0020,0x003C,
+    0x002F,0x0070,0x003E,0x000D,0x000A,0xC11C,0xC6B8,0x0020,0x003C,0x0061,
+    0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,
+    0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,
+    0xD14C,0xC2A4,0xD2B8,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0xC778,
+    0xCF54,0xB529,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,
+    0x003A,0x0020,0xD55C,0xAD6D,0xC5B4,0x0020,0x0073,0x0065,0x0065,0x0020,
+    0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0xBB38,0xC790,0x0020,0x003C,
+    0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,
+    0x0065,0x0066,0x0074,0x003E,0xBCC0,0xD658,0x0020,0x003C,0x002F,0x0074,
+    0x0064,0x003E,0xC11C,0xC6B8,0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,
+    0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0xD14C,0xC2A4,
+    0xD2B8,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,
+    0x0020,0xC778,0xCF54,0xB529,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,
+    0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,
+    0x003E,0xD55C,0xAD6D,0xC5B4,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,
+    0x000A,0xBB38,0xC790,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,
+    0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,
+    0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0xBCC0,0xD658,0x0020,0x003C,
+    0x002F,0x0061,0x003E,0x0020,0xC11C,0xC6B8,0x0020,0x0049,0x0074,0x0065,
+    0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0xD14C,0xC2A4,0xD2B8,0x0020,
+    0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,
+    0xC778,0xCF54,0xB529,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,
+    0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0xD55C,
+    0xAD6D,0xC5B4,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0xBB38,0xC790,
+    0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,
+    0x002E,0x0030,0x003B,0x0020,0xBCC0,0xD658,0x0020,0x0028,0x0063,0x0029,
+    0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0xC11C,0xC6B8,0x0020,0x003C,
+    0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,
+    0x0065,0x0078,0x0074,0x0022,0x003E,0xD14C,0xC2A4,0xD2B8,0x0020,0x003C,
+    0x002F,0x0070,0x003E,0x000D,0x000A,0xC778,0xCF54,0xB529,0x0020,0x003C,
+    0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,
+    0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,
+    0x003E,0xD55C,0xAD6D,0xC5B4,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,
+    0xBB38,0xC790,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,
+    0x003A,0x0020,0xBCC0,0xD658,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,
+    0x006C,0x0073,0x006F,0x002C,0x0020,0xC11C,0xC6B8,0x0020,0x003C,0x0074,
+    0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,
+    0x0066,0x0074,0x003E,0xD14C,0xC2A4,0xD2B8,0x0020,0x003C,0x002F,0x0074,
+    0x0064,0x003E,0xC778,0xCF54,0xB529,0x0020,0x0056,0x0065,0x0072,0x0073,
+    0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0xD55C,
+    0xAD6D,0xC5B4,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,
+    0x0034,0x0020,0xBB38,0xC790,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,
+    0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,
+    0x003E,0xBCC0,0xD658,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,
+    0xC11C,0xC6B8,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,
+    0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,
+    0x0074,0x006D,0x006C,0x0022,0x003E,0xD14C,0xC2A4,0xD2B8,0x0020,0x003C,
+    0x002F,0x0061,0x003E,0x0020,0xC778,0xCF54,0xB529,0x0020,0x0049,0x0074,
+    0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0xD55C,0xAD6D,0xC5B4,
+    0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,
+    0x0020,0xBB38,0xC790,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,
+    0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0xBCC0,
+    0xD658,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0xC11C,0xC6B8,0x0020,
+    0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,
+    0x0030,0x003B,0x0020,0xD14C,0xC2A4,0xD2B8,0x0020,0x0028,0x0063,0x0029,
+    0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0xC778,0xCF54,0xB529,0x0020,
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0xD55C,0xAD6D,0xC5B4,0x0020,
+    0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0xBB38,0xC790,0x0020,0x003C,
+    0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,
+    0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,
+    0x003E,0xBCC0,0xD658,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0xC11C,
+    0xC6B8,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,
+    0x0020,0xD14C,0xC2A4,0xD2B8,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,
+    0x006C,0x0073,0x006F,0x002C,0x0020,0xC778,0xCF54,0xB529,0x0020,0x003C,
+    0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,
+    0x0065,0x0066,0x0074,0x003E,0xD55C,0xAD6D,0xC5B4,0x0020,0x003C,0x002F,
+    0x0074,0x0064,0x003E,0xBB38,0xC790,0x0020,0x0056,0x0065,0x0072,0x0073,
+    0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0xBCC0,
+    0xD658,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,
+    0x0020,0xC11C,0xC6B8,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,
+    0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,
+    0xD14C,0xC2A4,0xD2B8,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,
+    0xC778,0xCF54,0xB529,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,
+    0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,
+    0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0xD55C,0xAD6D,0xC5B4,0x0020,
+    0x003C,0x002F,0x0061,0x003E,0x0020,0xBB38,0xC790,0x0020,0x0049,0x0074,
+    0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0xBCC0,0xD658,0x0020,
+    0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,
+    0xC11C,0xC6B8,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,
+    0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0xD14C,0xC2A4,
+    0xD2B8,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0xC778,0xCF54,0xB529,
+    0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,
+    0x002E,0x0030,0x003B,0x0020,0xD55C,0xAD6D,0xC5B4,0x0020,0x0028,0x0063,
+    0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0xBB38,0xC790,0x0020,
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0xBCC0,0xD658,0x0020,0x003C,
+    0x002F,0x0070,0x003E,0x000D,0x000A,0xC11C,0xC6B8,0x0020,0x003C,0x0061,
+    0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,
+    0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,
+    0xD14C,0xC2A4,0xD2B8,0x0020
+};
+
+unsigned char euckr_encSource[]={
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xC7,0xD1,0xB1,0xB9,
+    0xBE,0xEE,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xB9,0xAE,0xC0,0xDA,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,
+    0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xBA,0xAF,0xC8,0xAF,
+    0x20,0x3C,0x2F,0x61,0x3E,0x20,0xBC,0xAD,0xBF,0xEF,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,
+    0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xC0,0xCE,0xC4,
+    0xDA,0xB5,0xF9,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xC7,
+    0xD1,0xB1,0xB9,0xBE,0xEE,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xB9,0xAE,0xC0,0xDA,0x20,0x56,0x65,0x72,0x73,
+    0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xBA,0xAF,0xC8,0xAF,0x20,0x28,0x63,0x29,0x20,0x32,0x30,
+    0x32,0x34,0x20,0xBC,0xAD,0xBF,0xEF,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,
+    0x78,0x74,0x22,0x3E,0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xC0,0xCE,0xC4,
+    0xDA,0xB5,0xF9,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,
+    0x68,0x74,0x6D,0x6C,0x22,0x3E,0xC7,0xD1,0xB1,0xB9,0xBE,0xEE,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xB9,0xAE,
+    0xC0,0xDA,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xBA,0xAF,0xC8,0xAF,0x20,0x73,0x65,0x65,
+    0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xBC,0xAD,0xBF,0xEF,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,
+    0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xC0,
+    0xCE,0xC4,0xDA,0xB5,0xF9,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xC7,
+    0xD1,0xB1,0xB9,0xBE,0xEE,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xB9,0xAE,0xC0,0xDA,0x20,
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xBA,0xAF,0xC8,0xAF,
+    0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xBC,0xAD,0xBF,0xEF,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,
+    0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,
+    0x20,0x3C,0x2F,0x61,0x3E,0x20,0xC0,0xCE,0xC4,0xDA,0xB5,0xF9,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,
+    0x3A,0x20,0xC7,0xD1,0xB1,0xB9,0xBE,0xEE,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xB9,
+    0xAE,0xC0,0xDA,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xBA,
+    0xAF,0xC8,0xAF,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xBC,0xAD,0xBF,0xEF,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,
+    0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,0x20,0x28,0x63,0x29,0x20,0x32,0x30,
+    0x32,0x34,0x20,0xC0,0xCE,0xC4,0xDA,0xB5,0xF9,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,
+    0x74,0x65,0x78,0x74,0x22,0x3E,0xC7,0xD1,0xB1,0xB9,0xBE,0xEE,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xB9,
+    0xAE,0xC0,0xDA,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,
+    0x68,0x74,0x6D,0x6C,0x22,0x3E,0xBA,0xAF,0xC8,0xAF,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xBC,0xAD,0xBF,0xEF,
+    0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,0x20,0x73,0x65,0x65,
+    0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xC0,0xCE,0xC4,0xDA,0xB5,0xF9,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,
+    0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xC7,0xD1,0xB1,0xB9,0xBE,0xEE,0x20,0x3C,0x2F,0x74,0x64,
+    0x3E,0xB9,0xAE,0xC0,0xDA,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xBA,
+    0xAF,0xC8,0xAF,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xBC,0xAD,0xBF,0xEF,0x20,0x3C,0x70,
+    0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,
+    0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xC0,0xCE,0xC4,0xDA,0xB5,0xF9,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,
+    0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xC7,0xD1,0xB1,0xB9,
+    0xBE,0xEE,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xB9,0xAE,0xC0,0xDA,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,
+    0x3A,0x20,0xBA,0xAF,0xC8,0xAF,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xBC,0xAD,0xBF,
+    0xEF,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xC5,0xD7,0xBD,
+    0xBA,0xC6,0xAE,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xC0,0xCE,0xC4,0xDA,0xB5,0xF9,0x20,0x56,0x65,0x72,0x73,
+    0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xC7,0xD1,0xB1,0xB9,0xBE,0xEE,0x20,0x28,0x63,0x29,0x20,
+    0x32,0x30,0x32,0x34,0x20,0xB9,0xAE,0xC0,0xDA,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,
+    0x74,0x65,0x78,0x74,0x22,0x3E,0xBA,0xAF,0xC8,0xAF,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xBC,0xAD,0xBF,
+    0xEF,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,
+    0x6D,0x6C,0x22,0x3E,0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xC0,0xCE,0xC4,0xDA,
+    0xB5,0xF9,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xC7,0xD1,0xB1,0xB9,0xBE,0xEE,0x20,0x73,
+    0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xB9,0xAE,0xC0,0xDA,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,
+    0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xBA,0xAF,0xC8,0xAF,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xBC,
+    0xAD,0xBF,0xEF,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xC5,0xD7,0xBD,
+    0xBA,0xC6,0xAE,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xC0,0xCE,0xC4,0xDA,0xB5,0xF9,0x20,
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xC7,0xD1,0xB1,0xB9,
+    0xBE,0xEE,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xB9,0xAE,0xC0,0xDA,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,
+    0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xBA,0xAF,0xC8,0xAF,
+    0x20,0x3C,0x2F,0x61,0x3E,0x20,0xBC,0xAD,0xBF,0xEF,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,
+    0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xC0,0xCE,0xC4,
+    0xDA,0xB5,0xF9,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xC7,
+    0xD1,0xB1,0xB9,0xBE,0xEE,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xB9,0xAE,0xC0,0xDA,0x20,0x56,0x65,0x72,0x73,
+    0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xBA,0xAF,0xC8,0xAF,0x20,0x28,0x63,0x29,0x20,0x32,0x30,
+    0x32,0x34,0x20,0xBC,0xAD,0xBF,0xEF,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,
+    0x78,0x74,0x22,0x3E,0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xC0,0xCE,0xC4,
+    0xDA,0xB5,0xF9,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,
+    0x68,0x74,0x6D,0x6C,0x22,0x3E,0xC7,0xD1,0xB1,0xB9,0xBE,0xEE,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xB9,0xAE,
+    0xC0,0xDA,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xBA,0xAF,0xC8,0xAF,0x20,0x73,0x65,0x65,
+    0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xBC,0xAD,0xBF,0xEF,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,
+    0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xC0,
+    0xCE,0xC4,0xDA,0xB5,0xF9,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xC7,
+    0xD1,0xB1,0xB9,0xBE,0xEE,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xB9,0xAE,0xC0,0xDA,0x20,
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xBA,0xAF,0xC8,0xAF,
+    0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xBC,0xAD,0xBF,0xEF,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,
+    0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xC5,0xD7,0xBD,0xBA,0xC6,0xAE,
+    0x20
+};
+
+WCHAR windows1252_uniSource[]={
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x0063,0x0061,0x0066,0x00E9,
+    0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x006E,0x0061,0x00EF,
+    0x0076,0x0065,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,
+    0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,
+    0x0074,0x006D,0x006C,0x0022,0x003E,0x004D,0x00FC,0x006C,0x006C,0x0065,
+    0x0072,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x20AC,0x0035,0x0020,
+    0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x0072,
+    0x00E9,0x0073,0x0075,0x006D,0x00E9,0x0020,0x0073,0x0065,0x0065,0x0020,
+    0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x201C,0x0071,0x0075,0x006F,
+    0x0074,0x0065,0x0064,0x201D,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,
+    0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,
+    0x0063,0x0061,0x0066,0x00E9,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,
+    0x006E,0x0061,0x00EF,0x0076,0x0065,0x0020,0x0056,0x0065,0x0072,0x0073,
+    0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x004D,
+    0x00FC,0x006C,0x006C,0x0065,0x0072,0x0020,0x0028,0x0063,0x0029,0x0020,
+    0x0032,0x0030,0x0032,0x0034,0x0020,0x20AC,0x0035,0x0020,0x003C,0x0070,
+    0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,
+    0x0078,0x0074,0x0022,0x003E,0x0072,0x00E9,0x0073,0x0075,0x006D,0x00E9,
+    0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x201C,0x0071,0x0075,
+    0x006F,0x0074,0x0065,0x0064,0x201D,0x0020,0x003C,0x0061,0x0020,0x0068,
+    0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,
+    0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x0063,0x0061,
+    0x0066,0x00E9,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x006E,0x0061,
+    0x00EF,0x0076,0x0065,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,
+    0x0032,0x003A,0x0020,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x0020,
+    0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,
+    0x20AC,0x0035,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,
+    0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0x0072,0x00E9,
+    0x0073,0x0075,0x006D,0x00E9,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,
+    0x201C,0x0071,0x0075,0x006F,0x0074,0x0065,0x0064,0x201D,0x0020,0x0056,
+    0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,
+    0x003B,0x0020,0x0063,0x0061,0x0066,0x00E9,0x0020,0x0028,0x0063,0x0029,
+    0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0x006E,0x0061,0x00EF,0x0076,
+    0x0065,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,
+    0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x004D,0x00FC,
+    0x006C,0x006C,0x0065,0x0072,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,
+    0x000A,0x20AC,0x0035,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,
+    0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,
+    0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x0072,0x00E9,0x0073,0x0075,
+    0x006D,0x00E9,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x201C,0x0071,
+    0x0075,0x006F,0x0074,0x0065,0x0064,0x201D,0x0020,0x0049,0x0074,0x0065,
+    0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x0063,0x0061,0x0066,0x00E9,
+    0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,
+    0x0020,0x006E,0x0061,0x00EF,0x0076,0x0065,0x0020,0x003C,0x0074,0x0064,
+    0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,
+    0x0074,0x003E,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x0020,0x003C,
+    0x002F,0x0074,0x0064,0x003E,0x20AC,0x0035,0x0020,0x0056,0x0065,0x0072,
+    0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,
+    0x0072,0x00E9,0x0073,0x0075,0x006D,0x00E9,0x0020,0x0028,0x0063,0x0029,
+    0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0x201C,0x0071,0x0075,0x006F,
+    0x0074,0x0065,0x0064,0x201D,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,
+    0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,
+    0x003E,0x0063,0x0061,0x0066,0x00E9,0x0020,0x003C,0x002F,0x0070,0x003E,
+    0x000D,0x000A,0x006E,0x0061,0x00EF,0x0076,0x0065,0x0020,0x003C,0x0061,
+    0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,
+    0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,
+    0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x0020,0x003C,0x002F,0x0061,
+    0x003E,0x0020,0x20AC,0x0035,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,
+    0x0034,0x0032,0x003A,0x0020,0x0072,0x00E9,0x0073,0x0075,0x006D,0x00E9,
+    0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,
+    0x0020,0x201C,0x0071,0x0075,0x006F,0x0074,0x0065,0x0064,0x201D,0x0020,
+    0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,
+    0x006C,0x0065,0x0066,0x0074,0x003E,0x0063,0x0061,0x0066,0x00E9,0x0020,
+    0x003C,0x002F,0x0074,0x0064,0x003E,0x006E,0x0061,0x00EF,0x0076,0x0065,
+    0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,
+    0x002E,0x0030,0x003B,0x0020,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,
+    0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,
+    0x20AC,0x0035,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,
+    0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x0072,
+    0x00E9,0x0073,0x0075,0x006D,0x00E9,0x0020,0x003C,0x002F,0x0070,0x003E,
+    0x000D,0x000A,0x201C,0x0071,0x0075,0x006F,0x0074,0x0065,0x0064,0x201D,
+    0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,
+    0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,
+    0x006C,0x0022,0x003E,0x0063,0x0061,0x0066,0x00E9,0x0020,0x003C,0x002F,
+    0x0061,0x003E,0x0020,0x006E,0x0061,0x00EF,0x0076,0x0065,0x0020,0x0049,
+    0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x004D,0x00FC,
+    0x006C,0x006C,0x0065,0x0072,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,
+    0x006C,0x0073,0x006F,0x002C,0x0020,0x20AC,0x0035,0x0020,0x003C,0x0074,
+    0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,
+    0x0066,0x0074,0x003E,0x0072,0x00E9,0x0073,0x0075,0x006D,0x00E9,0x0020,
+    0x003C,0x002F,0x0074,0x0064,0x003E,0x201C,0x0071,0x0075,0x006F,0x0074,
+    0x0065,0x0064,0x201D,0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,
+    0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x0063,0x0061,0x0066,
+    0x00E9,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,
+    0x0020,0x006E,0x0061,0x00EF,0x0076,0x0065,0x0020,0x003C,0x0070,0x0020,
+    0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,
+    0x0074,0x0022,0x003E,0x004D,0x00FC,0x006C,0x006C,0x0065,0x0072,0x0020,
+    0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x20AC,0x0035,0x0020,0x003C,
+    0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,
+    0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,
+    0x003E,0x0072,0x00E9,0x0073,0x0075,0x006D,0x00E9,0x0020,0x003C,0x002F,
+    0x0061,0x003E,0x0020,0x201C,0x0071,0x0075,0x006F,0x0074,0x0065,0x0064,
+    0x201D,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,
+    0x0020,0x0063,0x0061,0x0066,0x00E9,0x0020,0x0073,0x0065,0x0065,0x0020,
+    0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x006E,0x0061,0x00EF,0x0076,
+    0x0065,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,
+    0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0x004D,0x00FC,0x006C,
+    0x006C,0x0065,0x0072,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0x20AC,
+    0x0035,0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,
+    0x0031,0x002E,0x0030,0x003B,0x0020,0x0072,0x00E9,0x0073,0x0075,0x006D,
+    0x00E9,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,
+    0x0020,0x201C,0x0071,0x0075,0x006F,0x0074,0x0065,0x0064,0x201D,0x0020,
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x0063,0x0061,0x0066,0x00E9,
+    0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x006E,0x0061,0x00EF,
+    0x0076,0x0065,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,
+    0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,
+    0x0074,0x006D,0x006C,0x0022,0x003E,0x004D,0x00FC,0x006C,0x006C,0x0065,
+    0x0072,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x20AC,0x0035,0x0020,
+    0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x0072,
+    0x00E9,0x0073,0x0075,0x006D,0x00E9,0x0020,0x0073,0x0065,0x0065,0x0020,
+    0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x201C,0x0071,0x0075,0x006F,
+    0x0074,0x0065,0x0064,0x201D,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,
+    0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,
+    0x0063,0x0061,0x0066,0x00E9,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,
+    0x006E,0x0061,0x00EF,0x0076,0x0065,0x0020,0x0056,0x0065,0x0072,0x0073,
+    0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x004D,
+    0x00FC,0x006C,0x006C,0x0065,0x0072,0x0020,0x0028,0x0063,0x0029,0x0020,
+    0x0032,0x0030,0x0032,0x0034,0x0020,0x20AC,0x0035,0x0020,0x003C,0x0070,
+    0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,
+    0x0078,0x0074,0x0022,0x003E,0x0072,0x00E9,0x0073,0x0075,0x006D,0x00E9,
+    0x0020
+};
+
+unsigned char windows1252_encSource[]={
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0x63,0x61,0x66,0xE9,
+    0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x6E,0x61,0xEF,0x76,0x65,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,
+    0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0x4D,0xFC,0x6C,0x6C,0x65,
+    0x72,0x20,0x3C,0x2F,0x61,0x3E,0x20,0x80,0x35,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0x72,
+    0xE9,0x73,0x75,0x6D,0xE9,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x93,0x71,0x75,0x6F,
+    0x74,0x65,0x64,0x94,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,
+    0x63,0x61,0x66,0xE9,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x6E,0x61,0xEF,0x76,0x65,0x20,0x56,0x65,0x72,0x73,
+    0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x20,0x28,0x63,0x29,0x20,
+    0x32,0x30,0x32,0x34,0x20,0x80,0x35,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,
+    0x78,0x74,0x22,0x3E,0x72,0xE9,0x73,0x75,0x6D,0xE9,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x93,0x71,0x75,
+    0x6F,0x74,0x65,0x64,0x94,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,
+    0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0x63,0x61,0x66,0xE9,0x20,0x3C,0x2F,0x61,0x3E,0x20,0x6E,0x61,
+    0xEF,0x76,0x65,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x20,
+    0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x80,0x35,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,
+    0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0x72,0xE9,0x73,0x75,0x6D,0xE9,0x20,0x3C,0x2F,0x74,0x64,0x3E,
+    0x93,0x71,0x75,0x6F,0x74,0x65,0x64,0x94,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,
+    0x3B,0x20,0x63,0x61,0x66,0xE9,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0x6E,0x61,0xEF,0x76,
+    0x65,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0x4D,0xFC,
+    0x6C,0x6C,0x65,0x72,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x80,0x35,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,
+    0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0x72,0xE9,0x73,0x75,
+    0x6D,0xE9,0x20,0x3C,0x2F,0x61,0x3E,0x20,0x93,0x71,0x75,0x6F,0x74,0x65,0x64,0x94,0x20,0x49,0x74,0x65,
+    0x6D,0x20,0x34,0x32,0x3A,0x20,0x63,0x61,0x66,0xE9,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,
+    0x20,0x6E,0x61,0xEF,0x76,0x65,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,
+    0x74,0x3E,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x80,0x35,0x20,0x56,0x65,0x72,
+    0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0x72,0xE9,0x73,0x75,0x6D,0xE9,0x20,0x28,0x63,0x29,
+    0x20,0x32,0x30,0x32,0x34,0x20,0x93,0x71,0x75,0x6F,0x74,0x65,0x64,0x94,0x20,0x3C,0x70,0x20,0x63,0x6C,
+    0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0x63,0x61,0x66,0xE9,0x20,0x3C,0x2F,0x70,0x3E,
+    0x0D,0x0A,0x6E,0x61,0xEF,0x76,0x65,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,
+    0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x20,0x3C,0x2F,0x61,
+    0x3E,0x20,0x80,0x35,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0x72,0xE9,0x73,0x75,0x6D,0xE9,
+    0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x93,0x71,0x75,0x6F,0x74,0x65,0x64,0x94,0x20,
+    0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0x63,0x61,0x66,0xE9,0x20,
+    0x3C,0x2F,0x74,0x64,0x3E,0x6E,0x61,0xEF,0x76,0x65,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,
+    0x2E,0x30,0x3B,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,
+    0x80,0x35,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0x72,
+    0xE9,0x73,0x75,0x6D,0xE9,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x93,0x71,0x75,0x6F,0x74,0x65,0x64,0x94,
+    0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,
+    0x6C,0x22,0x3E,0x63,0x61,0x66,0xE9,0x20,0x3C,0x2F,0x61,0x3E,0x20,0x6E,0x61,0xEF,0x76,0x65,0x20,0x49,
+    0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x20,0x73,0x65,0x65,0x20,0x61,
+    0x6C,0x73,0x6F,0x2C,0x20,0x80,0x35,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,
+    0x66,0x74,0x3E,0x72,0xE9,0x73,0x75,0x6D,0xE9,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x93,0x71,0x75,0x6F,0x74,
+    0x65,0x64,0x94,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0x63,0x61,0x66,
+    0xE9,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0x6E,0x61,0xEF,0x76,0x65,0x20,0x3C,0x70,0x20,
+    0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x20,
+    0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x80,0x35,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,
+    0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0x72,0xE9,0x73,0x75,0x6D,0xE9,0x20,0x3C,0x2F,
+    0x61,0x3E,0x20,0x93,0x71,0x75,0x6F,0x74,0x65,0x64,0x94,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,
+    0x20,0x63,0x61,0x66,0xE9,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0x6E,0x61,0xEF,0x76,
+    0x65,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0x4D,0xFC,0x6C,
+    0x6C,0x65,0x72,0x20,0x3C,0x2F,0x74,0x64,0x3E,0x80,0x35,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,
+    0x31,0x2E,0x30,0x3B,0x20,0x72,0xE9,0x73,0x75,0x6D,0xE9,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,
+    0x20,0x93,0x71,0x75,0x6F,0x74,0x65,0x64,0x94,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,
+    0x74,0x65,0x78,0x74,0x22,0x3E,0x63,0x61,0x66,0xE9,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0x6E,0x61,0xEF,
+    0x76,0x65,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,
+    0x74,0x6D,0x6C,0x22,0x3E,0x4D,0xFC,0x6C,0x6C,0x65,0x72,0x20,0x3C,0x2F,0x61,0x3E,0x20,0x80,0x35,0x20,
+    0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0x72,0xE9,0x73,0x75,0x6D,0xE9,0x20,0x73,0x65,0x65,0x20,
+    0x61,0x6C,0x73,0x6F,0x2C,0x20,0x93,0x71,0x75,0x6F,0x74,0x65,0x64,0x94,0x20,0x3C,0x74,0x64,0x20,0x61,
+    0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0x63,0x61,0x66,0xE9,0x20,0x3C,0x2F,0x74,0x64,0x3E,
+    0x6E,0x61,0xEF,0x76,0x65,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0x4D,
+    0xFC,0x6C,0x6C,0x65,0x72,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0x80,0x35,0x20,0x3C,0x70,
+    0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0x72,0xE9,0x73,0x75,0x6D,0xE9,
+    0x20
+};
+
+WCHAR windows1251_uniSource[]={
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x041F,0x0440,0x0438,0x0432,
+    0x0435,0x0442,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x043C,
+    0x0438,0x0440,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,
+    0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,
+    0x0074,0x006D,0x006C,0x0022,0x003E,0x043A,0x043E,0x0434,0x0438,0x0440,
+    0x043E,0x0432,0x043A,0x0430,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,
+    0x041C,0x043E,0x0441,0x043A,0x0432,0x0430,0x0020,0x0049,0x0074,0x0065,
+    0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x0442,0x0435,0x043A,0x0441,
+    0x0442,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,
+    0x002C,0x0020,0x2116,0x0037,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,
+    0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,
+    0x041F,0x0440,0x0438,0x0432,0x0435,0x0442,0x0020,0x003C,0x002F,0x0074,
+    0x0064,0x003E,0x043C,0x0438,0x0440,0x0020,0x0056,0x0065,0x0072,0x0073,
+    0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x043A,
+    0x043E,0x0434,0x0438,0x0440,0x043E,0x0432,0x043A,0x0430,0x0020,0x0028,
+    0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0x041C,0x043E,
+    0x0441,0x043A,0x0432,0x0430,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,
+    0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,
+    0x003E,0x0442,0x0435,0x043A,0x0441,0x0442,0x0020,0x003C,0x002F,0x0070,
+    0x003E,0x000D,0x000A,0x2116,0x0037,0x0020,0x003C,0x0061,0x0020,0x0068,
+    0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,
+    0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x041F,0x0440,
+    0x0438,0x0432,0x0435,0x0442,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,
+    0x043C,0x0438,0x0440,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,
+    0x0032,0x003A,0x0020,0x043A,0x043E,0x0434,0x0438,0x0440,0x043E,0x0432,
+    0x043A,0x0430,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,
+    0x006F,0x002C,0x0020,0x041C,0x043E,0x0441,0x043A,0x0432,0x0430,0x0020,
+    0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,
+    0x006C,0x0065,0x0066,0x0074,0x003E,0x0442,0x0435,0x043A,0x0441,0x0442,
+    0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0x2116,0x0037,0x0020,0x0056,
+    0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,
+    0x003B,0x0020,0x041F,0x0440,0x0438,0x0432,0x0435,0x0442,0x0020,0x0028,
+    0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0x043C,0x0438,
+    0x0440,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,
+    0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x043A,0x043E,
+    0x0434,0x0438,0x0440,0x043E,0x0432,0x043A,0x0430,0x0020,0x003C,0x002F,
+    0x0070,0x003E,0x000D,0x000A,0x041C,0x043E,0x0441,0x043A,0x0432,0x0430,
+    0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,
+    0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,
+    0x006C,0x0022,0x003E,0x0442,0x0435,0x043A,0x0441,0x0442,0x0020,0x003C,
+    0x002F,0x0061,0x003E,0x0020,0x2116,0x0037,0x0020,0x0049,0x0074,0x0065,
+    0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x041F,0x0440,0x0438,0x0432,
+    0x0435,0x0442,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,
+    0x006F,0x002C,0x0020,0x043C,0x0438,0x0440,0x0020,0x003C,0x0074,0x0064,
+    0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,
+    0x0074,0x003E,0x043A,0x043E,0x0434,0x0438,0x0440,0x043E,0x0432,0x043A,
+    0x0430,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0x041C,0x043E,0x0441,
+    0x043A,0x0432,0x0430,0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,
+    0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x0442,0x0435,0x043A,
+    0x0441,0x0442,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,
+    0x0034,0x0020,0x2116,0x0037,0x0020,0x003C,0x0070,0x0020,0x0063,0x006C,
+    0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,0x0074,0x0022,
+    0x003E,0x041F,0x0440,0x0438,0x0432,0x0435,0x0442,0x0020,0x003C,0x002F,
+    0x0070,0x003E,0x000D,0x000A,0x043C,0x0438,0x0440,0x0020,0x003C,0x0061,
+    0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,
+    0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,
+    0x043A,0x043E,0x0434,0x0438,0x0440,0x043E,0x0432,0x043A,0x0430,0x0020,
+    0x003C,0x002F,0x0061,0x003E,0x0020,0x041C,0x043E,0x0441,0x043A,0x0432,
+    0x0430,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,
+    0x0020,0x0442,0x0435,0x043A,0x0441,0x0442,0x0020,0x0073,0x0065,0x0065,
+    0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x2116,0x0037,0x0020,
+    0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,0x006E,0x003D,
+    0x006C,0x0065,0x0066,0x0074,0x003E,0x041F,0x0440,0x0438,0x0432,0x0435,
+    0x0442,0x0020,0x003C,0x002F,0x0074,0x0064,0x003E,0x043C,0x0438,0x0440,
+    0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,
+    0x002E,0x0030,0x003B,0x0020,0x043A,0x043E,0x0434,0x0438,0x0440,0x043E,
+    0x0432,0x043A,0x0430,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,
+    0x0032,0x0034,0x0020,0x041C,0x043E,0x0441,0x043A,0x0432,0x0430,0x0020,
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x0442,0x0435,0x043A,0x0441,
+    0x0442,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x2116,0x0037,
+    0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,0x003D,0x0022,
+    0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,0x0074,0x006D,
+    0x006C,0x0022,0x003E,0x041F,0x0440,0x0438,0x0432,0x0435,0x0442,0x0020,
+    0x003C,0x002F,0x0061,0x003E,0x0020,0x043C,0x0438,0x0440,0x0020,0x0049,
+    0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x043A,0x043E,
+    0x0434,0x0438,0x0440,0x043E,0x0432,0x043A,0x0430,0x0020,0x0073,0x0065,
+    0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x041C,0x043E,
+    0x0441,0x043A,0x0432,0x0430,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,
+    0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,
+    0x0442,0x0435,0x043A,0x0441,0x0442,0x0020,0x003C,0x002F,0x0074,0x0064,
+    0x003E,0x2116,0x0037,0x0020,0x0056,0x0065,0x0072,0x0073,0x0069,0x006F,
+    0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x041F,0x0440,0x0438,
+    0x0432,0x0435,0x0442,0x0020,0x0028,0x0063,0x0029,0x0020,0x0032,0x0030,
+    0x0032,0x0034,0x0020,0x043C,0x0438,0x0440,0x0020,0x003C,0x0070,0x0020,
+    0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,0x0074,0x0065,0x0078,
+    0x0074,0x0022,0x003E,0x043A,0x043E,0x0434,0x0438,0x0440,0x043E,0x0432,
+    0x043A,0x0430,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x041C,
+    0x043E,0x0441,0x043A,0x0432,0x0430,0x0020,0x003C,0x0061,0x0020,0x0068,
+    0x0072,0x0065,0x0066,0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,
+    0x0078,0x002E,0x0068,0x0074,0x006D,0x006C,0x0022,0x003E,0x0442,0x0435,
+    0x043A,0x0441,0x0442,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,0x2116,
+    0x0037,0x0020,0x0049,0x0074,0x0065,0x006D,0x0020,0x0034,0x0032,0x003A,
+    0x0020,0x041F,0x0440,0x0438,0x0432,0x0435,0x0442,0x0020,0x0073,0x0065,
+    0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,0x002C,0x0020,0x043C,0x0438,
+    0x0440,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,0x006C,0x0069,0x0067,
+    0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,0x043A,0x043E,0x0434,
+    0x0438,0x0440,0x043E,0x0432,0x043A,0x0430,0x0020,0x003C,0x002F,0x0074,
+    0x0064,0x003E,0x041C,0x043E,0x0441,0x043A,0x0432,0x0430,0x0020,0x0056,
+    0x0065,0x0072,0x0073,0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,
+    0x003B,0x0020,0x0442,0x0435,0x043A,0x0441,0x0442,0x0020,0x0028,0x0063,
+    0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0x2116,0x0037,0x0020,
+    0x003C,0x0070,0x0020,0x0063,0x006C,0x0061,0x0073,0x0073,0x003D,0x0022,
+    0x0074,0x0065,0x0078,0x0074,0x0022,0x003E,0x041F,0x0440,0x0438,0x0432,
+    0x0435,0x0442,0x0020,0x003C,0x002F,0x0070,0x003E,0x000D,0x000A,0x043C,
+    0x0438,0x0440,0x0020,0x003C,0x0061,0x0020,0x0068,0x0072,0x0065,0x0066,
+    0x003D,0x0022,0x002F,0x0069,0x006E,0x0064,0x0065,0x0078,0x002E,0x0068,
+    0x0074,0x006D,0x006C,0x0022,0x003E,0x043A,0x043E,0x0434,0x0438,0x0440,
+    0x043E,0x0432,0x043A,0x0430,0x0020,0x003C,0x002F,0x0061,0x003E,0x0020,
+    0x041C,0x043E,0x0441,0x043A,0x0432,0x0430,0x0020,0x0049,0x0074,0x0065,
+    0x006D,0x0020,0x0034,0x0032,0x003A,0x0020,0x0442,0x0435,0x043A,0x0441,
+    0x0442,0x0020,0x0073,0x0065,0x0065,0x0020,0x0061,0x006C,0x0073,0x006F,
+    0x002C,0x0020,0x2116,0x0037,0x0020,0x003C,0x0074,0x0064,0x0020,0x0061,
+    0x006C,0x0069,0x0067,0x006E,0x003D,0x006C,0x0065,0x0066,0x0074,0x003E,
+    0x041F,0x0440,0x0438,0x0432,0x0435,0x0442,0x0020,0x003C,0x002F,0x0074,
+    0x0064,0x003E,0x043C,0x0438,0x0440,0x0020,0x0056,0x0065,0x0072,0x0073,
+    0x0069,0x006F,0x006E,0x0020,0x0031,0x002E,0x0030,0x003B,0x0020,0x043A,
+    0x043E,0x0434,0x0438,0x0440,0x043E,0x0432,0x043A,0x0430,0x0020,0x0028,
+    0x0063,0x0029,0x0020,0x0032,0x0030,0x0032,0x0034,0x0020,0x041C,0x043E,
+    0x0441,0x043A,0x0432,0x0430,0x0020
+};
+
+unsigned char windows1251_encSource[]={
+    0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xCF,0xF0,0xE8,0xE2,
+    0xE5,0xF2,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xEC,0xE8,0xF0,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,
+    0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xEA,0xEE,0xE4,0xE8,0xF0,
+    0xEE,0xE2,0xEA,0xE0,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xCC,0xEE,0xF1,0xEA,0xE2,0xE0,0x20,0x49,0x74,0x65,
+    0x6D,0x20,0x34,0x32,0x3A,0x20,0xF2,0xE5,0xEA,0xF1,0xF2,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,
+    0x2C,0x20,0xB9,0x37,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,
+    0xCF,0xF0,0xE8,0xE2,0xE5,0xF2,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xEC,0xE8,0xF0,0x20,0x56,0x65,0x72,0x73,
+    0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xEA,0xEE,0xE4,0xE8,0xF0,0xEE,0xE2,0xEA,0xE0,0x20,0x28,
+    0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xCC,0xEE,0xF1,0xEA,0xE2,0xE0,0x20,0x3C,0x70,0x20,0x63,0x6C,
+    0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xF2,0xE5,0xEA,0xF1,0xF2,0x20,0x3C,0x2F,0x70,
+    0x3E,0x0D,0x0A,0xB9,0x37,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,
+    0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xCF,0xF0,0xE8,0xE2,0xE5,0xF2,0x20,0x3C,0x2F,0x61,0x3E,0x20,
+    0xEC,0xE8,0xF0,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xEA,0xEE,0xE4,0xE8,0xF0,0xEE,0xE2,
+    0xEA,0xE0,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xCC,0xEE,0xF1,0xEA,0xE2,0xE0,0x20,
+    0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xF2,0xE5,0xEA,0xF1,0xF2,
+    0x20,0x3C,0x2F,0x74,0x64,0x3E,0xB9,0x37,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,
+    0x3B,0x20,0xCF,0xF0,0xE8,0xE2,0xE5,0xF2,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xEC,0xE8,
+    0xF0,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xEA,0xEE,
+    0xE4,0xE8,0xF0,0xEE,0xE2,0xEA,0xE0,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xCC,0xEE,0xF1,0xEA,0xE2,0xE0,
+    0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,
+    0x6C,0x22,0x3E,0xF2,0xE5,0xEA,0xF1,0xF2,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xB9,0x37,0x20,0x49,0x74,0x65,
+    0x6D,0x20,0x34,0x32,0x3A,0x20,0xCF,0xF0,0xE8,0xE2,0xE5,0xF2,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,
+    0x6F,0x2C,0x20,0xEC,0xE8,0xF0,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,
+    0x74,0x3E,0xEA,0xEE,0xE4,0xE8,0xF0,0xEE,0xE2,0xEA,0xE0,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xCC,0xEE,0xF1,
+    0xEA,0xE2,0xE0,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xF2,0xE5,0xEA,
+    0xF1,0xF2,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xB9,0x37,0x20,0x3C,0x70,0x20,0x63,0x6C,
+    0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xCF,0xF0,0xE8,0xE2,0xE5,0xF2,0x20,0x3C,0x2F,
+    0x70,0x3E,0x0D,0x0A,0xEC,0xE8,0xF0,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,
+    0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xEA,0xEE,0xE4,0xE8,0xF0,0xEE,0xE2,0xEA,0xE0,0x20,
+    0x3C,0x2F,0x61,0x3E,0x20,0xCC,0xEE,0xF1,0xEA,0xE2,0xE0,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,
+    0x20,0xF2,0xE5,0xEA,0xF1,0xF2,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xB9,0x37,0x20,
+    0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xCF,0xF0,0xE8,0xE2,0xE5,
+    0xF2,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xEC,0xE8,0xF0,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,
+    0x2E,0x30,0x3B,0x20,0xEA,0xEE,0xE4,0xE8,0xF0,0xEE,0xE2,0xEA,0xE0,0x20,0x28,0x63,0x29,0x20,0x32,0x30,
+    0x32,0x34,0x20,0xCC,0xEE,0xF1,0xEA,0xE2,0xE0,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,
+    0x74,0x65,0x78,0x74,0x22,0x3E,0xF2,0xE5,0xEA,0xF1,0xF2,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xB9,0x37,
+    0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,
+    0x6C,0x22,0x3E,0xCF,0xF0,0xE8,0xE2,0xE5,0xF2,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xEC,0xE8,0xF0,0x20,0x49,
+    0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xEA,0xEE,0xE4,0xE8,0xF0,0xEE,0xE2,0xEA,0xE0,0x20,0x73,0x65,
+    0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xCC,0xEE,0xF1,0xEA,0xE2,0xE0,0x20,0x3C,0x74,0x64,0x20,0x61,
+    0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xF2,0xE5,0xEA,0xF1,0xF2,0x20,0x3C,0x2F,0x74,0x64,
+    0x3E,0xB9,0x37,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xCF,0xF0,0xE8,
+    0xE2,0xE5,0xF2,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xEC,0xE8,0xF0,0x20,0x3C,0x70,0x20,
+    0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,0x74,0x65,0x78,0x74,0x22,0x3E,0xEA,0xEE,0xE4,0xE8,0xF0,0xEE,0xE2,
+    0xEA,0xE0,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xCC,0xEE,0xF1,0xEA,0xE2,0xE0,0x20,0x3C,0x61,0x20,0x68,
+    0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,0x74,0x6D,0x6C,0x22,0x3E,0xF2,0xE5,
+    0xEA,0xF1,0xF2,0x20,0x3C,0x2F,0x61,0x3E,0x20,0xB9,0x37,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,
+    0x20,0xCF,0xF0,0xE8,0xE2,0xE5,0xF2,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xEC,0xE8,
+    0xF0,0x20,0x3C,0x74,0x64,0x20,0x61,0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xEA,0xEE,0xE4,
+    0xE8,0xF0,0xEE,0xE2,0xEA,0xE0,0x20,0x3C,0x2F,0x74,0x64,0x3E,0xCC,0xEE,0xF1,0xEA,0xE2,0xE0,0x20,0x56,
+    0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xF2,0xE5,0xEA,0xF1,0xF2,0x20,0x28,0x63,
+    0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xB9,0x37,0x20,0x3C,0x70,0x20,0x63,0x6C,0x61,0x73,0x73,0x3D,0x22,
+    0x74,0x65,0x78,0x74,0x22,0x3E,0xCF,0xF0,0xE8,0xE2,0xE5,0xF2,0x20,0x3C,0x2F,0x70,0x3E,0x0D,0x0A,0xEC,
+    0xE8,0xF0,0x20,0x3C,0x61,0x20,0x68,0x72,0x65,0x66,0x3D,0x22,0x2F,0x69,0x6E,0x64,0x65,0x78,0x2E,0x68,
+    0x74,0x6D,0x6C,0x22,0x3E,0xEA,0xEE,0xE4,0xE8,0xF0,0xEE,0xE2,0xEA,0xE0,0x20,0x3C,0x2F,0x61,0x3E,0x20,
+    0xCC,0xEE,0xF1,0xEA,0xE2,0xE0,0x20,0x49,0x74,0x65,0x6D,0x20,0x34,0x32,0x3A,0x20,0xF2,0xE5,0xEA,0xF1,
+    0xF2,0x20,0x73,0x65,0x65,0x20,0x61,0x6C,0x73,0x6F,0x2C,0x20,0xB9,0x37,0x20,0x3C,0x74,0x64,0x20,0x61,
+    0x6C,0x69,0x67,0x6E,0x3D,0x6C,0x65,0x66,0x74,0x3E,0xCF,0xF0,0xE8,0xE2,0xE5,0xF2,0x20,0x3C,0x2F,0x74,
+    0x64,0x3E,0xEC,0xE8,0xF0,0x20,0x56,0x65,0x72,0x73,0x69,0x6F,0x6E,0x20,0x31,0x2E,0x30,0x3B,0x20,0xEA,
+    0xEE,0xE4,0xE8,0xF0,0xEE,0xE2,0xEA,0xE0,0x20,0x28,0x63,0x29,0x20,0x32,0x30,0x32,0x34,0x20,0xCC,0xEE,
+    0xF1,0xEA,0xE2,0xE0,0x20
+};
+
 #endif
 
@@ -59,6 +59,9 @@
 my $tests = {
     "ICU Forward Search", [ "$p1 Test_ICU_Forward_Search", "$p2 Test_ICU_Forward_Search" ],
     "ICU Backward Search",[ "$p1 Test_ICU_Backward_Search", "$p2 Test_ICU_Backward_Search" ],
+    "ICU Forward Search Long",[ "$p1 Test_ICU_Forward_Search_Long", "$p2 Test_ICU_Forward_Search_Long" ],
+    "ICU Backward Search Long",[ "$p1 Test_ICU_Backward_Search_Long", "$p2 Test_ICU_Backward_Search_Long" ],
+    "ICU Forward Search Long Primary",[ "$p1 Test_ICU_Forward_Search_Long_Primary", "$p2 Test_ICU_Forward_Search_Long_Primary" ],
 };
 
 runTests( $options, $tests, $dataFiles );
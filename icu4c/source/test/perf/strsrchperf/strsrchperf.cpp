@@ -21,6 +21,10 @@ StringSearchPerformanceTest::StringSearchPerformanceTest(int32_t argc, const cha
     int32_t start, end;
     srch = nullptr;
     pttrn = nullptr;
+    longSrc = nullptr;
+    longSrch = nullptr;
+    primaryColl = nullptr;
+    longPrimarySrch = nullptr;
     if(status== U_ILLEGAL_ARGUMENT_ERROR || line_mode){
        fprintf(stderr,gUsageString, "strsrchperf");
        return;
@@ -71,7 +75,25 @@ StringSearchPerformanceTest::StringSearchPerformanceTest(int32_t argc, const cha
         fprintf(stderr, "FAILED to create UPerfTest object. Error: %s\n", u_errorName(status));
         return;
     }
-    
+
+    /* Repeat the text into a haystack of at least LONG_SOURCE_MIN_LENGTH code units. */
+    int32_t copies = srcLen > 0 ? (LONG_SOURCE_MIN_LENGTH + srcLen - 1) / srcLen : 0;
+    longSrcLen = copies * srcLen;
+    longSrc = static_cast<char16_t*>(malloc(sizeof(char16_t) * (longSrcLen > 0 ? longSrcLen : 1)));
+    for (int32_t i = 0; i < copies; i++) {
+        u_memcpy(longSrc + i * srcLen, src, srcLen);
+    }
+    longSrch = usearch_open(pttrn, pttrnLen, longSrc, longSrcLen, locale, nullptr, &status);
+
+    /* The same search at primary strength. */
+    primaryColl = ucol_open(locale, &status);
+    ucol_setStrength(primaryColl, UCOL_PRIMARY);
+    longPrimarySrch = usearch_openFromCollator(pttrn, pttrnLen, longSrc, longSrcLen, primaryColl, nullptr, &status);
+
+    if(U_FAILURE(status)){
+        fprintf(stderr, "FAILED to create the long haystack searches. Error: %s\n", u_errorName(status));
+        return;
+    }
 }
 
 StringSearchPerformanceTest::~StringSearchPerformanceTest() {
@@ -81,12 +103,19 @@ StringSearchPerformanceTest::~StringSearchPerformanceTest() {
     if (srch != nullptr) {
         usearch_close(srch);
     }
+    usearch_close(longSrch);
+    usearch_close(longPrimarySrch);
+    ucol_close(primaryColl);
+    free(longSrc);
 }
 
 UPerfFunction* StringSearchPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char *par) {
     switch (index) {
         TESTCASE(0,Test_ICU_Forward_Search);
         TESTCASE(1,Test_ICU_Backward_Search);
+        TESTCASE(2,Test_ICU_Forward_Search_Long);
+        TESTCASE(3,Test_ICU_Backward_Search_Long);
+        TESTCASE(4,Test_ICU_Forward_Search_Long_Primary);
 
         default: 
             name = ""; 
@@ -105,6 +134,21 @@ UPerfFunction* StringSearchPerformanceTest::Test_ICU_Backward_Search(){
     return func;
 }
 
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Forward_Search_Long(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUForwardSearch, longSrch, longSrc, longSrcLen, pttrn, pttrnLen);
+    return func;
+}
+
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Backward_Search_Long(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUBackwardSearch, longSrch, longSrc, longSrcLen, pttrn, pttrnLen);
+    return func;
+}
+
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Forward_Search_Long_Primary(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUForwardSearch, longPrimarySrch, longSrc, longSrcLen, pttrn, pttrnLen);
+    return func;
+}
+
 int main (int argc, const char* argv[]) {
     UErrorCode status = U_ZERO_ERROR;
     StringSearchPerformanceTest test(argc, argv, status);
@@ -12,10 +12,15 @@
 #define _STRSRCHPERF_H
 
 #include "unicode/usearch.h"
+#include "unicode/ucol.h"
+#include "unicode/ustring.h"
 #include "unicode/uperf.h"
 #include <stdlib.h>
 #include <stdio.h>
 
+/* Minimum length of the long haystack, in code units. */
+#define LONG_SOURCE_MIN_LENGTH (1 << 20)
+
 typedef void (*StrSrchFn)(UStringSearch* srch, const char16_t* src,int32_t srcLen, const char16_t* pttrn, int32_t pttrnLen, UErrorCode* status);
 
 class StringSearchPerfFunction : public UPerfFunction {
@@ -53,6 +58,12 @@ class StringSearchPerformanceTest : public UPerfTest {
     char16_t* pttrn;
     int32_t pttrnLen;
     UStringSearch* srch;
+    /* The source text repeated into a long haystack, and searches over it. */
+    char16_t* longSrc;
+    int32_t longSrcLen;
+    UStringSearch* longSrch;
+    UCollator* primaryColl;
+    UStringSearch* longPrimarySrch;
     
 public:
     StringSearchPerformanceTest(int32_t argc, const char *argv[], UErrorCode &status);
@@ -60,6 +71,9 @@ class StringSearchPerformanceTest : public UPerfTest {
     UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
     UPerfFunction* Test_ICU_Forward_Search();
     UPerfFunction* Test_ICU_Backward_Search();
+    UPerfFunction* Test_ICU_Forward_Search_Long();
+    UPerfFunction* Test_ICU_Backward_Search_Long();
+    UPerfFunction* Test_ICU_Forward_Search_Long_Primary();
 };
 
 
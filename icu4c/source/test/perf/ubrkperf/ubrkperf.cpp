@@ -160,6 +160,25 @@ UPerfFunction* BreakIteratorPerformanceTest::TestICUIsBound()
   return new ICUIsBound(locale, m_mode_, m_file_, m_fileLen_);
 }
 
+UPerfFunction* BreakIteratorPerformanceTest::TestICULSTMForward()
+{
+  if (m_lstmModel_ == nullptr) {
+    return nullptr;
+  }
+  ICULSTMForward *func = new ICULSTMForward(m_lstmPath_, m_lstmModel_, m_file_, m_fileLen_);
+  if (U_FAILURE(func->getStatus())) {
+    fprintf(stderr, "FAILED to load LSTM model %s. Error: %s\n", m_lstmModel_, u_errorName(func->getStatus()));
+    delete func;
+    return nullptr;
+  }
+  return func;
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestICUPhraseForward()
+{
+  return new ICUPhraseForward(locale, m_file_, m_fileLen_);
+}
+
 UPerfFunction* BreakIteratorPerformanceTest::TestDarwinForward()
 {
   return nullptr;
@@ -179,6 +198,8 @@ UPerfFunction* BreakIteratorPerformanceTest::runIndexedTest(int32_t index, UBool
 		TESTCASE(1, TestICUIsBound);
 		TESTCASE(2, TestDarwinForward);
 		TESTCASE(3, TestDarwinIsBound);
+		TESTCASE(4, TestICULSTMForward);
+		TESTCASE(5, TestICUPhraseForward);
         default: 
             name = ""; 
             return nullptr;
@@ -187,20 +208,21 @@ UPerfFunction* BreakIteratorPerformanceTest::runIndexedTest(int32_t index, UBool
 }
 
 UOption options[]={
-                      UOPTION_DEF( "mode",        'm', UOPT_REQUIRES_ARG)
+                      UOPTION_DEF( "mode",        'm', UOPT_REQUIRES_ARG),
+                      UOPTION_DEF( "lstm",        'M', UOPT_REQUIRES_ARG),
+                      UOPTION_DEF( "lstmpath",    'P', UOPT_REQUIRES_ARG)
                   };
 
 
 BreakIteratorPerformanceTest::BreakIteratorPerformanceTest(int32_t argc, const char* argv[], UErrorCode& status)
-: UPerfTest(argc,argv,status),
+: UPerfTest(argc,argv,options,UPRV_LENGTHOF(options),nullptr,status),
 m_mode_(nullptr),
+m_lstmModel_(nullptr),
+m_lstmPath_(nullptr),
 m_file_(nullptr),
 m_fileLen_(0)
 {
 
-    _remainingArgc = u_parseArgs(_remainingArgc, const_cast<char**>(argv), UPRV_LENGTHOF(options), options);
-
-
     if(options[0].doesOccur) {
       m_mode_ = options[0].value;
       switch(options[0].value[0]) {
@@ -216,12 +238,20 @@ m_fileLen_(0)
     } else {
       status = U_ILLEGAL_ARGUMENT_ERROR;
     }
+    if(options[1].doesOccur) {
+      m_lstmModel_ = options[1].value;
+    }
+    if(options[2].doesOccur) {
+      m_lstmPath_ = options[2].value;
+    }
 
     m_file_ = getBuffer(m_fileLen_, status);
 
     if(status== U_ILLEGAL_ARGUMENT_ERROR){
        fprintf(stderr, gUsageString, "ubrkperf");
        fprintf(stderr, "\t-m or --mode        Required mode for breakiterator: char, word, line or sentence\n");
+       fprintf(stderr, "\t-M or --lstm        LSTM model name for TestICULSTMForward, e.g. Thai_graphclust_model4_heavy\n");
+       fprintf(stderr, "\t-P or --lstmpath    ICU data package containing the LSTM model, e.g. the testdata package\n");
 
        return;
     }
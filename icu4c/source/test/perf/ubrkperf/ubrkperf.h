@@ -15,12 +15,21 @@
 #include "unicode/uperf.h"
 
 #include <unicode/brkiter.h>
+#include <unicode/ures.h>
+#include <unicode/utext.h>
+#include <string.h>
+
+#include "brkeng.h"
+#include "lstmbe.h"
+#include "uvectr32.h"
 
 class ICUBreakFunction : public UPerfFunction {
 protected:
   BreakIterator *m_brkIt_;
   const char16_t *m_file_;
   int32_t m_fileLen_;
+  // The break iterator keeps a reference to its text, so it must outlive it.
+  UnicodeString m_text_;
   int32_t m_noBreaks_;
   UErrorCode m_status_;
 public:
@@ -28,6 +37,7 @@ class ICUBreakFunction : public UPerfFunction {
       m_brkIt_(nullptr),
       m_file_(file),
       m_fileLen_(file_len),
+      m_text_(false, file, file_len),
       m_noBreaks_(-1),
       m_status_(U_ZERO_ERROR)
   {
@@ -64,7 +74,7 @@ class ICUIsBound : public ICUBreakFunction {
       ICUBreakFunction(locale, mode, file, file_len)
   {
     m_noBreaks_ = 0;
-    m_brkIt_->setText(UnicodeString(m_file_, m_fileLen_));
+    m_brkIt_->setText(m_text_);
     m_brkIt_->first();
     int32_t j = 0;
     for(j = 0; j < m_fileLen_; j++) {
@@ -91,7 +101,7 @@ class ICUForward : public ICUBreakFunction {
       ICUBreakFunction(locale, mode, file, file_len)
   {
     m_noBreaks_ = 0;
-    m_brkIt_->setText(UnicodeString(m_file_, m_fileLen_));
+    m_brkIt_->setText(m_text_);
     m_brkIt_->first();
     while(m_brkIt_->next() != BreakIterator::DONE) {
       m_noBreaks_++;
@@ -107,6 +117,109 @@ class ICUForward : public ICUBreakFunction {
   }
 };
 
+// Line breaking with the "lw=phrase" keyword over Japanese text. This runs
+// the ML phrase break engine in builds with UCONFIG_USE_ML_PHRASE_BREAKING,
+// and the dictionary-based phrase breaking otherwise. The locale defaults
+// to "ja".
+class ICUPhraseForward : public ICUForward {
+public:
+  ICUPhraseForward(const char *locale, const char16_t *file, int32_t file_len) :
+      ICUForward(phraseLocale(locale).getName(), "line", file, file_len)
+  {
+  }
+private:
+  static Locale phraseLocale(const char *locale) {
+    UErrorCode status = U_ZERO_ERROR;
+    Locale loc(locale == nullptr || *locale == 0 ? "ja" : locale);
+    loc.setKeywordValue("lw", "phrase", status);
+    return loc;
+  }
+};
+
+// Runs an LSTM model directly over the whole file; the number of events is
+// the number of word breaks found, so events/second is words/second.
+class ICULSTMForward : public UPerfFunction {
+private:
+  const LanguageBreakEngine *m_engine_;
+  const char16_t *m_file_;
+  int32_t m_fileLen_;
+  int32_t m_noBreaks_;
+  UErrorCode m_status_;
+
+  // The engine only handles runs of characters of its script,
+  // so call it once for each such run in the file.
+  int32_t findBreaks(UErrorCode &status) {
+    UText ut = UTEXT_INITIALIZER;
+    utext_openUChars(&ut, m_file_, m_fileLen_, &status);
+    UVector32 breaks(status);
+    int32_t count = 0;
+    int32_t i = 0;
+    while (U_SUCCESS(status) && i < m_fileLen_) {
+      if (!m_engine_->handles(m_file_[i], nullptr)) {
+        i++;
+        continue;
+      }
+      int32_t start = i;
+      while (i < m_fileLen_ && m_engine_->handles(m_file_[i], nullptr)) {
+        i++;
+      }
+      breaks.removeAllElements();
+      count += m_engine_->findBreaks(&ut, start, i, breaks, false, status);
+    }
+    utext_close(&ut);
+    return count;
+  }
+
+public:
+  ICULSTMForward(const char *dataPath, const char *model, const char16_t *file, int32_t file_len) :
+      m_engine_(nullptr),
+      m_file_(file),
+      m_fileLen_(file_len),
+      m_noBreaks_(-1),
+      m_status_(U_ZERO_ERROR)
+  {
+    UScriptCode script = USCRIPT_INVALID_CODE;
+    if (strncmp(model, "Thai", 4) == 0) {
+      script = USCRIPT_THAI;
+    } else if (strncmp(model, "Burmese", 7) == 0) {
+      script = USCRIPT_MYANMAR;
+    } else {
+      m_status_ = U_ILLEGAL_ARGUMENT_ERROR;
+      return;
+    }
+    UResourceBundle *rb = ures_openDirect(dataPath, model, &m_status_);
+    const LSTMData *data = CreateLSTMData(rb, m_status_);
+    if (U_FAILURE(m_status_)) {
+      if (data != nullptr) {
+        DeleteLSTMData(data);
+      } else {
+        ures_close(rb);
+      }
+      return;
+    }
+    m_engine_ = CreateLSTMBreakEngine(script, data, m_status_);
+    if (U_FAILURE(m_status_) || m_engine_ == nullptr) {
+      // The engine did not adopt the data.
+      DeleteLSTMData(data);
+      m_engine_ = nullptr;
+      if (U_SUCCESS(m_status_)) {
+        m_status_ = U_MEMORY_ALLOCATION_ERROR;
+      }
+      return;
+    }
+    m_noBreaks_ = findBreaks(m_status_);
+  }
+
+  ~ICULSTMForward() { delete m_engine_; }
+  void call(UErrorCode* status) override
+  {
+    m_noBreaks_ = findBreaks(*status);
+  }
+  long getOperationsPerIteration() override { return m_fileLen_; }
+  long getEventsPerIteration() override { return m_noBreaks_; }
+  virtual UErrorCode getStatus() { return m_status_; }
+};
+
 class DarwinBreakFunction : public UPerfFunction {
 public:
   void call(UErrorCode* status) override {}
@@ -115,6 +228,8 @@ class DarwinBreakFunction : public UPerfFunction {
 class BreakIteratorPerformanceTest : public UPerfTest {
 private:
   const char* m_mode_;
+  const char* m_lstmModel_;
+  const char* m_lstmPath_;
   const char16_t* m_file_;
   int32_t m_fileLen_;
 
@@ -127,6 +242,8 @@ class BreakIteratorPerformanceTest : public UPerfTest {
 
   UPerfFunction* TestICUForward();
   UPerfFunction* TestICUIsBound();
+  UPerfFunction* TestICULSTMForward();
+  UPerfFunction* TestICUPhraseForward();
 
   UPerfFunction* TestDarwinForward();
   UPerfFunction* TestDarwinIsBound();
@@ -47,7 +47,10 @@ def generate_rb(config, io, common_vars):
         # LSTM models
         "Thai_graphclust_model4_heavy",
         "Thai_codepoints_exclusive_model5_heavy",
-        "Burmese_graphclust_model5_heavy"
+        "Burmese_graphclust_model5_heavy",
+        "Thai_graphclust_model4_heavy_int8",
+        "Thai_codepoints_exclusive_model5_heavy_int8",
+        "Burmese_graphclust_model5_heavy_int8"
         # "metaZones",
         # "timezoneTypes",
         # "windowsZones",